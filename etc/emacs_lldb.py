@@ -66,6 +66,8 @@ class Lisp_Object:
         "PVEC_THREAD": "struct thread_state",
         "PVEC_MUTEX": "Lisp_Mutex",
         "PVEC_CONDVAR": "Lisp_CondVar",
+        "PVEC_CHANNEL": "struct Lisp_Channel",
+        "PVEC_ASYNC_FUTURE": "struct Lisp_Async_Future",
         "PVEC_MODULE_FUNCTION": "struct Lisp_Module_Function",
         "PVEC_NATIVE_COMP_UNIT": "struct Lisp_Native_Comp_Unit",
         "PVEC_SQLITE": "struct Lisp_Sqlite",
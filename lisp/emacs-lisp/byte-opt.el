@@ -1872,9 +1872,9 @@ byte-optimize-set
          ;; charset.c
          charsetp
          ;; data.c
-         arrayp atom bare-symbol-p bool-vector-p bufferp byte-code-function-p
-         interpreted-function-p closurep
-         byteorder car-safe cdr-safe char-or-string-p char-table-p
+         arrayp async-future-p atom bare-symbol-p bool-vector-p bufferp
+         byte-code-function-p interpreted-function-p closurep
+         byteorder car-safe cdr-safe channelp char-or-string-p char-table-p
          condition-variable-p consp eq floatp indirect-function
          integer-or-marker-p integerp keywordp listp markerp
          module-function-p multibyte-string-p mutexp native-comp-function-p
@@ -1958,10 +1958,10 @@ byte-optimize-set
          ;; character.c
          characterp max-char
          ;; data.c
-         % * + - / /= 1+ 1- < <= = > >= aref arrayp ash atom bare-symbol
-         bool-vector-count-consecutive bool-vector-count-population
-         bool-vector-p bool-vector-subsetp
-         bufferp car car-safe cdr cdr-safe char-or-string-p char-table-p
+         % * + - / /= 1+ 1- < <= = > >= aref arrayp ash async-future-p atom
+         bare-symbol bool-vector-count-consecutive bool-vector-count-population
+         bool-vector-p bool-vector-subsetp bufferp
+         car car-safe cdr cdr-safe channelp char-or-string-p char-table-p
          condition-variable-p consp eq floatp integer-or-marker-p integerp
          keywordp listp logand logcount logior lognot logxor markerp max min
          mod multibyte-string-p mutexp natnump nlistp null number-or-marker-p
@@ -373,6 +373,8 @@ font-object
 (cl--define-built-in-type font-entity atom)
 (cl--define-built-in-type font-spec atom)
 (cl--define-built-in-type condvar atom)
+(cl--define-built-in-type channel atom)
+(cl--define-built-in-type async-future atom)
 (cl--define-built-in-type mutex atom)
 (cl--define-built-in-type thread atom)
 (cl--define-built-in-type terminal atom)
@@ -544,6 +544,7 @@ syntax-ppss-flush-cache
   (unless (syntax-propertize--in-process-p)
     (setq syntax-propertize--done (min beg syntax-propertize--done)))
   ;; Flush invalid cache entries.
+  (internal--syntax-ppss-flush beg)
   (dolist (cell (list syntax-ppss-wide syntax-ppss-narrow))
     (pcase cell
       (`(,last . ,cache)
@@ -615,6 +616,22 @@ syntax-ppss
   ;; Default values.
   (unless pos (setq pos (point)))
   (syntax-propertize pos)
+  (if (and (eq (point-min) 1) (not syntax-begin-function))
+      ;; In a widened buffer, the cache is kept in C.  It is flushed
+      ;; when the text changes, but not when the major mode changes,
+      ;; which resets `syntax-ppss-wide'.
+      (with-syntax-table (or syntax-ppss-table (syntax-table))
+        (unless syntax-ppss-wide
+          (setq syntax-ppss-wide (cons nil nil))
+          (internal--syntax-ppss-flush 1))
+        (setq syntax-ppss--updated-cache t)
+        (internal--syntax-ppss pos))
+    (syntax-ppss--narrowed pos)))
+
+(defun syntax-ppss--narrowed (pos)
+  "Return `syntax-ppss' at POS, using the caches kept in Lisp.
+This is used in narrowed buffers, and when `syntax-begin-function'
+is non-nil."
   ;;
   (with-syntax-table (or syntax-ppss-table (syntax-table))
     (let* ((cell (syntax-ppss--data))
@@ -5347,6 +5347,34 @@ combine-change-calls
   (declare (debug (form form def-body)) (indent 2))
   `(combine-change-calls-1 ,beg ,end (lambda () ,@body)))
 
+(defmacro with-coalesced-change-hooks (&rest body)
+  "Evaluate BODY, running the change hooks once for all its changes.
+
+This is meant for code making many small changes all over a buffer,
+such as replacing the matches of a regexp, or applying a diff, when
+the change hooks are costly.  Before the first change made by BODY,
+`before-change-functions' is invoked once for the accessible portion
+of the buffer; after BODY, `after-change-functions' is invoked once
+for the part of the buffer that BODY changed.  No undo boundary is
+arranged between the changes made by BODY, so they are undone
+together.  Unlike with `combine-change-calls', the region to be
+changed need not be known in advance, and the hooks of overlays and
+text properties are still run for each change.
+
+Only the hooks are coalesced: the changes themselves are not queued
+or merged, but made to the buffer right away, as usual.
+
+The change hooks are not run if `inhibit-modification-hooks' is
+non-nil.  BODY may make another buffer current, but its changes to
+other buffers are not combined, nor are the changes made by other
+threads meanwhile.  This does not nest: within BODY,
+`with-coalesced-change-hooks' just evaluates its own body.
+
+The result of `with-coalesced-change-hooks' is the value returned by
+the last of the BODY forms to be evaluated."
+  (declare (debug t) (indent 0))
+  `(internal--with-coalesced-change-hooks (lambda () ,@body)))
+
 (defun undo--wrap-and-run-primitive-undo (beg end list)
   "Call `primitive-undo' on the undo elements in LIST.
 
@@ -50,6 +50,18 @@ thread-handle-event
             (err (cddr event)))
         (message "Error %s: %S" thread err))))
 
+;;;###autoload
+(defun async-handle-event (event)
+  "Handle async events, raised when the job of a future finishes.
+An EVENT has the format
+  (async-event FUTURE CALLBACK)
+and calls CALLBACK with the result of FUTURE."
+  (interactive "e")
+  (if (and (consp event)
+           (eq (car event) 'async-event)
+           (= (length event) 3))
+      (funcall (nth 2 event) (async-wait (nth 1 event)))))
+
 ;;; The thread list buffer and list-threads command
 
 (defcustom thread-list-refresh-seconds 0.5
@@ -73,6 +73,10 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 # include <malloc.h>
 #endif
 
+#ifdef HAVE_MADVISE
+# include <sys/mman.h>
+#endif
+
 #if (defined ENABLE_CHECKING \
      && defined HAVE_VALGRIND_VALGRIND_H && !defined USE_VALGRIND)
 # define USE_VALGRIND 1
@@ -335,6 +339,75 @@ #define GC_DEFAULT_THRESHOLD (100000 * word_size)
 
 bool gc_in_progress;
 
+/* True if the conses and floats that survived the last GC are still
+   marked, as they are when gc_generational is set.  Minor collections
+   consider these old, and look inside them only if told to by
+   note_old_cons_store.  */
+
+bool gc_old_conses_marked;
+
+/* True while an incremental collection is marking; see
+   'mark_incrementally'.  */
+
+bool gc_marking_incrementally;
+
+/* Number of slices that Lisp allocation may still cause before the
+   current incremental collection must finish.  */
+
+static int gc_slices_left;
+
+/* Slices run each time Lisp allocates this fraction of the bytes that
+   start a collection.  */
+
+enum { GC_SLICES_PER_THRESHOLD = 8 };
+
+/* True while a minor collection marks and sweeps.  It frees no object
+   other than conses and floats, so it takes every other object to be
+   marked, and looks inside only those that mark_remembered_objects
+   tells it to.  */
+
+static bool gc_minor_marking;
+
+/* The object that mark_remembered_objects is looking inside.  */
+
+static void const *gc_minor_tracing;
+
+/* A set of objects, as an open addressing hash table of 2**BITS
+   slots.  nil marks empty slots, so it is never in a set.  */
+
+struct object_set
+{
+  Lisp_Object *slots;
+  int bits;
+  ptrdiff_t count;
+};
+
+/* The vectorlike objects allocated since the last collection, which
+   are often filled in without telling the collector.  Symbols need not
+   be recorded, as their slots are set only through functions that
+   do.  */
+
+static struct object_set young_objects;
+
+/* The old objects that note_old_object_store was told of since the
+   last collection.  */
+
+static struct object_set remembered_objects;
+
+/* The old objects whose contents change without telling the collector:
+   buffers, hash tables, windows and the like, strings with text
+   properties, and symbols with buffer-local values.  */
+
+static struct object_set traced_objects;
+
+/* True if memory ran out while adding to these sets, so that the next
+   collection must be a full one.  */
+
+static bool remembered_objects_lost;
+
+static void object_set_add (struct object_set *, Lisp_Object);
+static void note_surviving_object (Lisp_Object);
+
 /* System byte and object counts reported by GC.  */
 
 /* Assume byte counts fit in uintptr_t and object counts fit into
@@ -365,6 +438,18 @@ #define HI_THRESHOLD (EMACS_INT_MAX / 2)
   byte_ct total_hash_table_bytes;
 } gcstat;
 
+/* What Lisp had allocated when the last GC ended.  */
+
+static struct
+{
+  EMACS_INT symbols, strings, string_chars, intervals;
+  byte_ct vector_bytes;
+} consed_at_last_gc;
+
+/* Total size of the live objects found by the most-recent full GC.  */
+
+static byte_ct live_bytes_after_full_gc;
+
 /* Total size of ancillary arrays of all allocated hash-table and obarray
    objects, both dead and alive.  This number is always kept up-to-date.  */
 static ptrdiff_t hash_table_allocated_bytes = 0;
@@ -456,7 +541,7 @@ no_sanitize_memcpy (void *dest, void const *src, size_t size)
 static struct Lisp_Vector *allocate_clear_vector (ptrdiff_t, bool);
 static void unchain_finalizer (struct Lisp_Finalizer *);
 static void mark_terminals (void);
-static void gc_sweep (void);
+static void gc_sweep (bool);
 static Lisp_Object make_pure_vector (ptrdiff_t);
 static void mark_buffer (struct buffer *);
 
@@ -585,6 +670,19 @@ #define MEM_NIL &mem_z
 int staticidx;
 
 static void *pure_alloc (size_t, int);
+static bool minor_gc_p (void);
+
+/* What started a garbage collection.  */
+
+enum gc_trigger
+  {
+    GC_TRIGGER_EXPLICIT,	/* A call to 'garbage-collect'.  */
+    GC_TRIGGER_THRESHOLD,	/* Allocation beyond 'gc-cons-threshold'.  */
+    GC_TRIGGER_INCREMENTAL,	/* The end of incremental marking.  */
+    GC_TRIGGER_RELEASE_MEMORY	/* 'garbage-collect-release-memory'.  */
+  };
+
+static void garbage_collect_1 (bool, enum gc_trigger);
 
 /* Return PTR rounded up to the next multiple of ALIGNMENT.  */
 
@@ -1350,6 +1448,34 @@ lisp_align_free (void *block)
   MALLOC_UNBLOCK_INPUT;
 }
 
+/* Tell the system that the pages of the free ablocks are no longer
+   needed, so that it can reclaim them.  The pages are zero-filled when
+   they are next used.  Only the whole pages after the NEXT_FREE pointer
+   of each block are discarded.  */
+
+static void
+discard_free_ablocks (void)
+{
+#if defined HAVE_MADVISE && defined MADV_DONTNEED
+  uintptr_t page = getpagesize ();
+
+  MALLOC_BLOCK_INPUT;
+  for (struct ablock *b = free_ablock, *next; b; b = next)
+    {
+      ASAN_UNPOISON_ABLOCK (b);
+      next = b->x.next_free;
+      uintptr_t start = (uintptr_t) (&b->x.next_free + 1);
+      uintptr_t end = (uintptr_t) (b->x.payload + BLOCK_BYTES);
+      start = (start + page - 1) & -page;
+      end &= -page;
+      if (start < end)
+	(void) madvise ((void *) start, end - start, MADV_DONTNEED);
+      ASAN_POISON_ABLOCK (b);
+    }
+  MALLOC_UNBLOCK_INPUT;
+#endif
+}
+
 /* True if a malloc-returned pointer P is suitably aligned for SIZE,
    where Lisp object alignment may be needed if SIZE is a multiple of
    LISP_ALIGNMENT.  */
@@ -2127,6 +2253,8 @@ sweep_strings (void)
 
 		  /* Do not use string_(set|get)_intervals here.  */
 		  s->u.s.intervals = balance_intervals (s->u.s.intervals);
+		  if (gc_old_conses_marked)
+		    note_surviving_object (make_lisp_ptr (s, Lisp_String));
 
 		  gcstat.total_strings++;
 		  gcstat.total_string_bytes += STRING_BYTES (s);
@@ -2740,22 +2868,34 @@ #define XFLOAT_UNMARK(fptr) \
 
 static struct Lisp_Float *float_free_list;
 
-/* Return a new float object with value FLOAT_VALUE.  */
+static void sweep_some_floats (bool);
 
-Lisp_Object
-make_float (double float_value)
-{
-  register Lisp_Object val;
+/* Allocation buffers.
 
-  MALLOC_BLOCK_INPUT;
+   Each thread allocates conses and floats from its own free list, its
+   allocation buffer, which it refills when empty by taking up to a
+   block's worth of objects from the shared free list, so that one
+   thread cannot take all the objects freed by a collection.  If the
+   shared list is empty, it takes the free objects of a block swept
+   lazily, or the rest of the current block.
+   Only refilling touches the shared lists and blocks, which is what
+   would need a lock if Lisp threads ran in parallel.  Collections
+   empty the buffers of all threads, since the sweep rebuilds the
+   shared free lists from every object not in use.
 
-  if (float_free_list)
-    {
-      XSETFLOAT (val, float_free_list);
-      ASAN_UNPOISON_FLOAT (float_free_list);
-      float_free_list = float_free_list->u.chain;
-    }
-  else
+   A buffer is a chain of free objects, not a chunk of memory that the
+   thread bumps a pointer through: the objects come from wherever the
+   sweep found them.  Strings and vectors have no such buffers, and
+   are allocated from the shared free lists and blocks as before.  */
+
+/* Refill the current thread's float buffer, and return it.  */
+
+static struct Lisp_Float *
+refill_float_buffer (void)
+{
+  if (!float_free_list)
+    sweep_some_floats (false);
+  if (!float_free_list)
     {
       if (float_block_index == FLOAT_BLOCK_SIZE)
 	{
@@ -2767,10 +2907,48 @@ make_float (double float_value)
 	  float_block = new;
 	  float_block_index = 0;
 	}
-      ASAN_UNPOISON_FLOAT (&float_block->floats[float_block_index]);
-      XSETFLOAT (val, &float_block->floats[float_block_index]);
-      float_block_index++;
+      for (int i = FLOAT_BLOCK_SIZE - 1; float_block_index <= i; i--)
+	{
+	  struct Lisp_Float *f = &float_block->floats[i];
+	  ASAN_UNPOISON_FLOAT (f);
+	  f->u.chain = float_free_list;
+	  ASAN_POISON_FLOAT (f);
+	  float_free_list = f;
+	}
+      float_block_index = FLOAT_BLOCK_SIZE;
+    }
+
+  struct Lisp_Float *last = float_free_list;
+  ASAN_UNPOISON_FLOAT (last);
+  for (int i = 1; i < FLOAT_BLOCK_SIZE && last->u.chain; i++)
+    {
+      struct Lisp_Float *next = last->u.chain;
+      ASAN_POISON_FLOAT (last);
+      last = next;
+      ASAN_UNPOISON_FLOAT (last);
     }
+  current_thread->float_buffer = float_free_list;
+  float_free_list = last->u.chain;
+  last->u.chain = NULL;
+  ASAN_POISON_FLOAT (last);
+  return current_thread->float_buffer;
+}
+
+/* Return a new float object with value FLOAT_VALUE.  */
+
+Lisp_Object
+make_float (double float_value)
+{
+  register Lisp_Object val;
+
+  MALLOC_BLOCK_INPUT;
+
+  struct Lisp_Float *f = current_thread->float_buffer;
+  if (!f)
+    f = refill_float_buffer ();
+  ASAN_UNPOISON_FLOAT (f);
+  current_thread->float_buffer = f->u.chain;
+  XSETFLOAT (val, f);
 
   MALLOC_UNBLOCK_INPUT;
 
@@ -2794,6 +2972,8 @@ make_float (double float_value)
 
 #define CONS_BLOCK_SIZE						\
   (((BLOCK_BYTES - sizeof (struct cons_block *)			\
+     /* The DIRTY and SWEPT flags, with padding.  */				\
+     - sizeof (bits_word)					\
      /* The compiler might add padding at the end.  */		\
      - (sizeof (struct Lisp_Cons) - sizeof (bits_word))) * CHAR_BIT)	\
    / (sizeof (struct Lisp_Cons) * CHAR_BIT + 1))
@@ -2811,7 +2991,13 @@ #define CONS_INDEX(fptr) \
   struct Lisp_Cons conses[CONS_BLOCK_SIZE];
   bits_word gcmarkbits[1 + CONS_BLOCK_SIZE / BITS_PER_BITS_WORD];
   struct cons_block *next;
+  /* True if an old cons in this block may point to a younger cons or
+     float.  */
+  bool dirty;
+  /* False if the last collection left this block to sweep lazily.  */
+  bool swept;
 };
+static_assert (sizeof (struct cons_block) <= BLOCK_BYTES);
 
 #define XCONS_MARKED_P(fptr) \
   GETMARKBIT (CONS_BLOCK (fptr), CONS_INDEX (fptr))
@@ -2852,49 +3038,247 @@ #define XUNMARK_CONS(fptr) \
 # define ASAN_UNPOISON_CONS(p) ((void) 0)
 #endif
 
+static void sweep_some_conses (bool);
+
+/* Refill the current thread's cons buffer, and return it.  Conses in
+   buffers are free, so their car is dead_object, as live_cons_holding
+   expects.  */
+
+static struct Lisp_Cons *
+refill_cons_buffer (void)
+{
+  if (!cons_free_list)
+    sweep_some_conses (false);
+  if (!cons_free_list)
+    {
+      if (cons_block_index == CONS_BLOCK_SIZE)
+	{
+	  struct cons_block *new
+	    = lisp_align_malloc (sizeof *new, MEM_TYPE_CONS);
+	  memset (new->gcmarkbits, 0, sizeof new->gcmarkbits);
+	  new->dirty = false;
+	  new->swept = true;
+	  ASAN_POISON_CONS_BLOCK (new);
+	  new->next = cons_block;
+	  cons_block = new;
+	  cons_block_index = 0;
+	}
+      for (int i = CONS_BLOCK_SIZE - 1; cons_block_index <= i; i--)
+	{
+	  struct Lisp_Cons *c = &cons_block->conses[i];
+	  ASAN_UNPOISON_CONS (c);
+	  c->u.s.u.chain = cons_free_list;
+	  c->u.s.car = dead_object ();
+	  ASAN_POISON_CONS (c);
+	  cons_free_list = c;
+	}
+      cons_block_index = CONS_BLOCK_SIZE;
+    }
+
+  struct Lisp_Cons *last = cons_free_list;
+  ASAN_UNPOISON_CONS (last);
+  for (int i = 1; i < CONS_BLOCK_SIZE && last->u.s.u.chain; i++)
+    {
+      struct Lisp_Cons *next = last->u.s.u.chain;
+      ASAN_POISON_CONS (last);
+      last = next;
+      ASAN_UNPOISON_CONS (last);
+    }
+  current_thread->cons_buffer = cons_free_list;
+  cons_free_list = last->u.s.u.chain;
+  last->u.s.u.chain = NULL;
+  ASAN_POISON_CONS (last);
+  return current_thread->cons_buffer;
+}
+
 /* Explicitly free a cons cell by putting it on the free-list.  */
 
 void
 free_cons (struct Lisp_Cons *ptr)
 {
-  ptr->u.s.u.chain = cons_free_list;
+  /* An incremental collection may still look at PTR, and a lazy sweep
+     would free it again.  */
+  if (gc_marking_incrementally || !CONS_BLOCK (ptr)->swept)
+    return;
+  /* PTR may have survived a GC, and stayed marked since.  */
+  XUNMARK_CONS (ptr);
+  ptr->u.s.u.chain = current_thread->cons_buffer;
   ptr->u.s.car = dead_object ();
-  cons_free_list = ptr;
+  current_thread->cons_buffer = ptr;
   ptrdiff_t nbytes = sizeof *ptr;
   tally_consing (-nbytes);
   ASAN_POISON_CONS (ptr);
 }
 
-DEFUN ("cons", Fcons, Scons, 2, 2, 0,
-       doc: /* Create a new cons, give it CAR and CDR as components, and return it.  */)
-  (Lisp_Object car, Lisp_Object cdr)
+/* Record that the cons cell C, which may have survived a GC or been
+   marked by an incremental collection, is about to be made to point to
+   an object that may not be marked.  The next collection then looks
+   again inside the marked conses of C's block.  Conses on the stack
+   and in pure space are never marked between collections, so they
+   need not be recorded.  Nor are those in the dump, which minor
+   collections take to be old; C is recorded as an object to look
+   inside if it is one of them.  */
+
+void
+note_old_cons_store (struct Lisp_Cons *c)
 {
-  register Lisp_Object val;
+  char stack_top_variable;
+  char const *p = (char const *) c;
 
-  MALLOC_BLOCK_INPUT;
+  if (pdumper_object_p (c))
+    {
+      if (gc_old_conses_marked)
+	note_old_object_store (make_lisp_ptr (c, Lisp_Cons));
+      return;
+    }
+  if (PURE_P (c)
+      || (&stack_top_variable < stack_bottom
+	  ? &stack_top_variable < p && p < stack_bottom
+	  : stack_bottom <= p && p < &stack_top_variable))
+    return;
+  if (XCONS_MARKED_P (c))
+    CONS_BLOCK (c)->dirty = true;
+}
+
+NO_INLINE static bool
+grow_object_set (struct object_set *set)
+{
+  Lisp_Object *old = set->slots;
+  ptrdiff_t old_size = old ? (ptrdiff_t) 1 << set->bits : 0;
+  int bits = old ? set->bits + 1 : 10;
+  static_assert (NIL_IS_ZERO);
+  Lisp_Object *slots = calloc ((size_t) 1 << bits, sizeof *slots);
+  if (!slots)
+    return false;
+  set->slots = slots;
+  set->bits = bits;
+  set->count = 0;
+  for (ptrdiff_t i = 0; i < old_size; i++)
+    if (!NILP (old[i]))
+      object_set_add (set, old[i]);
+  free (old);
+  return true;
+}
+
+/* Add OBJ, which is not nil, to SET.  This may run in the middle of a
+   store or a sweep, so it does not signal if memory runs out, but
+   makes the next collection a full one.  */
 
-  if (cons_free_list)
+static void
+object_set_add (struct object_set *set, Lisp_Object obj)
+{
+  if ((!set->slots || set->count >= (ptrdiff_t) 1 << (set->bits - 1))
+      && !grow_object_set (set))
     {
-      ASAN_UNPOISON_CONS (cons_free_list);
-      XSETCONS (val, cons_free_list);
-      cons_free_list = cons_free_list->u.s.u.chain;
+      remembered_objects_lost = true;
+      return;
     }
-  else
+  ptrdiff_t mask = ((ptrdiff_t) 1 << set->bits) - 1;
+  ptrdiff_t i = knuth_hash (reduce_emacs_uint_to_hash_hash (XLI (obj)),
+			    set->bits);
+  for (; !NILP (set->slots[i]); i = (i + 1) & mask)
+    if (BASE_EQ (set->slots[i], obj))
+      return;
+  set->slots[i] = obj;
+  set->count++;
+}
+
+static void
+object_set_clear (struct object_set *set)
+{
+  free (set->slots);
+  set->slots = NULL;
+  set->count = 0;
+}
+
+/* Return true if all stores into OBJ that may make it point to a cons
+   or a float tell note_old_object_store, so that a minor collection
+   need not look inside OBJ if it is old and was not stored into.  */
+
+static bool
+barriered_object_p (Lisp_Object obj)
+{
+  switch (XTYPE (obj))
     {
-      if (cons_block_index == CONS_BLOCK_SIZE)
+    case Lisp_Symbol:
+      return XBARE_SYMBOL (obj)->u.s.redirect != SYMBOL_LOCALIZED;
+
+    case Lisp_String:
+      return !XSTRING (obj)->u.s.intervals;
+
+    case Lisp_Vectorlike:
+      switch (PSEUDOVECTOR_TYPE (XVECTOR (obj)))
 	{
-	  struct cons_block *new
-	    = lisp_align_malloc (sizeof *new, MEM_TYPE_CONS);
-	  memset (new->gcmarkbits, 0, sizeof new->gcmarkbits);
-	  ASAN_POISON_CONS_BLOCK (new);
-	  new->next = cons_block;
-	  cons_block = new;
-	  cons_block_index = 0;
+	case PVEC_NORMAL_VECTOR:
+	case PVEC_RECORD:
+	case PVEC_CLOSURE:
+	case PVEC_CHAR_TABLE:
+	case PVEC_SUB_CHAR_TABLE:
+	case PVEC_OBARRAY:
+	  return true;
+
+	  /* These hold no Lisp object that the collector looks at.  */
+	case PVEC_BOOL_VECTOR:
+	case PVEC_BIGNUM:
+	case PVEC_MARKER:
+	  return true;
+
+	default:
+	  return false;
 	}
-      ASAN_UNPOISON_CONS (&cons_block->conses[cons_block_index]);
-      XSETCONS (val, &cons_block->conses[cons_block_index]);
-      cons_block_index++;
+
+    default:
+      return true;
     }
+}
+
+/* Record that OBJ, which survived a collection, is old to the next
+   one.  */
+
+static void
+note_surviving_object (Lisp_Object obj)
+{
+  if (!barriered_object_p (obj))
+    object_set_add (&traced_objects, obj);
+}
+
+/* Record that the old vector, record, char-table or symbol OBJ, or the
+   cons OBJ in the dump, may now point to a cons or a float that the
+   next minor collection cannot tell is live otherwise.  */
+
+void
+note_old_object_store (Lisp_Object obj)
+{
+  /* The objects that are not barriered are looked inside anyway, and
+     must not be looked inside twice.  */
+  if (!NILP (obj) && barriered_object_p (obj))
+    object_set_add (&remembered_objects, obj);
+}
+
+/* Record that minor collections must look inside OBJ until the next
+   full one, as OBJ now has contents that change without telling the
+   collector.  */
+
+void
+note_traced_object (Lisp_Object obj)
+{
+  object_set_add (&traced_objects, obj);
+}
+
+DEFUN ("cons", Fcons, Scons, 2, 2, 0,
+       doc: /* Create a new cons, give it CAR and CDR as components, and return it.  */)
+  (Lisp_Object car, Lisp_Object cdr)
+{
+  register Lisp_Object val;
+
+  MALLOC_BLOCK_INPUT;
+
+  struct Lisp_Cons *c = current_thread->cons_buffer;
+  if (!c)
+    c = refill_cons_buffer ();
+  ASAN_UNPOISON_CONS (c);
+  current_thread->cons_buffer = c->u.s.u.chain;
+  XSETCONS (val, c);
 
   MALLOC_UNBLOCK_INPUT;
 
@@ -3397,6 +3781,9 @@ cleanup_vector (struct Lisp_Vector *vector)
     case PVEC_CONDVAR:
       finalize_one_condvar (PSEUDOVEC_STRUCT (vector, Lisp_CondVar));
       break;
+    case PVEC_CHANNEL:
+      finalize_one_channel (PSEUDOVEC_STRUCT (vector, Lisp_Channel));
+      break;
     case PVEC_MARKER:
       /* sweep_buffer should already have unchained this from its buffer.  */
       eassert (! PSEUDOVEC_STRUCT (vector, Lisp_Marker)->buffer);
@@ -3492,6 +3879,7 @@ cleanup_vector (struct Lisp_Vector *vector)
     case PVEC_XWIDGET_VIEW:
     case PVEC_TS_NODE:
     case PVEC_SQLITE:
+    case PVEC_ASYNC_FUTURE:
     case PVEC_CLOSURE:
     case PVEC_CHAR_TABLE:
     case PVEC_SUB_CHAR_TABLE:
@@ -3528,6 +3916,9 @@ sweep_vectors (void)
 	  if (XVECTOR_MARKED_P (vector))
 	    {
 	      XUNMARK_VECTOR (vector);
+	      if (gc_old_conses_marked)
+		note_surviving_object (make_lisp_ptr (vector,
+						      Lisp_Vectorlike));
 	      gcstat.total_vectors++;
 	      ptrdiff_t nbytes = vector_nbytes (vector);
 	      gcstat.total_vector_slots += nbytes / word_size;
@@ -3585,6 +3976,8 @@ sweep_vectors (void)
       if (XVECTOR_MARKED_P (vector))
 	{
 	  XUNMARK_VECTOR (vector);
+	  if (gc_old_conses_marked)
+	    note_surviving_object (make_lisp_ptr (vector, Lisp_Vectorlike));
 	  gcstat.total_vectors++;
 	  gcstat.total_vector_slots
 	    += (vector->header.size & PSEUDOVECTOR_FLAG
@@ -3611,6 +4004,10 @@ #define VECTOR_ELTS_MAX \
 	 / word_size), \
 	MOST_POSITIVE_FIXNUM))
 
+/* Number of bytes of vectors allocated so far, for the GC log.  */
+
+static byte_ct vector_bytes_consed;
+
 /* Value is a pointer to a newly allocated Lisp_Vector structure
    with room for LEN Lisp_Objects.  LEN must be positive and
    at most VECTOR_ELTS_MAX.  */
@@ -3622,6 +4019,11 @@ allocate_vectorlike (ptrdiff_t len, bool clearit)
   ptrdiff_t nbytes = header_size + len * word_size;
   struct Lisp_Vector *p;
 
+  /* Minor collections look inside every vector allocated since the
+     last collection, including any that a nonlocal exit left before it
+     was filled in.  */
+  clearit |= gc_generational;
+
   MALLOC_BLOCK_INPUT;
 
 #ifdef DOUG_LEA_MALLOC
@@ -3651,6 +4053,9 @@ allocate_vectorlike (ptrdiff_t len, bool clearit)
 
   tally_consing (nbytes);
   vector_cells_consed += len;
+  vector_bytes_consed += nbytes;
+  if (gc_old_conses_marked)
+    object_set_add (&young_objects, make_lisp_ptr (p, Lisp_Vectorlike));
 
   MALLOC_UNBLOCK_INPUT;
 
@@ -4052,6 +4457,10 @@ DEFUN ("make-marker", Fmake_marker, Smake_marker, 0, 0, 0,
   p->bytepos = 0;
   p->charpos = 0;
   p->next = NULL;
+  p->parent = p->left = p->right = NULL;
+  p->char_offset = p->byte_offset = 0;
+  p->otick = 0;
+  p->red = false;
   p->insertion_type = 0;
   p->need_adjustment = 0;
   return make_lisp_ptr (p, Lisp_Vectorlike);
@@ -4078,6 +4487,7 @@ build_marker (struct buffer *buf, ptrdiff_t charpos, ptrdiff_t bytepos)
   m->need_adjustment = 0;
   m->next = BUF_MARKERS (buf);
   BUF_MARKERS (buf) = m;
+  marker_tree_insert (m);
   return make_lisp_ptr (m, Lisp_Vectorlike);
 }
 
@@ -4265,11 +4675,15 @@ DEFUN ("make-finalizer", Fmake_finalizer, Smake_finalizer, 1, 1, 0,
    allocation of various types, you should not directly test or set GC
    mark bits on objects.  Some objects might live in special memory
    regions (e.g., a dump image) and might store their mark bits
-   elsewhere.  */
+   elsewhere.  A minor collection takes every object other than the
+   conses and floats outside the dump to be marked; see
+   gc_minor_marking.  */
 
 static bool
 vector_marked_p (const struct Lisp_Vector *v)
 {
+  if (gc_minor_marking)
+    return v != gc_minor_tracing;
   if (pdumper_object_p (v))
     {
       /* Look at cold_start first so that we don't have to fault in
@@ -4287,7 +4701,9 @@ vector_marked_p (const struct Lisp_Vector *v)
 static void
 set_vector_marked (struct Lisp_Vector *v)
 {
-  if (pdumper_object_p (v))
+  if (gc_minor_marking)
+    gc_minor_tracing = NULL;
+  else if (pdumper_object_p (v))
     {
       eassert (PSEUDOVECTOR_TYPE (v) != PVEC_BOOL_VECTOR);
       pdumper_set_marked (v);
@@ -4312,7 +4728,7 @@ set_vectorlike_marked (union vectorlike_header *header)
 cons_marked_p (const struct Lisp_Cons *c)
 {
   return pdumper_object_p (c)
-    ? pdumper_marked_p (c)
+    ? gc_minor_marking || pdumper_marked_p (c)
     : XCONS_MARKED_P (c);
 }
 
@@ -4328,6 +4744,8 @@ set_cons_marked (struct Lisp_Cons *c)
 static bool
 string_marked_p (const struct Lisp_String *s)
 {
+  if (gc_minor_marking)
+    return s != gc_minor_tracing;
   return pdumper_object_p (s)
     ? pdumper_marked_p (s)
     : XSTRING_MARKED_P (s);
@@ -4336,7 +4754,9 @@ string_marked_p (const struct Lisp_String *s)
 static void
 set_string_marked (struct Lisp_String *s)
 {
-  if (pdumper_object_p (s))
+  if (gc_minor_marking)
+    gc_minor_tracing = NULL;
+  else if (pdumper_object_p (s))
     pdumper_set_marked (s);
   else
     XMARK_STRING (s);
@@ -4345,6 +4765,8 @@ set_string_marked (struct Lisp_String *s)
 static bool
 symbol_marked_p (const struct Lisp_Symbol *s)
 {
+  if (gc_minor_marking)
+    return s != gc_minor_tracing;
   return pdumper_object_p (s)
     ? pdumper_marked_p (s)
     : s->u.s.gcmarkbit;
@@ -4353,15 +4775,22 @@ symbol_marked_p (const struct Lisp_Symbol *s)
 static void
 set_symbol_marked (struct Lisp_Symbol *s)
 {
-  if (pdumper_object_p (s))
+  if (gc_minor_marking)
+    gc_minor_tracing = NULL;
+  else if (pdumper_object_p (s))
     pdumper_set_marked (s);
   else
     s->u.s.gcmarkbit = true;
 }
 
+/* Interval trees are not shared, so a minor collection, which must not
+   leave mark bits behind, walks them without marking.  */
+
 static bool
 interval_marked_p (INTERVAL i)
 {
+  if (gc_minor_marking)
+    return false;
   return pdumper_object_p (i)
     ? pdumper_marked_p (i)
     : i->gcmarkbit;
@@ -4370,6 +4799,8 @@ interval_marked_p (INTERVAL i)
 static void
 set_interval_marked (INTERVAL i)
 {
+  if (gc_minor_marking)
+    return;
   if (pdumper_object_p (i))
     pdumper_set_marked (i);
   else
@@ -6345,6 +6776,91 @@ mark_pinned_symbols (void)
     }
 }
 
+/* Mark what the marked conses in dirty cons blocks point to.  */
+
+static void
+mark_dirty_conses (void)
+{
+  int lim = cons_block_index;
+  for (struct cons_block *cblk = cons_block; cblk; cblk = cblk->next)
+    {
+      if (cblk->dirty)
+	for (int i = 0; i < lim; i++)
+	  if (XCONS_MARKED_P (&cblk->conses[i]))
+	    {
+	      mark_object (cblk->conses[i].u.s.car);
+	      mark_object (cblk->conses[i].u.s.u.cdr);
+	    }
+      lim = CONS_BLOCK_SIZE;
+    }
+}
+
+/* Mark what OBJ points to, although a minor collection takes OBJ
+   itself to be marked.  */
+
+static void
+mark_inside (Lisp_Object obj)
+{
+  if (CONSP (obj))
+    {
+      mark_object (XCAR (obj));
+      mark_object (XCDR (obj));
+    }
+  else
+    {
+      gc_minor_tracing = XPNTR (obj);
+      mark_object (obj);
+      gc_minor_tracing = NULL;
+    }
+}
+
+static void
+mark_inside_object_set (struct object_set const *set)
+{
+  if (set->slots)
+    for (ptrdiff_t i = 0; i < (ptrdiff_t) 1 << set->bits; i++)
+      if (!NILP (set->slots[i]))
+	mark_inside (set->slots[i]);
+}
+
+/* Mark what a minor collection must keep besides what is reachable
+   from the roots.  Minor collections free only conses and floats, and
+   take what an old object points to to be old, so this is what the
+   objects allocated since the last collection, the old objects stored
+   into since then, the objects whose contents change without telling
+   the collector, and the old conses in dirty cons blocks point to.  */
+
+static void
+mark_remembered_objects (void)
+{
+  /* nil cannot be in an object set, and threads are not all in the
+     heap.  */
+  mark_inside (Qnil);
+  for (struct thread_state *t = all_threads; t; t = t->next_thread)
+    mark_inside (make_lisp_ptr (t, Lisp_Vectorlike));
+
+  mark_inside_object_set (&young_objects);
+  mark_inside_object_set (&remembered_objects);
+  mark_inside_object_set (&traced_objects);
+  mark_dirty_conses ();
+}
+
+/* Clear the mark bits that conses and floats kept since the last GC,
+   so that a full collection can tell which of them are still live.  */
+
+static void
+unmark_old_generation (void)
+{
+  for (struct cons_block *cblk = cons_block; cblk; cblk = cblk->next)
+    {
+      memset (cblk->gcmarkbits, 0, sizeof cblk->gcmarkbits);
+      cblk->dirty = false;
+    }
+  for (struct float_block *fblk = float_block; fblk; fblk = fblk->next)
+    memset (fblk->gcmarkbits, 0, sizeof fblk->gcmarkbits);
+  gc_old_conses_marked = false;
+}
+
 static void
 visit_vectorlike_root (struct gc_root_visitor visitor,
                        struct Lisp_Vector *ptr,
@@ -6515,43 +7031,307 @@ watch_gc_cons_percentage (Lisp_Object symbol, Lisp_Object newval,
 maybe_garbage_collect (void)
 {
   if (bump_consing_until_gc (gc_cons_threshold, Vgc_cons_percentage) < 0)
-    garbage_collect ();
+    {
+      bool minor = minor_gc_p ();
+      if (minor || !gc_incremental)
+	garbage_collect_1 (minor, GC_TRIGGER_THRESHOLD);
+      /* Finish an incremental collection once Lisp has allocated as
+	 much since it started as would normally start a collection, so
+	 that the heap does not grow without bound.  */
+      else if (gc_marking_incrementally && --gc_slices_left <= 0)
+	garbage_collect_1 (false, GC_TRIGGER_THRESHOLD);
+      else
+	{
+	  mark_incrementally ();
+	  if (gc_marking_incrementally)
+	    consing_until_gc = gc_threshold / GC_SLICES_PER_THRESHOLD;
+	}
+    }
 }
 
-static inline bool mark_stack_empty_p (void);
+/* Return true if the next automatic GC can be a minor one.  */
 
-/* Subroutine of Fgarbage_collect that does most of the work.  */
-void
-garbage_collect (void)
+static bool
+minor_gc_p (void)
 {
-  Lisp_Object tail, buffer;
-  char stack_top_variable;
-  bool message_p;
-  specpdl_ref count = SPECPDL_INDEX ();
-  struct timespec start;
+  if (! (gc_generational && gc_old_conses_marked)
+      || remembered_objects_lost)
+    return false;
 
-  eassert (weak_hash_tables == NULL);
-
-  if (garbage_collection_inhibited)
-    return;
+  /* Minor collections free only conses and floats, so do a full one
+     once the heap has grown by half since the last full one.  */
+  byte_ct live = total_bytes_of_live_objects ();
+  byte_ct growth = max (0, gc_cons_threshold);
+  growth = max (growth, live_bytes_after_full_gc / 2);
+  return (live <= live_bytes_after_full_gc
+	  || live - live_bytes_after_full_gc <= growth);
+}
 
-  eassert(mark_stack_empty_p ());
+/* True while 'garbage-collect-release-memory' collects.  The sweep
+   then frees every block that holds no object, and does not sweep
+   lazily.  Objects are never moved, so sparse blocks stay.  */
 
-  /* Record this function, so it appears on the profiler's backtraces.  */
-  record_in_backtrace (QAutomatic_GC, 0, 0);
+static bool gc_releasing_memory;
 
-  /* Don't keep undo information around forever.
-     Do this early on, so it is no problem if the user quits.  */
-  FOR_EACH_LIVE_BUFFER (tail, buffer)
-    compact_buffer (XBUFFER (buffer));
+static inline bool mark_stack_empty_p (void);
+static Lisp_Object gc_statistics (void);
+static void finish_lazy_sweep (void);
+static void finish_incremental_marking (void);
+static void check_incremental_marking (void);
+/* Whether full collections can mark in several threads.  */
+#if defined THREADS_ENABLED && defined __ATOMIC_RELAXED
+# define PARALLEL_MARKING
+static void mark_in_parallel (void);
+#else
+# define mark_in_parallel() ((void) 0)
+#endif
 
-  byte_ct tot_before = (profiler_memory_running
-			? total_bytes_of_live_objects ()
-			: (byte_ct) -1);
+/* Add ELAPSED to *TOTAL, and set *VAR to it in seconds, unless *VAR
+   is not a float.  */
+static void
+accumulate_elapsed (Lisp_Object *var, struct timespec *total,
+		    struct timespec elapsed)
+{
+  if (FLOATP (*var))
+    {
+      *total = timespec_add (*total, elapsed);
+      *var = make_float (timespectod (*total));
+    }
+}
 
-  start = current_timespec ();
+/* The times accumulated in 'gc-elapsed', 'gc-mark-elapsed' and
+   'gc-sweep-elapsed'.  */
+static struct timespec gc_elapsed, gc_mark_elapsed, gc_sweep_elapsed;
 
-  /* In case user calls debug_print during GC,
+/* Add the time since START to 'gc-elapsed'.  */
+static void
+accumulate_gc_elapsed (struct timespec start)
+{
+  accumulate_elapsed (&Vgc_elapsed, &gc_elapsed,
+		      timespec_sub (current_timespec (), start));
+}
+
+/* The GC log.
+
+   A ring of the last GC_LOG_SIZE collections, which 'gc-log-entry'
+   reads.  Recording a collection allocates no Lisp data, and neither
+   does reading it into an existing vector, so that Lisp code can watch
+   collections without causing more of them.  */
+
+enum { GC_LOG_SIZE = 256 };
+
+/* The kinds of objects whose freed bytes are logged.  */
+
+enum gc_log_type
+  {
+    GC_LOG_CONSES, GC_LOG_FLOATS, GC_LOG_VECTORS, GC_LOG_STRINGS,
+    GC_LOG_SYMBOLS, GC_LOG_INTERVALS, GC_LOG_TYPES
+  };
+
+struct gc_log_entry
+{
+  /* The value of 'gcs-done' after the collection.  */
+  EMACS_INT number;
+  enum gc_trigger trigger;
+  bool minor;
+  /* When the collection started, and how long it marked, swept and ran
+     finalizers.  */
+  struct timespec start, mark, sweep, finalize;
+  /* The bytes of live objects after the collection.  */
+  byte_ct heap;
+  /* The bytes freed, per type.  */
+  byte_ct freed[GC_LOG_TYPES];
+};
+
+static struct gc_log_entry gc_log[GC_LOG_SIZE];
+
+/* Number of collections logged so far.  */
+
+static EMACS_INT gc_log_count;
+
+/* The bytes of live objects per type after the previous collection,
+   and the bytes allocated per type before it.  */
+
+static byte_ct gc_log_live[GC_LOG_TYPES], gc_log_consed[GC_LOG_TYPES];
+
+/* Store in LIVE the bytes of live objects per type according to the
+   last sweep, and in CONSED the bytes allocated per type so far.  */
+
+static void
+gc_log_bytes (byte_ct live[GC_LOG_TYPES], byte_ct consed[GC_LOG_TYPES])
+{
+  live[GC_LOG_CONSES] = object_bytes (gcstat.total_conses,
+				      sizeof (struct Lisp_Cons));
+  live[GC_LOG_FLOATS] = object_bytes (gcstat.total_floats,
+				      sizeof (struct Lisp_Float));
+  live[GC_LOG_VECTORS] = object_bytes (gcstat.total_vector_slots, word_size);
+  live[GC_LOG_STRINGS] = (object_bytes (gcstat.total_strings,
+					sizeof (struct Lisp_String))
+			  + gcstat.total_string_bytes);
+  live[GC_LOG_SYMBOLS] = object_bytes (gcstat.total_symbols,
+				       sizeof (struct Lisp_Symbol));
+  live[GC_LOG_INTERVALS] = object_bytes (gcstat.total_intervals,
+					 sizeof (struct interval));
+
+  consed[GC_LOG_CONSES] = object_bytes (cons_cells_consed,
+					sizeof (struct Lisp_Cons));
+  consed[GC_LOG_FLOATS] = object_bytes (floats_consed,
+					sizeof (struct Lisp_Float));
+  consed[GC_LOG_VECTORS] = vector_bytes_consed;
+  consed[GC_LOG_STRINGS] = (object_bytes (strings_consed,
+					  sizeof (struct Lisp_String))
+			    + object_bytes (string_chars_consed, 1));
+  consed[GC_LOG_SYMBOLS] = object_bytes (symbols_consed,
+					 sizeof (struct Lisp_Symbol));
+  consed[GC_LOG_INTERVALS] = object_bytes (intervals_consed,
+					   sizeof (struct interval));
+}
+
+/* Log the collection that just ended.  The bytes it freed of a type
+   are those live after the previous collection or allocated since,
+   and no longer live.  */
+
+static void
+log_gc (enum gc_trigger trigger, bool minor, struct timespec start,
+	struct timespec mark, struct timespec sweep,
+	struct timespec finalize)
+{
+  struct gc_log_entry *e = &gc_log[gc_log_count++ % GC_LOG_SIZE];
+  byte_ct live[GC_LOG_TYPES], consed[GC_LOG_TYPES];
+
+  gc_log_bytes (live, consed);
+  e->number = gcs_done;
+  e->trigger = trigger;
+  e->minor = minor;
+  e->start = start;
+  e->mark = mark;
+  e->sweep = sweep;
+  e->finalize = finalize;
+  e->heap = total_bytes_of_live_objects ();
+  for (int i = 0; i < GC_LOG_TYPES; i++)
+    {
+      byte_ct before = gc_log_live[i] + (consed[i] - gc_log_consed[i]);
+      e->freed[i] = before > live[i] ? before - live[i] : 0;
+      gc_log_live[i] = live[i];
+      gc_log_consed[i] = consed[i];
+    }
+}
+
+/* Return the integer number of microseconds in T.  */
+
+static Lisp_Object
+timespec_to_usec (struct timespec t)
+{
+  return make_int (t.tv_sec * (intmax_t) 1000000 + t.tv_nsec / 1000);
+}
+
+DEFUN ("gc-log-entry", Fgc_log_entry, Sgc_log_entry, 1, 2, 0,
+       doc: /* Return information about the Nth most recent garbage collection.
+N is 0 for the last collection, 1 for the one before, and so on.  Only
+the last 256 collections are recorded; return nil if N is not among
+them.
+
+The value is a vector [NUMBER START TRIGGER MINOR MARK SWEEP FINALIZE
+HEAP CONSES FLOATS VECTORS STRINGS SYMBOLS INTERVALS], where:
+- NUMBER is the value of `gcs-done' after the collection.
+- START is when it started, in microseconds since the epoch.
+- TRIGGER is what started it: `threshold' for allocation beyond
+  `gc-cons-threshold', `explicit' for a call to `garbage-collect' or
+  `garbage-collect-maybe', `incremental' for the end of the slices of
+  an incremental collection, or `release-memory' for
+  `garbage-collect-release-memory'.
+- MINOR is non-nil if the collection was minor; see `gc-generational'.
+- MARK, SWEEP and FINALIZE are the microseconds spent marking the
+  objects in use, freeing the others, and running finalizers.  MARK
+  does not include the slices of incremental collections.
+- HEAP is the number of bytes of live objects after the collection.
+- CONSES, FLOATS, VECTORS, STRINGS, SYMBOLS and INTERVALS are the
+  numbers of bytes of objects of these types that were freed.
+
+If VECTOR is non-nil, it should be a vector of at least 14 elements;
+store the information in it and return it instead of a new vector.
+This does not allocate memory on 64-bit platforms, so functions in
+`post-gc-hook' can use it without causing more garbage collections.  */)
+  (Lisp_Object n, Lisp_Object vector)
+{
+  CHECK_FIXNAT (n);
+  if (! (XFIXNAT (n) < min (gc_log_count, GC_LOG_SIZE)))
+    return Qnil;
+  enum { GC_LOG_FIELDS = 8 + GC_LOG_TYPES };
+  if (NILP (vector))
+    vector = make_nil_vector (GC_LOG_FIELDS);
+  else
+    {
+      CHECK_VECTOR (vector);
+      if (ASIZE (vector) < GC_LOG_FIELDS)
+	args_out_of_range (vector, make_fixnum (GC_LOG_FIELDS));
+    }
+
+  struct gc_log_entry *e
+    = &gc_log[(gc_log_count - 1 - XFIXNAT (n)) % GC_LOG_SIZE];
+  Lisp_Object trigger;
+  switch (e->trigger)
+    {
+    case GC_TRIGGER_EXPLICIT: trigger = Qexplicit; break;
+    case GC_TRIGGER_THRESHOLD: trigger = Qthreshold; break;
+    case GC_TRIGGER_INCREMENTAL: trigger = Qincremental; break;
+    case GC_TRIGGER_RELEASE_MEMORY: trigger = Qrelease_memory; break;
+    default: emacs_abort ();
+    }
+  ASET (vector, 0, make_int (e->number));
+  ASET (vector, 1, timespec_to_usec (e->start));
+  ASET (vector, 2, trigger);
+  ASET (vector, 3, e->minor ? Qt : Qnil);
+  ASET (vector, 4, timespec_to_usec (e->mark));
+  ASET (vector, 5, timespec_to_usec (e->sweep));
+  ASET (vector, 6, timespec_to_usec (e->finalize));
+  ASET (vector, 7, make_uint (e->heap));
+  for (int i = 0; i < GC_LOG_TYPES; i++)
+    ASET (vector, 8 + i, make_uint (e->freed[i]));
+  return vector;
+}
+
+/* Subroutine of Fgarbage_collect that does most of the work.  */
+void
+garbage_collect (void)
+{
+  garbage_collect_1 (false, GC_TRIGGER_EXPLICIT);
+}
+
+/* Collect garbage.  If MINOR, free only the conses and floats that
+   were allocated since the last GC; see 'gc-generational'.  TRIGGER
+   says what started the collection, for the GC log.  */
+static void
+garbage_collect_1 (bool minor, enum gc_trigger trigger)
+{
+  Lisp_Object tail, buffer;
+  char stack_top_variable;
+  bool message_p;
+  specpdl_ref count = SPECPDL_INDEX ();
+  struct timespec start, mark_end, sweep_end, finalize_start;
+
+  eassert (weak_hash_tables == NULL);
+
+  if (garbage_collection_inhibited)
+    return;
+
+  eassert (mark_stack_empty_p ());
+
+  /* Record this function, so it appears on the profiler's backtraces.  */
+  record_in_backtrace (QAutomatic_GC, 0, 0);
+
+  /* Don't keep undo information around forever.
+     Do this early on, so it is no problem if the user quits.  */
+  FOR_EACH_LIVE_BUFFER (tail, buffer)
+    compact_buffer (XBUFFER (buffer));
+
+  byte_ct tot_before = (profiler_memory_running
+			? total_bytes_of_live_objects ()
+			: (byte_ct) -1);
+
+  start = current_timespec ();
+
+  /* In case user calls debug_print during GC,
      don't let that cause a recursive GC.  */
   consing_until_gc = HI_THRESHOLD;
 
@@ -6603,6 +7383,14 @@ garbage_collect (void)
 
   gc_in_progress = 1;
 
+  finish_lazy_sweep ();
+  check_incremental_marking ();
+  if (!minor && gc_old_conses_marked)
+    unmark_old_generation ();
+  if (!minor && !gc_marking_incrementally)
+    mark_in_parallel ();
+  gc_minor_marking = minor;
+
   /* Mark all the special slots that serve as the roots of accessibility.  */
 
   struct gc_root_visitor visitor = { .visit = mark_object_root_visitor };
@@ -6617,6 +7405,7 @@ garbage_collect (void)
   mark_charset ();
   mark_composite ();
   mark_profiler ();
+  mark_regexp_cache ();
 #ifdef HAVE_PGTK
   mark_pgtkterm ();
 #endif
@@ -6650,6 +7439,11 @@ garbage_collect (void)
 #endif
   mark_fns ();
 
+  if (minor)
+    mark_remembered_objects ();
+  else if (gc_marking_incrementally)
+    finish_incremental_marking ();
+
   /* Everything is now marked, except for the data in font caches,
      undo lists, and finalizers.  The first two are compacted by
      removing any items which aren't reachable otherwise.  */
@@ -6682,10 +7476,18 @@ garbage_collect (void)
 
   eassert (mark_stack_empty_p ());
 
-  gc_sweep ();
+  mark_end = current_timespec ();
+  gc_sweep (minor);
+  gc_minor_marking = false;
+  sweep_end = current_timespec ();
 
   unmark_main_thread ();
 
+  if (minor)
+    minor_gcs_done++;
+  else
+    live_bytes_after_full_gc = total_bytes_of_live_objects ();
+
   gc_in_progress = 0;
 
   consing_until_gc = gc_threshold
@@ -6706,23 +7508,24 @@ garbage_collect (void)
   unbind_to (count, Qnil);
 
   /* GC is complete: now we can run our finalizer callbacks.  */
+  finalize_start = current_timespec ();
   run_finalizers (&doomed_finalizers);
+  struct timespec finalize_end = current_timespec ();
 
 #ifdef HAVE_WINDOW_SYSTEM
   /* Eject unused image cache entries.  */
   image_prune_animation_caches (false);
 #endif
 
-  /* Accumulate statistics.  */
-  if (FLOATP (Vgc_elapsed))
-    {
-      static struct timespec gc_elapsed;
-      gc_elapsed = timespec_add (gc_elapsed,
-				 timespec_sub (current_timespec (), start));
-      Vgc_elapsed = make_float (timespectod (gc_elapsed));
-    }
-
+  accumulate_gc_elapsed (start);
+  accumulate_elapsed (&Vgc_mark_elapsed, &gc_mark_elapsed,
+		      timespec_sub (mark_end, start));
+  accumulate_elapsed (&Vgc_sweep_elapsed, &gc_sweep_elapsed,
+		      timespec_sub (sweep_end, mark_end));
   gcs_done++;
+  log_gc (trigger, minor, start, timespec_sub (mark_end, start),
+	  timespec_sub (sweep_end, mark_end),
+	  timespec_sub (finalize_end, finalize_start));
 
   /* Collect profiling data.  */
   if (tot_before != (byte_ct) -1)
@@ -6772,6 +7575,54 @@ DEFUN ("garbage-collect", Fgarbage_collect, Sgarbage_collect, 0, 0, "",
   specbind (Qsymbols_with_pos_enabled, Qnil);
   garbage_collect ();
   unbind_to (count, Qnil);
+  return gc_statistics ();
+}
+
+static void
+finish_releasing_memory (void)
+{
+  gc_releasing_memory = false;
+}
+
+DEFUN ("garbage-collect-release-memory",
+       Fgarbage_collect_release_memory,
+       Sgarbage_collect_release_memory, 0, 0, "",
+       doc: /* Reclaim storage for Lisp objects, and return it to the system.
+This is like `garbage-collect', but it also frees the blocks of memory
+that hold no cons cells, floats, symbols or intervals in use, instead
+of keeping some of them for future allocations.  It then tells the
+system that the memory of these blocks is no longer needed, and asks
+libc to return free heap memory to the system, as `malloc-trim' does.
+
+This does not compact the heap: objects are not moved, so a block that
+holds a single object in use is kept.  This is slower than `garbage-collect', and meant to be called
+explicitly, for instance when a long-running Emacs is idle.  The value
+is the same as that of `garbage-collect'.  */)
+  (void)
+{
+  if (garbage_collection_inhibited)
+    return Qnil;
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  specbind (Qsymbols_with_pos_enabled, Qnil);
+  gc_releasing_memory = true;
+  record_unwind_protect_void (finish_releasing_memory);
+  garbage_collect_1 (false, GC_TRIGGER_RELEASE_MEMORY);
+  unbind_to (count, Qnil);
+
+  discard_free_ablocks ();
+#ifdef HAVE_MALLOC_TRIM
+  malloc_trim (0);
+#endif
+  return gc_statistics ();
+}
+
+/* Return the statistics of the last collection, as a list of the form
+   that 'garbage-collect' returns.  */
+
+static Lisp_Object
+gc_statistics (void)
+{
   struct gcstat gcst = gcstat;
 
   Lisp_Object total[] = {
@@ -6827,7 +7678,7 @@ DEFUN ("garbage-collect-maybe", Fgarbage_collect_maybe,
   EMACS_INT since_gc = gc_threshold - consing_until_gc;
   if (fact >= 1 && since_gc > gc_threshold / fact)
     {
-      garbage_collect ();
+      garbage_collect_1 (minor_gc_p (), GC_TRIGGER_EXPLICIT);
       return Qt;
     }
   else
@@ -6979,6 +7830,8 @@ mark_buffer (struct buffer *buffer)
   if (!itree_empty_p (buffer->overlays))
     mark_overlays (buffer->overlays->root);
 
+  mark_syntax_ppss_cache (buffer);
+
   /* If this is an indirect buffer, mark its base buffer.  */
   if (buffer->base_buffer &&
       !vectorlike_marked_p (&buffer->base_buffer->header))
@@ -7486,6 +8339,752 @@ mark_objects (Lisp_Object *objs, ptrdiff_t n)
   process_mark_stack (sp);
 }
 
+/* Marking in slices and in several threads.
+
+   Vectors and strings keep their mark bits in their headers, where
+   Lisp code would see them, and marking some objects has side effects,
+   so only the mark phase of a collection, which runs without Lisp, can
+   mark such objects.  Conses and floats keep their mark bits in
+   bitmaps, and marking them has no side effect, so they can be marked
+   before it, while Lisp runs.  A gc_marker marks conses and floats.
+   It merely records the other objects it reaches, and looks inside the
+   common ones for more conses.  The mark phase then marks the recorded
+   objects, and finds the conses that the marker marked already marked,
+   so it does not look inside them.
+
+   A gc_marker that runs in the mark phase also marks the strings,
+   symbols and vectors whose marking has no side effect, setting their
+   mark bits atomically, since other markers may run at the same time.
+   It records only the others, such as buffers, weak hash tables,
+   strings with text properties, and objects in the dump.
+
+   The slices of an incremental collection use a gc_marker outside of
+   the mark phase, and the threads of a parallel mark use one each in
+   the mark phase; see 'mark_incrementally' and 'mark_in_parallel'.  */
+
+struct gc_marker
+{
+  /* The values still to look at, as on the mark stack.  */
+  struct mark_entry *stack;
+  ptrdiff_t size, sp;
+
+  /* The objects other than conses and floats reached, as an open
+     addressing hash set of 2**REACHED_BITS slots.  nil marks empty
+     slots; every collection marks nil anyway.  */
+  Lisp_Object *reached;
+  int reached_bits;
+  ptrdiff_t reached_count;
+
+  /* True if the marker runs in the mark phase.  */
+  bool mark_phase;
+
+  /* True if memory ran out, so that the marker dropped some values.  */
+  bool failed;
+};
+
+/* Objects may be marked by several threads at once.  MARKER_LOAD
+   reads a header that another thread may be marking.  */
+#ifdef PARALLEL_MARKING
+# define MARKER_SETMARKBIT(block, n)					\
+  (! (__atomic_fetch_or (&(block)->gcmarkbits[(n) / BITS_PER_BITS_WORD],	\
+			 (bits_word) 1 << ((n) % BITS_PER_BITS_WORD),	\
+			 __ATOMIC_RELAXED)					\
+      & (bits_word) 1 << ((n) % BITS_PER_BITS_WORD)))
+# define MARKER_SETMARKFLAG(size)					\
+  (! (__atomic_fetch_or (&(size), ARRAY_MARK_FLAG, __ATOMIC_RELAXED)	\
+      & ARRAY_MARK_FLAG))
+# define MARKER_SETMARKBOOL(b) (! __atomic_exchange_n (&(b), true,	\
+						       __ATOMIC_RELAXED))
+# define MARKER_LOAD(x) __atomic_load_n (&(x), __ATOMIC_RELAXED)
+#else
+# define MARKER_SETMARKBIT(block, n)		\
+  (!GETMARKBIT (block, n) && (SETMARKBIT (block, n), true))
+# define MARKER_SETMARKFLAG(size)				\
+  (!((size) & ARRAY_MARK_FLAG) && ((size) |= ARRAY_MARK_FLAG, true))
+# define MARKER_SETMARKBOOL(b) (!(b) && ((b) = true))
+# define MARKER_LOAD(x) (x)
+#endif
+
+/* Mark the object FPTR, and return true if it was not marked.  Objects
+   in the dump keep their mark bits elsewhere, and are marked only by
+   the mark phase.  */
+#define MARKER_MARK_CONS(fptr) \
+  MARKER_SETMARKBIT (CONS_BLOCK (fptr), CONS_INDEX (fptr))
+#define MARKER_MARK_FLOAT(fptr) \
+  MARKER_SETMARKBIT (FLOAT_BLOCK (fptr), FLOAT_INDEX (fptr))
+#define MARKER_MARK_STRING(fptr) MARKER_SETMARKFLAG ((fptr)->u.s.size)
+#define MARKER_MARK_VECTOR(fptr) MARKER_SETMARKFLAG ((fptr)->header.size)
+#define MARKER_MARK_SYMBOL(fptr) MARKER_SETMARKBOOL ((fptr)->u.s.gcmarkbit)
+
+/* Markers may run in threads other than the main one, so they must not
+   signal errors.  They use malloc directly, and drop what they have no
+   memory for.  */
+
+static bool
+grow_marker_stack (struct gc_marker *m)
+{
+  ptrdiff_t size = m->size ? 2 * m->size : 8192;
+  struct mark_entry *stack = realloc (m->stack, size * sizeof *stack);
+  if (!stack)
+    return !(m->failed = true);
+  m->stack = stack;
+  m->size = size;
+  return true;
+}
+
+static void
+marker_push_values (struct gc_marker *m, Lisp_Object *values, ptrdiff_t n)
+{
+  if (n == 0 || (m->sp == m->size && !grow_marker_stack (m)))
+    return;
+  m->stack[m->sp++] = (struct mark_entry) {.n = n, .u.values = values};
+}
+
+static void
+marker_push_value (struct gc_marker *m, Lisp_Object value)
+{
+  if (m->sp == m->size && !grow_marker_stack (m))
+    return;
+  m->stack[m->sp++] = (struct mark_entry) {.n = 0, .u.value = value};
+}
+
+static Lisp_Object
+marker_pop (struct gc_marker *m)
+{
+  struct mark_entry *e = &m->stack[m->sp - 1];
+  if (e->n == 0)
+    {
+      m->sp--;
+      return e->u.value;
+    }
+  if (--e->n == 0)
+    m->sp--;
+  return (++e->u.values)[-1];
+}
+
+static bool marker_reach (struct gc_marker *, Lisp_Object);
+
+NO_INLINE static bool
+grow_marker_reached (struct gc_marker *m)
+{
+  Lisp_Object *old = m->reached;
+  ptrdiff_t old_size = old ? (ptrdiff_t) 1 << m->reached_bits : 0;
+  int bits = old ? m->reached_bits + 1 : 12;
+  Lisp_Object *reached = malloc (sizeof *reached << bits);
+  if (!reached)
+    return !(m->failed = true);
+  for (ptrdiff_t i = 0; i < (ptrdiff_t) 1 << bits; i++)
+    reached[i] = Qnil;
+  m->reached = reached;
+  m->reached_bits = bits;
+  m->reached_count = 0;
+  for (ptrdiff_t i = 0; i < old_size; i++)
+    if (!NILP (old[i]))
+      marker_reach (m, old[i]);
+  free (old);
+  return true;
+}
+
+/* Add OBJ to the objects that M reached.  Return true if it was not
+   there already.  */
+
+static bool
+marker_reach (struct gc_marker *m, Lisp_Object obj)
+{
+  if ((!m->reached
+       || m->reached_count >= (ptrdiff_t) 1 << (m->reached_bits - 1))
+      && !grow_marker_reached (m))
+    return false;
+  ptrdiff_t mask = ((ptrdiff_t) 1 << m->reached_bits) - 1;
+  ptrdiff_t i = knuth_hash (reduce_emacs_uint_to_hash_hash (XLI (obj)),
+			    m->reached_bits);
+  for (; !NILP (m->reached[i]); i = (i + 1) & mask)
+    if (BASE_EQ (m->reached[i], obj))
+      return false;
+  m->reached[i] = obj;
+  m->reached_count++;
+  return true;
+}
+
+/* Mark the vector PTR if M can, and push its contents onto M's stack
+   if it was not marked.  Return false if only the mark phase can mark
+   it.  */
+
+static bool
+marker_mark_vector (struct gc_marker *m, struct Lisp_Vector *ptr)
+{
+  if (!m->mark_phase || pdumper_object_p (ptr))
+    return false;
+
+  ptrdiff_t size = MARKER_LOAD (ptr->header.size) & ~ARRAY_MARK_FLAG;
+  enum pvec_type type = (size & PSEUDOVECTOR_FLAG
+			 ? ((size & PVEC_TYPE_MASK)
+			    >> PSEUDOVECTOR_AREA_BITS)
+			 : PVEC_NORMAL_VECTOR);
+  switch (type)
+    {
+    case PVEC_NORMAL_VECTOR:
+    case PVEC_RECORD:
+    case PVEC_CLOSURE:
+      if (MARKER_MARK_VECTOR (ptr))
+	marker_push_values (m, ptr->contents,
+			    (size & PSEUDOVECTOR_FLAG
+			     ? size & PSEUDOVECTOR_SIZE_MASK : size));
+      return true;
+
+    case PVEC_BOOL_VECTOR:
+      (void) MARKER_MARK_VECTOR (ptr);
+      return true;
+
+    case PVEC_HASH_TABLE:
+      {
+	struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) ptr;
+	/* The mark phase links weak tables together.  */
+	if (h->weakness != Weak_None)
+	  return false;
+	if (MARKER_MARK_VECTOR (ptr))
+	  marker_push_values (m, h->key_and_value, 2 * h->table_size);
+	return true;
+      }
+
+    case PVEC_OBARRAY:
+      {
+	struct Lisp_Obarray *o = (struct Lisp_Obarray *) ptr;
+	if (MARKER_MARK_VECTOR (ptr))
+	  marker_push_values (m, o->buckets, obarray_size (o));
+	return true;
+      }
+
+    default:
+      return false;
+    }
+}
+
+/* Mark OBJ if M can, and record it in M otherwise.  Push what it
+   points to onto M's stack, unless it is an object whose contents only
+   the mark phase can find.  */
+
+static void
+marker_mark (struct gc_marker *m, Lisp_Object obj)
+{
+  void *po = XPNTR (obj);
+  if (PURE_P (po) || NILP (obj))
+    return;
+
+  switch (XTYPE (obj))
+    {
+    case Lisp_Cons:
+      /* Conses in the dump are marked only during the mark phase.  */
+      if (!pdumper_object_p (po))
+	{
+	  struct Lisp_Cons *ptr = XCONS (obj);
+	  if (MARKER_MARK_CONS (ptr))
+	    {
+	      marker_push_value (m, ptr->u.s.u.cdr);
+	      marker_push_value (m, ptr->u.s.car);
+	    }
+	}
+      else if (marker_reach (m, obj))
+	{
+	  marker_push_value (m, XCDR (obj));
+	  marker_push_value (m, XCAR (obj));
+	}
+      break;
+
+    case Lisp_Float:
+      {
+	struct Lisp_Float *f = XFLOAT (obj);
+	/* Floats in the dump have no mark bits, and F is NULL for
+	   HASH_UNUSED_ENTRY_KEY.  */
+	if (f && !pdumper_object_p (f))
+	  (void) MARKER_MARK_FLOAT (f);
+      }
+      break;
+
+    case Lisp_Symbol:
+      {
+	struct Lisp_Symbol *ptr = XBARE_SYMBOL (obj);
+	/* Marking a symbol whose value is local to buffers may swap in
+	   its global value, so only the mark phase marks those.  */
+	if (m->mark_phase && !pdumper_object_p (ptr)
+	    && ptr->u.s.redirect != SYMBOL_LOCALIZED)
+	  {
+	    if (MARKER_MARK_SYMBOL (ptr))
+	      {
+		marker_push_value (m, ptr->u.s.function);
+		marker_push_value (m, ptr->u.s.plist);
+		if (ptr->u.s.redirect == SYMBOL_PLAINVAL)
+		  marker_push_value (m, SYMBOL_VAL (ptr));
+		else if (ptr->u.s.redirect == SYMBOL_VARALIAS)
+		  marker_push_value (m, make_lisp_symbol (SYMBOL_ALIAS (ptr)));
+		marker_push_value (m, ptr->u.s.name);
+		if (ptr->u.s.next)
+		  marker_push_value (m, make_lisp_symbol (ptr->u.s.next));
+	      }
+	  }
+	else if (marker_reach (m, obj))
+	  {
+	    marker_push_value (m, ptr->u.s.function);
+	    marker_push_value (m, ptr->u.s.plist);
+	    if (ptr->u.s.redirect == SYMBOL_PLAINVAL)
+	      marker_push_value (m, SYMBOL_VAL (ptr));
+	    if (ptr->u.s.next)
+	      marker_push_value (m, make_lisp_symbol (ptr->u.s.next));
+	  }
+      }
+      break;
+
+    case Lisp_String:
+      {
+	struct Lisp_String *ptr = XSTRING (obj);
+	/* Marking the intervals of a string balances them, so only the
+	   mark phase marks strings that have some.  */
+	if (m->mark_phase && !pdumper_object_p (ptr) && !ptr->u.s.intervals)
+	  (void) MARKER_MARK_STRING (ptr);
+	else
+	  marker_reach (m, obj);
+      }
+      break;
+
+    case Lisp_Vectorlike:
+      if (marker_mark_vector (m, XVECTOR (obj)))
+	;
+      else if (marker_reach (m, obj))
+	{
+	  struct Lisp_Vector *ptr = XVECTOR (obj);
+	  switch (PSEUDOVECTOR_TYPE (ptr))
+	    {
+	    case PVEC_NORMAL_VECTOR:
+	    case PVEC_RECORD:
+	    case PVEC_CLOSURE:
+	      {
+		ptrdiff_t size = ptr->header.size;
+		if (size & PSEUDOVECTOR_FLAG)
+		  size &= PSEUDOVECTOR_SIZE_MASK;
+		marker_push_values (m, ptr->contents, size);
+	      }
+	      break;
+
+	      /* Lisp may reallocate the contents of hash tables and
+		 obarrays between slices, so push copies of them.  */
+	    case PVEC_HASH_TABLE:
+	      {
+		struct Lisp_Hash_Table *h = XHASH_TABLE (obj);
+		if (h->weakness == Weak_None)
+		  for (ptrdiff_t i = 0; i < 2 * h->table_size; i++)
+		    marker_push_value (m, h->key_and_value[i]);
+	      }
+	      break;
+
+	    case PVEC_OBARRAY:
+	      {
+		struct Lisp_Obarray *o = XOBARRAY (obj);
+		for (ptrdiff_t i = 0; i < obarray_size (o); i++)
+		  marker_push_value (m, o->buckets[i]);
+	      }
+	      break;
+
+	    default:
+	      break;
+	    }
+	}
+      break;
+
+    case_Lisp_Int:
+      break;
+
+    default:
+      emacs_abort ();
+    }
+}
+
+static void
+marker_root_visitor (Lisp_Object const *root_ptr,
+		     enum gc_root_type type, void *data)
+{
+  marker_push_value (data, *root_ptr);
+}
+
+/* Mark what M has yet to look at, and what it reached, and free its
+   memory.  Called during the mark phase.  */
+
+static void
+finish_marker (struct gc_marker *m)
+{
+  while (m->sp > 0)
+    {
+      struct mark_entry *e = &m->stack[--m->sp];
+      if (e->n == 0)
+	mark_object (e->u.value);
+      else
+	mark_objects (e->u.values, e->n);
+    }
+  if (m->reached)
+    for (ptrdiff_t i = 0; i < (ptrdiff_t) 1 << m->reached_bits; i++)
+      if (!NILP (m->reached[i]))
+	mark_object (m->reached[i]);
+  free (m->stack);
+  free (m->reached);
+  *m = (struct gc_marker) {0};
+}
+
+/* Free the memory of M without marking what it reached.  Called before
+   the mark phase, when M failed; the caller then unmarks what M marked
+   with unmark_old_generation.  */
+
+static void
+abandon_marker (struct gc_marker *m)
+{
+  free (m->stack);
+  free (m->reached);
+  *m = (struct gc_marker) {0};
+}
+
+/* The marker of the slices of incremental collections.  */
+
+static struct gc_marker slice_marker;
+
+/* Mark for at most 'gc-incremental-slice' seconds.  Return true if
+   slices can mark nothing more.  */
+
+static bool
+mark_slice (void)
+{
+  double slice = (NUMBERP (Vgc_incremental_slice)
+		  ? XFLOATINT (Vgc_incremental_slice) : 0);
+  struct timespec end = timespec_add (current_timespec (),
+				      dtotimespec (slice));
+  for (int n = 1; slice_marker.sp > 0; n++)
+    {
+      marker_mark (&slice_marker, marker_pop (&slice_marker));
+      if (n % 4096 == 0 && timespec_cmp (end, current_timespec ()) < 0)
+	break;
+    }
+  return slice_marker.sp == 0;
+}
+
+/* Do a slice of the incremental collection in progress, starting one
+   if there is none.  Finish the collection if the slices are done.
+
+   Slices mark only conses and floats.  Lisp changes conses between
+   slices, so the mark phase that finishes the collection also looks
+   inside the conses that slices marked and that Lisp changed since.
+   note_old_cons_store tells it which, by flagging their blocks dirty.
+   This is the only write barrier: stores into vectors, symbols and
+   other objects are not recorded, which is why the finishing phase
+   marks all of those from the roots as a full collection would.  */
+
+void
+mark_incrementally (void)
+{
+  if (garbage_collection_inhibited)
+    return;
+
+  struct timespec start = current_timespec ();
+  block_input ();
+  gc_in_progress = 1;
+  if (!gc_marking_incrementally)
+    {
+      finish_lazy_sweep ();
+      if (gc_old_conses_marked)
+	unmark_old_generation ();
+      struct gc_root_visitor visitor = { .visit = marker_root_visitor,
+					 .data = &slice_marker };
+      visit_static_gc_roots (visitor);
+      gc_marking_incrementally = true;
+      gc_slices_left = GC_SLICES_PER_THRESHOLD;
+    }
+  bool done = mark_slice ();
+  gc_in_progress = 0;
+  unblock_input ();
+  accumulate_gc_elapsed (start);
+  accumulate_elapsed (&Vgc_mark_elapsed, &gc_mark_elapsed,
+		      timespec_sub (current_timespec (), start));
+
+  if (done)
+    garbage_collect_1 (false, GC_TRIGGER_INCREMENTAL);
+}
+
+/* Finish the marking that the slices of an incremental collection
+   started.  Called by garbage_collect_1 after it marked the roots.  */
+
+static void
+finish_incremental_marking (void)
+{
+  gc_marking_incrementally = false;
+  finish_marker (&slice_marker);
+  mark_dirty_conses ();
+}
+
+/* Forget what the slices of an incremental collection marked, if they
+   ran out of memory.  Called by garbage_collect_1 before it marks.  */
+
+static void
+check_incremental_marking (void)
+{
+  if (gc_marking_incrementally && slice_marker.failed)
+    {
+      gc_marking_incrementally = false;
+      abandon_marker (&slice_marker);
+      unmark_old_generation ();
+    }
+}
+
+#ifdef PARALLEL_MARKING
+
+/* Parallel marking.
+
+   The threads of a parallel mark each have a marker, and share the
+   work through a pool: a thread with much to mark moves part of it to
+   the pool when other threads are idle, and idle threads take work
+   from the pool.  Marking is done when all threads are idle and the
+   pool is empty.  The main thread marks too, and then marks what the
+   markers reached, and the roots that only it can find, such as the
+   stacks.  */
+
+/* Number of values a thread moves to or from the pool at once.  */
+
+enum { GC_POOL_BATCH = 512 };
+
+static struct
+{
+  sys_mutex_t mutex;
+  /* Signaled when work arrives in the pool, when marking starts, and
+     when it is done.  */
+  sys_cond_t cond;
+
+  /* The values in the pool.  */
+  struct mark_entry *entries;
+  ptrdiff_t size, count;
+
+  /* The markers of the threads, the main thread's first.  */
+  struct gc_marker *markers;
+  /* Number of threads created besides the main thread.  */
+  int helpers;
+  /* Number of threads marking now, including the main thread.  */
+  int threads;
+  /* Number of threads waiting for work.  */
+  int idle;
+  /* Number of helper threads done marking.  */
+  int finished;
+  /* Number of parallel marks started so far.  */
+  unsigned int marks;
+  /* True once the current mark is done.  */
+  bool done;
+} gc_pool;
+
+/* Move work from M to the pool, if it has enough to share.  */
+
+static void
+share_marking (struct gc_marker *m)
+{
+  sys_mutex_lock (&gc_pool.mutex);
+  ptrdiff_t n = min (GC_POOL_BATCH, m->sp / 2);
+  if (gc_pool.size - gc_pool.count < n)
+    {
+      ptrdiff_t size = max (gc_pool.size * 2, 4 * GC_POOL_BATCH);
+      struct mark_entry *entries
+	= realloc (gc_pool.entries, size * sizeof *entries);
+      if (entries)
+	{
+	  gc_pool.entries = entries;
+	  gc_pool.size = size;
+	}
+      else
+	n = 0;
+    }
+  /* Share the bottom of M's stack, which is likely to lead to more
+     work than the top.  */
+  memcpy (gc_pool.entries + gc_pool.count, m->stack, n * sizeof *m->stack);
+  gc_pool.count += n;
+  m->sp -= n;
+  memmove (m->stack, m->stack + n, m->sp * sizeof *m->stack);
+  sys_cond_broadcast (&gc_pool.cond);
+  sys_mutex_unlock (&gc_pool.mutex);
+}
+
+/* Move work from the pool to M, waiting for some if need be.  Return
+   false if marking is done.  */
+
+static bool
+take_marking (struct gc_marker *m)
+{
+  sys_mutex_lock (&gc_pool.mutex);
+  gc_pool.idle++;
+  while (gc_pool.count == 0 && !gc_pool.done)
+    {
+      if (gc_pool.idle == gc_pool.threads)
+	{
+	  gc_pool.done = true;
+	  sys_cond_broadcast (&gc_pool.cond);
+	}
+      else
+	sys_cond_wait (&gc_pool.cond, &gc_pool.mutex);
+    }
+  bool done = gc_pool.done;
+  if (!done)
+    {
+      gc_pool.idle--;
+      ptrdiff_t n = min (GC_POOL_BATCH, gc_pool.count);
+      while (m->size - m->sp < n)
+	if (!grow_marker_stack (m))
+	  {
+	    n = m->size - m->sp;
+	    break;
+	  }
+      gc_pool.count -= n;
+      memcpy (m->stack + m->sp, gc_pool.entries + gc_pool.count,
+	      n * sizeof *m->stack);
+      m->sp += n;
+    }
+  sys_mutex_unlock (&gc_pool.mutex);
+  return !done;
+}
+
+/* Mark with M until all threads are done.  */
+
+static void
+parallel_mark (struct gc_marker *m)
+{
+  do
+    while (m->sp > 0)
+      {
+	marker_mark (m, marker_pop (m));
+	if (m->sp >= 2 * GC_POOL_BATCH
+	    && __atomic_load_n (&gc_pool.idle, __ATOMIC_RELAXED))
+	  share_marking (m);
+      }
+  while (take_marking (m));
+}
+
+/* The function of the helper threads.  ARG is the thread's number.  */
+
+static void *
+mark_helper (void *arg)
+{
+  int i = (intptr_t) arg;
+  unsigned int marks = 0;
+#ifdef HAVE_PTHREAD
+  /* Leave signals to the main thread.  */
+  sigset_t blocked;
+  sigfillset (&blocked);
+  pthread_sigmask (SIG_BLOCK, &blocked, NULL);
+#endif
+  sys_mutex_lock (&gc_pool.mutex);
+  while (true)
+    {
+      while (gc_pool.marks == marks)
+	sys_cond_wait (&gc_pool.cond, &gc_pool.mutex);
+      marks = gc_pool.marks;
+      if (i < gc_pool.threads)
+	{
+	  sys_mutex_unlock (&gc_pool.mutex);
+	  parallel_mark (&gc_pool.markers[i]);
+	  sys_mutex_lock (&gc_pool.mutex);
+	  gc_pool.finished++;
+	  sys_cond_broadcast (&gc_pool.cond);
+	}
+    }
+  return NULL;
+}
+
+/* Clear the mark bits of the strings, vectors and symbols, which the
+   markers of a parallel mark set if it failed.  */
+
+static void
+unmark_strings_vectors_symbols (void)
+{
+  for (struct string_block *b = string_blocks; b; b = b->next)
+    for (int i = 0; i < STRING_BLOCK_SIZE; i++)
+      if (b->strings[i].u.s.data)
+	XUNMARK_STRING (&b->strings[i]);
+
+  for (struct vector_block *block = vector_blocks; block; block = block->next)
+    {
+      ASAN_UNPOISON_VECTOR_BLOCK (block);
+      for (struct Lisp_Vector *vector = (struct Lisp_Vector *) block->data;
+	   VECTOR_IN_BLOCK (vector, block);
+	   vector = ADVANCE (vector, vector_nbytes (vector)))
+	XUNMARK_VECTOR (vector);
+    }
+  for (struct large_vector *lv = large_vectors; lv; lv = lv->next)
+    XUNMARK_VECTOR (large_vector_vec (lv));
+
+  for (int i = 0; i < ARRAYELTS (lispsym); i++)
+    lispsym[i].u.s.gcmarkbit = false;
+  int lim = symbol_block_index;
+  for (struct symbol_block *sblk = symbol_block; sblk; sblk = sblk->next)
+    {
+      ASAN_UNPOISON_SYMBOL_BLOCK (sblk);
+      for (int i = 0; i < lim; i++)
+	sblk->symbols[i].u.s.gcmarkbit = false;
+      lim = SYMBOL_BLOCK_SIZE;
+    }
+}
+
+/* Mark what the static roots reach with 'gc-mark-threads' threads,
+   and then the objects the threads left to the mark phase.  Called by
+   garbage_collect_1 before it marks the roots.  */
+
+static void
+mark_in_parallel (void)
+{
+  int threads = clip_to_bounds (1, gc_mark_threads, 64);
+  if (threads == 1)
+    return;
+
+  if (!gc_pool.markers)
+    {
+      sys_mutex_init (&gc_pool.mutex);
+      sys_cond_init (&gc_pool.cond);
+      gc_pool.markers = xzalloc (64 * sizeof *gc_pool.markers);
+    }
+  sys_thread_t thread;
+  while (gc_pool.helpers < threads - 1
+	 && sys_thread_create (&thread, mark_helper,
+			       (void *) (intptr_t) (gc_pool.helpers + 1)))
+    gc_pool.helpers++;
+  threads = min (threads, gc_pool.helpers + 1);
+
+  for (int i = 0; i < threads; i++)
+    gc_pool.markers[i].mark_phase = true;
+  struct gc_marker *m = &gc_pool.markers[0];
+  struct gc_root_visitor visitor = { .visit = marker_root_visitor,
+				     .data = m };
+  visit_static_gc_roots (visitor);
+
+  sys_mutex_lock (&gc_pool.mutex);
+  gc_pool.threads = threads;
+  gc_pool.idle = gc_pool.finished = 0;
+  gc_pool.done = false;
+  gc_pool.marks++;
+  sys_cond_broadcast (&gc_pool.cond);
+  sys_mutex_unlock (&gc_pool.mutex);
+
+  parallel_mark (m);
+
+  sys_mutex_lock (&gc_pool.mutex);
+  while (gc_pool.finished < threads - 1)
+    sys_cond_wait (&gc_pool.cond, &gc_pool.mutex);
+  sys_mutex_unlock (&gc_pool.mutex);
+
+  bool failed = false;
+  for (int i = 0; i < threads; i++)
+    failed |= gc_pool.markers[i].failed;
+  for (int i = 0; i < threads; i++)
+    if (failed)
+      abandon_marker (&gc_pool.markers[i]);
+    else
+      finish_marker (&gc_pool.markers[i]);
+  if (failed)
+    {
+      unmark_old_generation ();
+      unmark_strings_vectors_symbols ();
+    }
+}
+
+#endif /* PARALLEL_MARKING */
+
 /* Mark the Lisp pointers in the terminal objects.
    Called by Fgarbage_collect.  */
 
@@ -7549,6 +9148,118 @@ survives_gc_p (Lisp_Object obj)
 
 
 
+/* Lazy sweeping.
+
+   When 'gc-lazy-sweep' is non-nil, a collection only counts the marked
+   conses and floats, from the mark bitmaps of their blocks, and leaves
+   the blocks themselves to be swept when the allocator runs out of free
+   conses or floats, one block at a time.  The next collection sweeps
+   the blocks still left before it marks anything.  Vectors, strings and
+   symbols keep their mark bits in their headers, where Lisp would see
+   them, so they are always swept during the collection.  */
+
+/* The link to the first cons or float block the last collection left
+   unswept, or NULL if there is none.  */
+
+static struct cons_block **cons_sweep_next;
+static struct float_block **float_sweep_next;
+
+/* Number of free conses and floats the lazy sweep found so far.  */
+
+static object_ct cons_sweep_free, float_sweep_free;
+
+/* Return the number of the first LIM mark bits in BITS that are set.  */
+
+static int
+count_mark_bits (bits_word const *bits, int lim)
+{
+  int n = 0;
+  for (int i = 0; i < lim / BITS_PER_BITS_WORD; i++)
+    n += stdc_count_ones (bits[i]);
+  if (lim % BITS_PER_BITS_WORD)
+    n += stdc_count_ones (bits[lim / BITS_PER_BITS_WORD]
+			  & (((bits_word) 1 << (lim % BITS_PER_BITS_WORD))
+			     - 1));
+  return n;
+}
+
+/* Sweep the cons block *CPREV, whose first LIM conses were allocated,
+   putting its free conses on the free list, and adding their number to
+   *NUM_FREE and that of the others to *NUM_USED.  If it has only free
+   conses and more than a block's worth was already found, free it
+   instead.  Return the link to the next block.  */
+
+static struct cons_block **
+sweep_cons_block (struct cons_block **cprev, int lim,
+		  object_ct *num_free, object_ct *num_used)
+{
+  struct cons_block *cblk = *cprev;
+  int this_free = 0;
+  int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+
+  cblk->swept = true;
+
+  /* Scan the mark bits an int at a time.  */
+  for (int i = 0; i < ilim; i++)
+    {
+      if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
+	{
+	  /* Fast path - all cons cells for this int are marked.  */
+	  if (!gc_old_conses_marked)
+	    cblk->gcmarkbits[i] = 0;
+	  *num_used += BITS_PER_BITS_WORD;
+	}
+      else
+	{
+	  /* Some cons cells for this int are not marked.
+	     Find which ones, and free them.  */
+	  int start, pos, stop;
+
+	  start = i * BITS_PER_BITS_WORD;
+	  stop = lim - start;
+	  if (stop > BITS_PER_BITS_WORD)
+	    stop = BITS_PER_BITS_WORD;
+	  stop += start;
+
+	  for (pos = start; pos < stop; pos++)
+	    {
+	      struct Lisp_Cons *acons = &cblk->conses[pos];
+	      if (!XCONS_MARKED_P (acons))
+		{
+		  ASAN_UNPOISON_CONS (&cblk->conses[pos]);
+		  this_free++;
+		  cblk->conses[pos].u.s.u.chain = cons_free_list;
+		  cons_free_list = &cblk->conses[pos];
+		  cons_free_list->u.s.car = dead_object ();
+		  ASAN_POISON_CONS (&cblk->conses[pos]);
+		}
+	      else
+		{
+		  (*num_used)++;
+		  if (!gc_old_conses_marked)
+		    XUNMARK_CONS (acons);
+		}
+	    }
+	}
+    }
+
+  /* If this block contains only free conses and we have already
+     seen more than two blocks worth of free conses then deallocate
+     this block.  */
+  if (this_free == CONS_BLOCK_SIZE
+      && (*num_free > CONS_BLOCK_SIZE || gc_releasing_memory))
+    {
+      *cprev = cblk->next;
+      /* Unhook from the free list.  */
+      ASAN_UNPOISON_CONS (&cblk->conses[0]);
+      cons_free_list = cblk->conses[0].u.s.u.chain;
+      lisp_align_free (cblk);
+      return cprev;
+    }
+  *num_free += this_free;
+  return &cblk->next;
+}
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_conses (void)
@@ -7559,74 +9270,93 @@ sweep_conses (void)
 
   cons_free_list = 0;
 
-  for (struct cons_block *cblk; (cblk = *cprev); )
+  if (gc_lazy_sweep && !gc_releasing_memory)
     {
-      int i = 0;
-      int this_free = 0;
-      int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+      /* Just count, and leave the rest to sweep_some_conses.  */
+      for (struct cons_block *cblk = cons_block; cblk; cblk = cblk->next)
+	{
+	  int used = count_mark_bits (cblk->gcmarkbits, lim);
+	  num_used += used;
+	  num_free += lim - used;
+	  cblk->dirty = false;
+	  cblk->swept = false;
+	  lim = CONS_BLOCK_SIZE;
+	}
+      cons_sweep_next = cons_block ? &cons_block : NULL;
+      cons_sweep_free = 0;
+    }
+  else
+    while (*cprev)
+      {
+	(*cprev)->dirty = false;
+	cprev = sweep_cons_block (cprev, lim, &num_free, &num_used);
+	lim = CONS_BLOCK_SIZE;
+      }
+  gcstat.total_conses = num_used;
+  gcstat.total_free_conses = num_free;
+}
 
-      /* Scan the mark bits an int at a time.  */
-      for (i = 0; i < ilim; i++)
-        {
-          if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
-            {
-              /* Fast path - all cons cells for this int are marked.  */
-              cblk->gcmarkbits[i] = 0;
-              num_used += BITS_PER_BITS_WORD;
-            }
-          else
-            {
-              /* Some cons cells for this int are not marked.
-                 Find which ones, and free them.  */
-              int start, pos, stop;
+/* Sweep the cons blocks that the last collection left unswept, until
+   some conses are free or, if ALL, until none are left.  The blocks
+   are swept in order, so that all but the current block have all their
+   conses allocated, and cons_block_index has not changed since.  */
 
-              start = i * BITS_PER_BITS_WORD;
-              stop = lim - start;
-              if (stop > BITS_PER_BITS_WORD)
-                stop = BITS_PER_BITS_WORD;
-              stop += start;
+static void
+sweep_some_conses (bool all)
+{
+  object_ct num_used = 0;
+  while (cons_sweep_next && (all || !cons_free_list))
+    {
+      int lim = (*cons_sweep_next == cons_block
+		 ? cons_block_index : CONS_BLOCK_SIZE);
+      cons_sweep_next = sweep_cons_block (cons_sweep_next, lim,
+					  &cons_sweep_free, &num_used);
+      if (!*cons_sweep_next)
+	cons_sweep_next = NULL;
+    }
+}
 
-              for (pos = start; pos < stop; pos++)
-                {
-		  struct Lisp_Cons *acons = &cblk->conses[pos];
-		  if (!XCONS_MARKED_P (acons))
-                    {
-		      ASAN_UNPOISON_CONS (&cblk->conses[pos]);
-                      this_free++;
-                      cblk->conses[pos].u.s.u.chain = cons_free_list;
-                      cons_free_list = &cblk->conses[pos];
-                      cons_free_list->u.s.car = dead_object ();
-		      ASAN_POISON_CONS (&cblk->conses[pos]);
-		    }
-                  else
-                    {
-                      num_used++;
-		      XUNMARK_CONS (acons);
-                    }
-                }
-            }
-        }
+/* Sweep the float block *FPREV, like sweep_cons_block.  */
 
-      lim = CONS_BLOCK_SIZE;
-      /* If this block contains only free conses and we have already
-         seen more than two blocks worth of free conses then deallocate
-         this block.  */
-      if (this_free == CONS_BLOCK_SIZE && num_free > CONS_BLOCK_SIZE)
-        {
-          *cprev = cblk->next;
-          /* Unhook from the free list.  */
-	  ASAN_UNPOISON_CONS (&cblk->conses[0]);
-          cons_free_list = cblk->conses[0].u.s.u.chain;
-          lisp_align_free (cblk);
-        }
+static struct float_block **
+sweep_float_block (struct float_block **fprev, int lim,
+		   object_ct *num_free, object_ct *num_used)
+{
+  struct float_block *fblk = *fprev;
+  int this_free = 0;
+  ASAN_UNPOISON_FLOAT_BLOCK (fblk);
+  for (int i = 0; i < lim; i++)
+    {
+      struct Lisp_Float *afloat = &fblk->floats[i];
+      if (!XFLOAT_MARKED_P (afloat))
+	{
+	  this_free++;
+	  fblk->floats[i].u.chain = float_free_list;
+	  ASAN_POISON_FLOAT (&fblk->floats[i]);
+	  float_free_list = &fblk->floats[i];
+	}
       else
-        {
-          num_free += this_free;
-          cprev = &cblk->next;
-        }
+	{
+	  (*num_used)++;
+	  if (!gc_old_conses_marked)
+	    XFLOAT_UNMARK (afloat);
+	}
     }
-  gcstat.total_conses = num_used;
-  gcstat.total_free_conses = num_free;
+  /* If this block contains only free floats and we have already
+     seen more than two blocks worth of free floats then deallocate
+     this block.  */
+  if (this_free == FLOAT_BLOCK_SIZE
+      && (*num_free > FLOAT_BLOCK_SIZE || gc_releasing_memory))
+    {
+      *fprev = fblk->next;
+      /* Unhook from the free list.  */
+      ASAN_UNPOISON_FLOAT (&fblk->floats[0]);
+      float_free_list = fblk->floats[0].u.chain;
+      lisp_align_free (fblk);
+      return fprev;
+    }
+  *num_free += this_free;
+  return &fblk->next;
 }
 
 NO_INLINE /* For better stack traces */
@@ -7639,48 +9369,58 @@ sweep_floats (void)
 
   float_free_list = 0;
 
-  for (struct float_block *fblk; (fblk = *fprev); )
+  if (gc_lazy_sweep && !gc_releasing_memory)
     {
-      int this_free = 0;
-      ASAN_UNPOISON_FLOAT_BLOCK (fblk);
-      for (int i = 0; i < lim; i++)
+      /* Just count, and leave the rest to sweep_some_floats.  */
+      for (struct float_block *fblk = float_block; fblk; fblk = fblk->next)
 	{
-	  struct Lisp_Float *afloat = &fblk->floats[i];
-	  if (!XFLOAT_MARKED_P (afloat))
-	    {
-	      this_free++;
-	      fblk->floats[i].u.chain = float_free_list;
-	      ASAN_POISON_FLOAT (&fblk->floats[i]);
-	      float_free_list = &fblk->floats[i];
-	    }
-	  else
-	    {
-	      num_used++;
-	      XFLOAT_UNMARK (afloat);
-	    }
+	  int used = count_mark_bits (fblk->gcmarkbits, lim);
+	  num_used += used;
+	  num_free += lim - used;
+	  lim = FLOAT_BLOCK_SIZE;
 	}
-      lim = FLOAT_BLOCK_SIZE;
-      /* If this block contains only free floats and we have already
-         seen more than two blocks worth of free floats then deallocate
-         this block.  */
-      if (this_free == FLOAT_BLOCK_SIZE && num_free > FLOAT_BLOCK_SIZE)
-        {
-          *fprev = fblk->next;
-          /* Unhook from the free list.  */
-	  ASAN_UNPOISON_FLOAT (&fblk->floats[0]);
-	  float_free_list = fblk->floats[0].u.chain;
-          lisp_align_free (fblk);
-        }
-      else
-        {
-          num_free += this_free;
-          fprev = &fblk->next;
-        }
+      float_sweep_next = float_block ? &float_block : NULL;
+      float_sweep_free = 0;
     }
+  else
+    while (*fprev)
+      {
+	fprev = sweep_float_block (fprev, lim, &num_free, &num_used);
+	lim = FLOAT_BLOCK_SIZE;
+      }
   gcstat.total_floats = num_used;
   gcstat.total_free_floats = num_free;
 }
 
+/* Sweep the float blocks that the last collection left unswept, like
+   sweep_some_conses.  */
+
+static void
+sweep_some_floats (bool all)
+{
+  object_ct num_used = 0;
+  while (float_sweep_next && (all || !float_free_list))
+    {
+      int lim = (*float_sweep_next == float_block
+		 ? float_block_index : FLOAT_BLOCK_SIZE);
+      float_sweep_next = sweep_float_block (float_sweep_next, lim,
+					    &float_sweep_free, &num_used);
+      if (!*float_sweep_next)
+	float_sweep_next = NULL;
+    }
+}
+
+/* Sweep what the last collection left unswept.  Called before marking
+   anything, since the blocks left unswept hold the marks of the last
+   collection.  */
+
+static void
+finish_lazy_sweep (void)
+{
+  sweep_some_conses (true);
+  sweep_some_floats (true);
+}
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_intervals (void)
@@ -7714,7 +9454,8 @@ sweep_intervals (void)
       /* If this block contains only free intervals and we have already
          seen more than two blocks worth of free intervals then
          deallocate this block.  */
-      if (this_free == INTERVAL_BLOCK_SIZE && num_free > INTERVAL_BLOCK_SIZE)
+      if (this_free == INTERVAL_BLOCK_SIZE
+	  && (num_free > INTERVAL_BLOCK_SIZE || gc_releasing_memory))
         {
           *iprev = iblk->next;
           /* Unhook from the free list.  */
@@ -7744,7 +9485,11 @@ sweep_symbols (void)
   symbol_free_list = NULL;
 
   for (int i = 0; i < ARRAYELTS (lispsym); i++)
-    lispsym[i].u.s.gcmarkbit = 0;
+    {
+      lispsym[i].u.s.gcmarkbit = 0;
+      if (gc_old_conses_marked)
+	note_surviving_object (make_lisp_symbol (&lispsym[i]));
+    }
 
   for (sblk = symbol_block; sblk; sblk = *sprev)
     {
@@ -7778,6 +9523,8 @@ sweep_symbols (void)
             {
               ++num_used;
               sym->u.s.gcmarkbit = 0;
+	      if (gc_old_conses_marked)
+		note_surviving_object (make_lisp_symbol (sym));
               /* Attempt to catch bogus objects.  */
               eassert (valid_lisp_object_p (sym->u.s.function));
             }
@@ -7787,7 +9534,8 @@ sweep_symbols (void)
       /* If this block contains only free symbols and we have already
          seen more than two blocks worth of free symbols then deallocate
          this block.  */
-      if (this_free == SYMBOL_BLOCK_SIZE && num_free > SYMBOL_BLOCK_SIZE)
+      if (this_free == SYMBOL_BLOCK_SIZE
+	  && (num_free > SYMBOL_BLOCK_SIZE || gc_releasing_memory))
         {
           *sprev = sblk->next;
           /* Unhook from the free list.  */
@@ -7806,7 +9554,8 @@ sweep_symbols (void)
 }
 
 /* Remove BUFFER's markers that are due to be swept.  This is needed since
-   we treat BUF_MARKERS and markers's `next' field as weak pointers.  */
+   we treat BUF_MARKERS, markers's `next' field and their tree as weak
+   pointers.  */
 static void
 unchain_dead_markers (struct buffer *buffer)
 {
@@ -7817,6 +9566,7 @@ unchain_dead_markers (struct buffer *buffer)
       prev = &this->next;
     else
       {
+        marker_tree_remove (this);
         this->buffer = NULL;
         *prev = this->next;
       }
@@ -7839,20 +9589,96 @@ sweep_buffers (void)
     }
 }
 
-/* Sweep: find all structures not marked, and free them.  */
+/* A minor collection frees no object other than conses and floats, so
+   count those allocated since the last collection as live.  */
+
+static void
+count_young_objects (void)
+{
+  object_ct symbols = max (0, symbols_consed - consed_at_last_gc.symbols);
+  gcstat.total_symbols += symbols;
+  gcstat.total_free_symbols = max (0, gcstat.total_free_symbols - symbols);
+  object_ct strings = max (0, strings_consed - consed_at_last_gc.strings);
+  gcstat.total_strings += strings;
+  gcstat.total_free_strings = max (0, gcstat.total_free_strings - strings);
+  gcstat.total_string_bytes
+    += max (0, string_chars_consed - consed_at_last_gc.string_chars);
+  object_ct intervals = max (0, (intervals_consed
+				 - consed_at_last_gc.intervals));
+  gcstat.total_intervals += intervals;
+  gcstat.total_free_intervals = max (0, (gcstat.total_free_intervals
+					 - intervals));
+  gcstat.total_vectors += young_objects.count;
+  gcstat.total_vector_slots += ((vector_bytes_consed
+				 - consed_at_last_gc.vector_bytes)
+				/ word_size);
+  gcstat.total_hash_table_bytes = hash_table_allocated_bytes;
+}
+
+/* Sweep: find all structures not marked, and free them.  A minor
+   collection frees only conses and floats.  */
 static void
-gc_sweep (void)
+gc_sweep (bool minor)
 {
-  sweep_strings ();
-  check_string_bytes (!noninteractive);
+  /* The objects in allocation buffers are not marked, so the sweep
+     puts them back on the shared free lists.  */
+  for (struct thread_state *t = all_threads; t; t = t->next_thread)
+    {
+      t->cons_buffer = NULL;
+      t->float_buffer = NULL;
+    }
+  /* If generational, the conses and floats that survive stay marked,
+     and are old to the next collection.  The lazy sweep of the blocks
+     left unswept must do the same, even if gc_generational changes
+     meanwhile.  */
+  gc_old_conses_marked = gc_generational;
+
+  /* The objects allocated since the last collection are old to the
+     next one.  After a full collection, the sweeps below record which
+     of the survivors minor collections must still look inside.  */
+  if (minor)
+    {
+      count_young_objects ();
+      if (young_objects.slots)
+	for (ptrdiff_t i = 0; i < (ptrdiff_t) 1 << young_objects.bits; i++)
+	  if (!NILP (young_objects.slots[i]))
+	    note_surviving_object (young_objects.slots[i]);
+    }
+  else
+    {
+      object_set_clear (&traced_objects);
+      remembered_objects_lost = false;
+    }
+  object_set_clear (&young_objects);
+  object_set_clear (&remembered_objects);
+
+  if (!minor)
+    {
+      sweep_strings ();
+      check_string_bytes (!noninteractive);
+    }
   sweep_conses ();
   sweep_floats ();
-  sweep_intervals ();
-  sweep_symbols ();
+  if (!minor)
+    {
+      sweep_intervals ();
+      sweep_symbols ();
+    }
   sweep_buffers ();
-  sweep_vectors ();
-  pdumper_clear_marks ();
+  if (!minor)
+    {
+      sweep_vectors ();
+      pdumper_clear_marks ();
+      if (gc_old_conses_marked)
+	pdumper_visit_live_objects (note_surviving_object);
+    }
   check_string_bytes (!noninteractive);
+
+  consed_at_last_gc.symbols = symbols_consed;
+  consed_at_last_gc.strings = strings_consed;
+  consed_at_last_gc.string_chars = string_chars_consed;
+  consed_at_last_gc.intervals = intervals_consed;
+  consed_at_last_gc.vector_bytes = vector_bytes_consed;
 }
 
 DEFUN ("memory-info", Fmemory_info, Smemory_info, 0, 0, 0,
@@ -8131,7 +9957,10 @@ init_alloc_once_for_pdumper (void)
 init_alloc (void)
 {
   Vgc_elapsed = make_float (0.0);
+  Vgc_mark_elapsed = make_float (0.0);
+  Vgc_sweep_elapsed = make_float (0.0);
   gcs_done = 0;
+  minor_gcs_done = 0;
 }
 
 void
@@ -8165,6 +9994,54 @@ syms_of_alloc (void)
 If this portion is smaller than `gc-cons-threshold', this is ignored.  */);
   Vgc_cons_percentage = make_float (0.1);
 
+  DEFVAR_BOOL ("gc-generational", gc_generational,
+	       doc: /* Non-nil means most automatic garbage collections are minor.
+A minor collection frees only the cons cells and floats allocated since
+the previous collection.  It looks inside older objects only where they
+were changed to point to newer cons cells or floats, and inside those
+whose contents change too often to keep track of, such as buffers and
+hash tables.  It is therefore much faster than a full collection when
+many long-lived objects are in use, but it frees no other kind of
+object.  A full collection happens once the heap has grown by half since
+the previous full one, or when `garbage-collect' is called.  */);
+  gc_generational = false;
+
+  DEFVAR_BOOL ("gc-incremental", gc_incremental,
+	       doc: /* Non-nil means automatic full garbage collections are incremental.
+An incremental collection first marks the cons cells and floats in use
+in slices, between which Lisp keeps running; see `gc-incremental-slice'.
+Slices happen as Lisp allocates, and while Emacs waits for input.  The
+collection then finishes like a full one, except that it does not look
+again at the cons cells that the slices marked, unless Lisp changed
+them since, so that Emacs pauses less when many of them are in use.
+Strings, vectors, symbols and other objects are not marked in slices:
+the pause that finishes the collection marks all of them.  */);
+  gc_incremental = false;
+
+  DEFVAR_LISP ("gc-incremental-slice", Vgc_incremental_slice,
+	       doc: /* Maximum duration in seconds of a slice of incremental collection.
+See `gc-incremental'.  */);
+  Vgc_incremental_slice = make_float (0.002);
+
+  DEFVAR_BOOL ("gc-lazy-sweep", gc_lazy_sweep,
+	       doc: /* Non-nil means garbage collections sweep cons cells and floats lazily.
+A collection then only counts the cons cells and floats in use, and
+leaves freeing the others to when Lisp allocates new ones, a block at a
+time, so that Emacs pauses for less time when many of them exist.
+Other kinds of objects are always freed during the collection.  */);
+  gc_lazy_sweep = false;
+
+  DEFVAR_INT ("gc-mark-threads", gc_mark_threads,
+	      doc: /* Number of threads that mark objects during garbage collection.
+If this is greater than 1, full collections that are not incremental
+first mark the objects reachable from global variables with that many
+threads, before marking everything else in the main thread.  The
+threads leave buffers, weak hash tables, strings with text properties
+and other objects whose marking has side effects to the main thread.
+Values above 64 count as 64.  This has no effect if Emacs was built
+without thread support.  */);
+  gc_mark_threads = 1;
+
   DEFVAR_INT ("pure-bytes-used", pure_bytes_used,
 	      doc: /* Number of bytes of shareable Lisp data allocated so far.  */);
 
@@ -8233,6 +10110,11 @@ syms_of_alloc (void)
   DEFSYM (Qheap, "heap");
   DEFSYM (QAutomatic_GC, "Automatic GC");
 
+  DEFSYM (Qexplicit, "explicit");
+  DEFSYM (Qthreshold, "threshold");
+  DEFSYM (Qincremental, "incremental");
+  DEFSYM (Qrelease_memory, "release-memory");
+
   DEFSYM (Qgc_cons_percentage, "gc-cons-percentage");
   DEFSYM (Qgc_cons_threshold, "gc-cons-threshold");
   DEFSYM (Qchar_table_extra_slots, "char-table-extra-slots");
@@ -8240,9 +10122,24 @@ syms_of_alloc (void)
   DEFVAR_LISP ("gc-elapsed", Vgc_elapsed,
 	       doc: /* Accumulated time elapsed in garbage collections.
 The time is in seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-mark-elapsed", Vgc_mark_elapsed,
+	       doc: /* Accumulated time elapsed marking in garbage collections.
+This is the part of `gc-elapsed' spent finding the objects in use,
+including the slices of incremental collections.  The time is in
+seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-sweep-elapsed", Vgc_sweep_elapsed,
+	       doc: /* Accumulated time elapsed sweeping in garbage collections.
+This is the part of `gc-elapsed' spent freeing the objects not in use.
+It does not include the cons cells and floats swept lazily after a
+collection; see `gc-lazy-sweep'.  The time is in seconds as a floating
+point value.  */);
   DEFVAR_INT ("gcs-done", gcs_done,
               doc: /* Accumulated number of garbage collections done.  */);
 
+  DEFVAR_INT ("minor-gcs-done", minor_gcs_done,
+	      doc: /* Accumulated number of minor garbage collections done.
+These are also counted in `gcs-done'.  See `gc-generational'.  */);
+
   DEFVAR_INT ("integer-width", integer_width,
 	      doc: /* Maximum number N of bits in safely-calculated integers.
 Integers with absolute values less than 2**N do not signal a range error.
@@ -8265,6 +10162,8 @@ syms_of_alloc (void)
   defsubr (&Smake_finalizer);
   defsubr (&Spurecopy);
   defsubr (&Sgarbage_collect);
+  defsubr (&Sgarbage_collect_release_memory);
+  defsubr (&Sgc_log_entry);
   defsubr (&Sgarbage_collect_maybe);
   defsubr (&Smemory_info);
   defsubr (&Smemory_use_counts);
@@ -36,6 +36,7 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 #include "character.h"
 #include "buffer.h"
 #include "region-cache.h"
+#include "line-index.h"
 #include "indent.h"
 #include "blockinput.h"
 #include "keymap.h"
@@ -638,6 +639,8 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = 0;
+  b->syntax_ppss_cache = 0;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -660,6 +663,8 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
 
   bset_mark (b, Fmake_marker ());
   BUF_MARKERS (b) = NULL;
+  BUF_MARKER_TREE (b) = NULL;
+  BUF_MARKER_OTICK (b) = 0;
 
   /* Put this in the alist of all live buffers.  */
   XSETBUFFER (buffer, b);
@@ -730,7 +735,7 @@ clone_per_buffer_values (struct buffer *from, struct buffer *to)
 	{
 	  struct Lisp_Marker *m = XMARKER (obj);
 
-	  obj = build_marker (to, m->charpos, m->bytepos);
+	  obj = build_marker (to, marker_charpos (m), marker_bytepos (m));
 	  XMARKER (obj)->insertion_type = m->insertion_type;
 	}
 
@@ -865,6 +870,8 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = 0;
+  b->syntax_ppss_cache = 0;
   bset_width_table (b, Qnil);
 
   name = Fcopy_sequence (name);
@@ -2079,6 +2086,7 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
 	{
 	  if (m->buffer == b)
 	    {
+	      marker_tree_remove (m);
 	      m->buffer = NULL;
 	      *mp = m->next;
 	    }
@@ -2098,6 +2106,7 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
     {
       /* Unchain all markers of this buffer and its indirect buffers.
 	 and leave them pointing nowhere.  */
+      marker_tree_clear (b);
       for (m = BUF_MARKERS (b); m; )
 	{
 	  struct Lisp_Marker *next = m->next;
@@ -2155,6 +2164,13 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
       free_region_cache (b->bidi_paragraph_cache);
       b->bidi_paragraph_cache = 0;
     }
+  if (b->line_index)
+    {
+      free_line_index (b->line_index);
+      b->line_index = 0;
+    }
+  if (b->syntax_ppss_cache)
+    free_syntax_ppss_cache (b);
   bset_width_table (b, Qnil);
   unblock_input ();
 
@@ -2598,6 +2614,8 @@ #define swapfield_(field, type) \
   swapfield (newline_cache, struct region_cache *);
   swapfield (width_run_cache, struct region_cache *);
   swapfield (bidi_paragraph_cache, struct region_cache *);
+  swapfield (line_index, struct line_index *);
+  swapfield (syntax_ppss_cache, struct syntax_ppss_cache *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
   swapfield (long_line_optimizations_p, bool_bf);
@@ -2756,6 +2774,9 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
       TEMP_SET_PT_BOTH (PT_BYTE, PT_BYTE);
 
 
+      /* This keeps the markers in order, so they can be moved
+	 without rearranging their tree.  */
+      marker_tree_validate_all (current_buffer);
       for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
 	tail->charpos = tail->bytepos;
 
@@ -2907,6 +2928,7 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
 	TEMP_SET_PT_BOTH (position, byte);
       }
 
+      marker_tree_validate_all (current_buffer);
       tail = markers = BUF_MARKERS (current_buffer);
 
       /* This prevents BYTE_TO_CHAR (that is, buf_bytepos_to_charpos) from
@@ -3533,21 +3555,23 @@ adjust_overlays_for_delete_in_buffer (struct buffer * buf,
   Lisp_Object hit_list = Qnil;
   struct itree_node *node;
 
-  /* Ideally, the evaporate check would be done directly within
-     `itree_delete_gap`, but that code isn't supposed to know about overlays,
-     only about `itree_node`s, so it would break an abstraction boundary.  */
-  itree_delete_gap (buf->overlays, pos, length);
-
-  /* Delete any zero-sized overlays at position POS, if the `evaporate'
-     property is set.  */
-
-  ITREE_FOREACH (node, buf->overlays, pos, pos, ASCENDING)
+  /* Find the overlays that this deletion will make empty, and that
+     have the `evaporate' property.  Any other empty overlay at POS
+     either was already empty, and then doesn't have that property
+     (see `Foverlay_put' and `Fmove_overlay'), or was inside the
+     deleted text, and so need not be visited: there can be very many
+     of them, and `itree_delete_gap' moves them all at once.  */
+  ITREE_FOREACH_OVERLAPPING (node, buf->overlays, pos, pos + length,
+			     ASCENDING)
     {
-      if (node->end == pos && node->begin == pos
-          && ! NILP (Foverlay_get (node->data, Qevaporate)))
-        hit_list = Fcons (node->data, hit_list);
+      if (pos <= node->begin && node->begin < node->end
+	  && node->end <= pos + length
+	  && ! NILP (Foverlay_get (node->data, Qevaporate)))
+	hit_list = Fcons (node->data, hit_list);
     }
 
+  itree_delete_gap (buf->overlays, pos, length);
+
   for (; CONSP (hit_list); hit_list = XCDR (hit_list))
     Fdelete_overlay (XCAR (hit_list));
 }
@@ -4109,10 +4133,12 @@ report_overlay_modification (Lisp_Object start, Lisp_Object end, bool after,
 
       if (! current_buffer->overlays)
         return;
-      ITREE_FOREACH (node, current_buffer->overlays,
-                     begin_arg - (insertion ? 1 : 0),
-                     end_arg   + (insertion ? 1 : 0),
-                     ASCENDING)
+      /* The empty overlays at the start of this range can't be
+	 affected, and there can be very many of them.  */
+      ITREE_FOREACH_OVERLAPPING (node, current_buffer->overlays,
+				 begin_arg - (insertion ? 1 : 0),
+				 end_arg   + (insertion ? 1 : 0),
+				 ASCENDING)
 	{
           Lisp_Object overlay = node->data;
 	  ptrdiff_t obegin = OVERLAY_START (overlay);
@@ -5023,7 +5049,7 @@ defvar_per_buffer (struct Lisp_Buffer_Objfwd *bo_fwd, const char *namestring,
 static Lisp_Object
 make_lispy_itree_node (const struct itree_node *node)
 {
-  return listn (12,
+  return listn (14,
                 intern (":begin"),
                 make_fixnum (node->begin),
                 intern (":end"),
@@ -5032,6 +5058,9 @@ make_lispy_itree_node (const struct itree_node *node)
                 make_fixnum (node->limit),
                 intern (":offset"),
                 make_fixnum (node->offset),
+                intern (":clamp"),
+                (node->clamp == PTRDIFF_MIN
+                 ? Qnil : make_fixnum (node->clamp)),
                 intern (":rear-advance"),
                 node->rear_advance ? Qt : Qnil,
                 intern (":front-advance"),
@@ -5782,6 +5811,10 @@ from (abs POSITION).  If POSITION is positive, point was at the front
 results of these scans are cached.  This doesn't help too much if
 paragraphs are of the reasonable (few thousands of characters) size.
 
+In large buffers, `cache-long-scans' also lets Emacs keep an index of
+the number of lines in each part of the buffer, which makes finding
+line numbers and moving over many lines fast.
+
 The caches require no explicit maintenance; their accuracy is
 maintained internally by the Emacs primitives.  Enabling or disabling
 the cache should not affect the behavior of any of the motion
@@ -141,6 +141,10 @@ #define BUF_COMPACT(buf) ((buf)->text->compact)
 /* Marker chain of buffer.  */
 #define BUF_MARKERS(buf) ((buf)->text->markers)
 
+/* Root of the tree of the markers of buffer, and its otick.  */
+#define BUF_MARKER_TREE(buf) ((buf)->text->marker_tree)
+#define BUF_MARKER_OTICK(buf) ((buf)->text->marker_otick)
+
 #define BUF_UNCHANGED_MODIFIED(buf) \
   ((buf)->text->unchanged_modified)
 
@@ -280,6 +284,14 @@ #define FETCH_BYTE(n) (*BYTE_POS_ADDR (n))
        to move a marker within a buffer.  */
     struct Lisp_Marker *markers;
 
+    /* The same markers, in a red-black tree ordered by position.  */
+    struct Lisp_Marker *marker_tree;
+
+    /* Incremented each time the offsets of some markers in
+       MARKER_TREE change, which makes the positions of all the
+       markers possibly out of date; see marker.c.  */
+    uintmax_t marker_otick;
+
     /* Usually false.  Temporarily true in decode_coding_gap to
        prevent Fgarbage_collect from shrinking the gap and losing
        not-yet-decoded bytes.  */
@@ -679,6 +691,17 @@ #define BVAR(buf, field) ((buf)->field ## _)
   struct region_cache *width_run_cache;
   struct region_cache *bidi_paragraph_cache;
 
+  /* If cache-long-scans is non-nil and a long scan for newlines has
+     been made, the line index records how many newlines each part of
+     the buffer has, so that line numbers and the positions of lines
+     can be found quickly.  See line-index.h.  */
+  struct line_index *line_index;
+
+  /* If syntax-ppss has been used, the states of the parse from the
+     beginning of the buffer to positions a few kilobytes apart.  See
+     syntax.c.  */
+  struct syntax_ppss_cache *syntax_ppss_cache;
+
   /* Non-zero means disable redisplay optimizations when rebuilding the glyph
      matrices (but not when redrawing).  */
   bool_bf prevent_redisplay_optimizations_p : 1;
@@ -1393,6 +1416,27 @@ buffer_window_count (struct buffer *b)
   return b->window_count;
 }
 
+/* Markers */
+
+/* Return the char position of marker M, which must point somewhere,
+   or have been detached from its buffer.  */
+INLINE ptrdiff_t
+marker_charpos (struct Lisp_Marker *m)
+{
+  if (m->buffer && m->otick != BUF_MARKER_OTICK (m->buffer))
+    marker_tree_validate (m);
+  return m->charpos;
+}
+
+/* Return the byte position of marker M.  */
+INLINE ptrdiff_t
+marker_bytepos (struct Lisp_Marker *m)
+{
+  if (m->buffer && m->otick != BUF_MARKER_OTICK (m->buffer))
+    marker_tree_validate (m);
+  return m->bytepos;
+}
+
 /* Overlays */
 
 INLINE ptrdiff_t
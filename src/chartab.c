@@ -93,11 +93,13 @@ CHECK_CHAR_TABLE (Lisp_Object x)
 set_char_table_ascii (Lisp_Object table, Lisp_Object val)
 {
   XCHAR_TABLE (table)->ascii = val;
+  note_object_store (table, val);
 }
 static void
 set_char_table_parent (Lisp_Object table, Lisp_Object val)
 {
   XCHAR_TABLE (table)->parent = val;
+  note_object_store (table, val);
 }
 
 DEFUN ("make-char-table", Fmake_char_table, Smake_char_table, 1, 2, 0,
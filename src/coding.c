@@ -8121,7 +8121,7 @@ decode_coding_object (struct coding_system *coding,
 	  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
 	    {
 	      tail->need_adjustment
-		= tail->charpos == (tail->insertion_type ? from : to);
+		= marker_charpos (tail) == (tail->insertion_type ? from : to);
 	      need_marker_adjustment |= tail->need_adjustment;
 	    }
 	  saved_pt = PT, saved_pt_byte = PT_BYTE;
@@ -8255,17 +8255,14 @@ decode_coding_object (struct coding_system *coding,
 	      {
 		tail->need_adjustment = 0;
 		if (tail->insertion_type)
-		  {
-		    tail->bytepos = from_byte;
-		    tail->charpos = from;
-		  }
+		  marker_tree_move (tail, from, from_byte);
 		else
-		  {
-		    tail->bytepos = from_byte + coding->produced;
-		    tail->charpos
-		      = (NILP (BVAR (current_buffer, enable_multibyte_characters))
-			 ? tail->bytepos : from + coding->produced_char);
-		  }
+		  marker_tree_move
+		    (tail,
+		     (NILP (BVAR (current_buffer, enable_multibyte_characters))
+		      ? from_byte + coding->produced
+		      : from + coding->produced_char),
+		     from_byte + coding->produced);
 	      }
 	}
     }
@@ -8343,7 +8340,7 @@ encode_coding_object (struct coding_system *coding,
       for (tail = BUF_MARKERS (XBUFFER (src_object)); tail; tail = tail->next)
 	{
 	  tail->need_adjustment
-	    = tail->charpos == (tail->insertion_type ? from : to);
+	    = marker_charpos (tail) == (tail->insertion_type ? from : to);
 	  need_marker_adjustment |= tail->need_adjustment;
 	}
     }
@@ -8510,17 +8507,14 @@ encode_coding_object (struct coding_system *coding,
 	      {
 		tail->need_adjustment = 0;
 		if (tail->insertion_type)
-		  {
-		    tail->bytepos = from_byte;
-		    tail->charpos = from;
-		  }
+		  marker_tree_move (tail, from, from_byte);
 		else
-		  {
-		    tail->bytepos = from_byte + coding->produced;
-		    tail->charpos
-		      = (NILP (BVAR (current_buffer, enable_multibyte_characters))
-			 ? tail->bytepos : from + coding->produced_char);
-		  }
+		  marker_tree_move
+		    (tail,
+		     (NILP (BVAR (current_buffer, enable_multibyte_characters))
+		      ? from_byte + coding->produced
+		      : from + coding->produced_char),
+		     from_byte + coding->produced);
 	      }
 	}
     }
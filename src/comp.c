@@ -469,7 +469,7 @@ load_gccjit_if_necessary (bool mandatory)
 
 
 /* Increase this number to force a new Vcomp_abi_hash to be generated.  */
-#define ABI_VERSION "6"
+#define ABI_VERSION "7"
 
 /* Length of the hashes used for eln file naming.  */
 #define HASH_LENGTH 8
@@ -703,6 +703,7 @@ #define F_RELOC_MAX_SIZE 1600
 helper_GET_SYMBOL_WITH_POSITION (Lisp_Object);
 static Lisp_Object
 helper_sanitizer_assert (Lisp_Object, Lisp_Object);
+static void helper_note_cons_store (Lisp_Object, Lisp_Object);
 
 /* Note: helper_link_table must match the list created by
    `declare_runtime_imported_funcs'.  */
@@ -721,7 +722,8 @@ helper_sanitizer_assert (Lisp_Object, Lisp_Object);
     helper_unwind_protect,
     specbind,
     maybe_gc,
-    maybe_quit };
+    maybe_quit,
+    helper_note_cons_store };
 
 
 static char * ATTRIBUTE_FORMAT_PRINTF (1, 2)
@@ -1961,11 +1963,22 @@ emit_cdr_addr (gcc_jit_rvalue *c)
   return gcc_jit_lvalue_get_address (emit_lval_XCDR (c), NULL);
 }
 
+static void
+emit_note_cons_store (gcc_jit_rvalue *c, gcc_jit_rvalue *n)
+{
+  gcc_jit_rvalue *args[] = { c, n };
+
+  gcc_jit_block_add_eval (comp.block, NULL,
+			  emit_call (intern_c_string ("helper_note_cons_store"),
+				     comp.void_type, 2, args, false));
+}
+
 static void
 emit_XSETCAR (gcc_jit_rvalue *c, gcc_jit_rvalue *n)
 {
   emit_comment ("XSETCAR");
 
+  emit_note_cons_store (c, n);
   gcc_jit_block_add_assignment (
     comp.block,
     NULL,
@@ -1980,6 +1993,7 @@ emit_XSETCDR (gcc_jit_rvalue *c, gcc_jit_rvalue *n)
 {
   emit_comment ("XSETCDR");
 
+  emit_note_cons_store (c, n);
   gcc_jit_block_add_assignment (
     comp.block,
     NULL,
@@ -3000,6 +3014,9 @@ #define ADD_IMPORTED(f_name, ret_type, nargs, args)			       \
 
   ADD_IMPORTED (maybe_quit, comp.void_type, 0, NULL);
 
+  args[0] = args[1] = comp.lisp_obj_type;
+  ADD_IMPORTED (helper_note_cons_store, comp.void_type, 2, args);
+
 #undef ADD_IMPORTED
 
   return Freverse (field_list);
@@ -5092,6 +5109,12 @@ helper_GET_SYMBOL_WITH_POSITION (Lisp_Object a)
   return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Symbol_With_Pos);
 }
 
+static void
+helper_note_cons_store (Lisp_Object c, Lisp_Object n)
+{
+  note_cons_store (c, n);
+}
+
 static Lisp_Object
 helper_sanitizer_assert (Lisp_Object val, Lisp_Object type)
 {
@@ -262,6 +262,8 @@ DEFUN ("cl-type-of", Fcl_type_of, Scl_type_of, 1, 1, 0,
         case PVEC_THREAD: return Qthread;
         case PVEC_MUTEX: return Qmutex;
         case PVEC_CONDVAR: return Qcondition_variable;
+        case PVEC_CHANNEL: return Qchannel;
+        case PVEC_ASYNC_FUTURE: return Qasync_future;
         case PVEC_TERMINAL: return Qterminal;
         case PVEC_RECORD:
           {
@@ -650,6 +652,24 @@ DEFUN ("condition-variable-p", Fcondition_variable_p, Scondition_variable_p,
     return Qt;
   return Qnil;
 }
+
+DEFUN ("channelp", Fchannelp, Schannelp, 1, 1, 0,
+       doc: /* Return t if OBJECT is a channel.  */)
+  (Lisp_Object object)
+{
+  if (CHANNELP (object))
+    return Qt;
+  return Qnil;
+}
+
+DEFUN ("async-future-p", Fasync_future_p, Sasync_future_p, 1, 1, 0,
+       doc: /* Return t if OBJECT is an async future.  */)
+  (Lisp_Object object)
+{
+  if (ASYNC_FUTUREP (object))
+    return Qt;
+  return Qnil;
+}
 
 /* Extract and set components of lists.  */
 
@@ -4198,6 +4218,8 @@ #define PUT_ERROR(sym, tail, msg)			\
   DEFSYM (Qthread, "thread");
   DEFSYM (Qmutex, "mutex");
   DEFSYM (Qcondition_variable, "condition-variable");
+  DEFSYM (Qchannel, "channel");
+  DEFSYM (Qasync_future, "async-future");
   DEFSYM (Qfont_spec, "font-spec");
   DEFSYM (Qfont_entity, "font-entity");
   DEFSYM (Qfont_object, "font-object");
@@ -4258,6 +4280,8 @@ #define PUT_ERROR(sym, tail, msg)			\
   defsubr (&Sthreadp);
   defsubr (&Smutexp);
   defsubr (&Scondition_variable_p);
+  defsubr (&Schannelp);
+  defsubr (&Sasync_future_p);
   defsubr (&Scar);
   defsubr (&Scdr);
   defsubr (&Scar_safe);
@@ -38,7 +38,7 @@ atimer.o:
  globals.h ../lib/unistd.h msdos.h $(config_h)
 bidi.o: bidi.c buffer.h character.h dispextern.h msdos.h lisp.h \
    globals.h $(config_h)
-buffer.o: buffer.c buffer.h region-cache.h commands.h window.h \
+buffer.o: buffer.c buffer.h region-cache.h line-index.h commands.h window.h \
    $(INTERVALS_H) blockinput.h atimer.h systime.h character.h ../lib/unistd.h \
    indent.h keyboard.h coding.h keymap.h frame.h lisp.h globals.h $(config_h)
 callint.o: callint.c window.h commands.h buffer.h keymap.h globals.h msdos.h \
@@ -128,7 +128,7 @@ indent.o:
    keyboard.h systime.h coding.h $(INTERVALS_H) globals.h
 inotify.o: inotify.c lisp.h coding.h process.h keyboard.h frame.h termhooks.h
 insdel.o: insdel.c window.h buffer.h $(INTERVALS_H) blockinput.h character.h \
-   atimer.h systime.h region-cache.h lisp.h globals.h $(config_h)
+   atimer.h systime.h region-cache.h line-index.h lisp.h globals.h $(config_h)
 keyboard.o: keyboard.c termchar.h termhooks.h termopts.h buffer.h character.h \
    commands.h frame.h window.h macros.h disptab.h keyboard.h syssignal.h \
    systime.h syntax.h $(INTERVALS_H) blockinput.h atimer.h composite.h \
@@ -143,7 +143,7 @@ macros.o:
 gmalloc.o: gmalloc.c $(config_h)
 ralloc.o: ralloc.c lisp.h $(config_h)
 vm-limit.o: vm-limit.c lisp.h globals.h $(config_h)
-marker.o: marker.c buffer.h character.h lisp.h globals.h $(config_h)
+marker.o: marker.c buffer.h character.h line-index.h lisp.h globals.h $(config_h)
 minibuf.o: minibuf.c syntax.h frame.h window.h keyboard.h systime.h \
    buffer.h commands.h character.h msdos.h $(INTERVALS_H) keymap.h \
    termhooks.h lisp.h globals.h $(config_h) coding.h
@@ -174,12 +174,14 @@ regex-emacs.o:
    category.h character.h
 region-cache.o: region-cache.c buffer.h region-cache.h \
    lisp.h globals.h $(config_h)
+line-index.o: line-index.c buffer.h line-index.h character.h \
+   lisp.h globals.h $(config_h)
 scroll.o: scroll.c termchar.h dispextern.h frame.h msdos.h keyboard.h \
    termhooks.h lisp.h globals.h $(config_h) systime.h coding.h composite.h \
    window.h
 search.o: search.c regex-emacs.h commands.h buffer.h region-cache.h syntax.h \
-   blockinput.h atimer.h systime.h category.h character.h charset.h \
-   $(INTERVALS_H) lisp.h globals.h $(config_h)
+   line-index.h blockinput.h atimer.h systime.h category.h character.h \
+   charset.h $(INTERVALS_H) lisp.h globals.h $(config_h)
 sound.o: sound.c dispextern.h syssignal.h lisp.h globals.h $(config_h) \
    atimer.h systime.h ../lib/unistd.h msdos.h
 syntax.o: syntax.c syntax.h buffer.h commands.h category.h character.h \
@@ -221,7 +223,8 @@ window.o:
 xdisp.o: xdisp.c macros.h commands.h process.h indent.h buffer.h \
    coding.h termchar.h frame.h window.h disptab.h termhooks.h character.h \
    charset.h lisp.h $(config_h) keyboard.h $(INTERVALS_H) region-cache.h \
-   xterm.h w32term.h nsterm.h nsgui.h msdos.h composite.h fontset.h ccl.h \
+   line-index.h xterm.h w32term.h nsterm.h nsgui.h msdos.h composite.h \
+   fontset.h ccl.h \
    blockinput.h atimer.h systime.h keymap.h font.h globals.h termopts.h \
    ../lib/unistd.h gnutls.h gtkutil.h
 xfaces.o: xfaces.c frame.h xterm.h buffer.h blockinput.h \
@@ -23,6 +23,7 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 #include <sys/random.h>
 #include <unistd.h>
 #include <filevercmp.h>
+#include <flexmember.h>
 #include <intprops.h>
 #include <vla.h>
 #include <errno.h>
@@ -2926,7 +2927,8 @@ internal_equal (Lisp_Object o1, Lisp_Object o2, enum equal_kind equal_kind,
 	  {
 	    return (XMARKER (o1)->buffer == XMARKER (o2)->buffer
 		    && (XMARKER (o1)->buffer == 0
-			|| XMARKER (o1)->bytepos == XMARKER (o2)->bytepos));
+			|| (marker_bytepos (XMARKER (o1))
+			    == marker_bytepos (XMARKER (o2)))));
 	  }
 	if (BOOL_VECTOR_P (o1))
 	  {
@@ -3144,8 +3146,8 @@ value_cmp (Lisp_Object a, Lisp_Object b, int maxdepth)
 		  int cmp = value_cmp (buf_a, buf_b, maxdepth - 1);
 		  if (cmp != 0)
 		    return cmp;
-		  ptrdiff_t pa = XMARKER (a)->charpos;
-		  ptrdiff_t pb = XMARKER (b)->charpos;
+		  ptrdiff_t pa = marker_charpos (XMARKER (a));
+		  ptrdiff_t pb = marker_charpos (XMARKER (b));
 		  return pa < pb ? -1 : pa > pb;
 		}
 
@@ -5535,7 +5537,7 @@ sxhash_obj (Lisp_Object obj, int depth)
 	else if (pvec_type == PVEC_MARKER)
 	  {
 	    ptrdiff_t bytepos
-	      = XMARKER (obj)->buffer ? XMARKER (obj)->bytepos : 0;
+	      = XMARKER (obj)->buffer ? marker_bytepos (XMARKER (obj)) : 0;
 	    EMACS_UINT hash
 	      = sxhash_combine ((intptr_t) XMARKER (obj)->buffer, bytepos);
 	    return hash;
@@ -6279,74 +6281,91 @@ extract_data_from_object (Lisp_Object spec,
 }
 
 
-/* ALGORITHM is a symbol: md5, sha1, sha224 and so on. */
+/* Return the digest size of ALGORITHM, a symbol such as md5 or sha1,
+   and set *HASH_FUNC to its hash function.  */
 
-static Lisp_Object
-secure_hash (Lisp_Object algorithm, Lisp_Object object, Lisp_Object start,
-	     Lisp_Object end, Lisp_Object coding_system, Lisp_Object noerror,
-	     Lisp_Object binary)
+static int
+secure_hash_algorithm (Lisp_Object algorithm,
+		       void *(**hash_func) (const char *, size_t, void *))
 {
-  ptrdiff_t start_byte, end_byte;
-  int digest_size;
-  void *(*hash_func) (const char *, size_t, void *);
-  Lisp_Object digest;
-
-  CHECK_SYMBOL (algorithm);
-
-  Lisp_Object spec = list5 (object, start, end, coding_system, noerror);
-
-  const char *input = extract_data_from_object (spec, &start_byte, &end_byte);
-
-  if (input == NULL)
-    error ("secure_hash: Failed to extract data from object, aborting!");
-
   if (EQ (algorithm, Qmd5))
     {
-      digest_size = MD5_DIGEST_SIZE;
-      hash_func	  = md5_buffer;
+      *hash_func = md5_buffer;
+      return MD5_DIGEST_SIZE;
     }
   else if (EQ (algorithm, Qsha1))
     {
-      digest_size = SHA1_DIGEST_SIZE;
-      hash_func	  = sha1_buffer;
+      *hash_func = sha1_buffer;
+      return SHA1_DIGEST_SIZE;
     }
   else if (EQ (algorithm, Qsha224))
     {
-      digest_size = SHA224_DIGEST_SIZE;
-      hash_func	  = sha224_buffer;
+      *hash_func = sha224_buffer;
+      return SHA224_DIGEST_SIZE;
     }
   else if (EQ (algorithm, Qsha256))
     {
-      digest_size = SHA256_DIGEST_SIZE;
-      hash_func	  = sha256_buffer;
+      *hash_func = sha256_buffer;
+      return SHA256_DIGEST_SIZE;
     }
   else if (EQ (algorithm, Qsha384))
     {
-      digest_size = SHA384_DIGEST_SIZE;
-      hash_func	  = sha384_buffer;
+      *hash_func = sha384_buffer;
+      return SHA384_DIGEST_SIZE;
     }
   else if (EQ (algorithm, Qsha512))
     {
-      digest_size = SHA512_DIGEST_SIZE;
-      hash_func	  = sha512_buffer;
+      *hash_func = sha512_buffer;
+      return SHA512_DIGEST_SIZE;
     }
   else
     error ("Invalid algorithm arg: %s", SDATA (Fsymbol_name (algorithm)));
+}
+
+/* Return the string for the DIGEST_SIZE bytes of HASH: hexadecimal
+   unless BINARY.  */
 
+static Lisp_Object
+secure_hash_string (const char *hash, int digest_size, bool binary)
+{
   /* allocate 2 x digest_size so that it can be reused to hold the
      hexified value */
-  digest = make_uninit_string (digest_size * 2);
+  Lisp_Object digest = make_uninit_string (digest_size * 2);
+  memcpy (SSDATA (digest), hash, digest_size);
 
-  hash_func (input + start_byte,
-	     end_byte - start_byte,
-	     SSDATA (digest));
-
-  if (NILP (binary))
+  if (!binary)
     return make_digest_string (digest, digest_size);
   else
     return make_unibyte_string (SSDATA (digest), digest_size);
 }
 
+/* ALGORITHM is a symbol: md5, sha1, sha224 and so on. */
+
+static Lisp_Object
+secure_hash (Lisp_Object algorithm, Lisp_Object object, Lisp_Object start,
+	     Lisp_Object end, Lisp_Object coding_system, Lisp_Object noerror,
+	     Lisp_Object binary)
+{
+  ptrdiff_t start_byte, end_byte;
+  void *(*hash_func) (const char *, size_t, void *);
+
+  CHECK_SYMBOL (algorithm);
+
+  Lisp_Object spec = list5 (object, start, end, coding_system, noerror);
+
+  const char *input = extract_data_from_object (spec, &start_byte, &end_byte);
+
+  if (input == NULL)
+    error ("secure_hash: Failed to extract data from object, aborting!");
+
+  int digest_size = secure_hash_algorithm (algorithm, &hash_func);
+
+  char hash[SHA512_DIGEST_SIZE];
+  hash_func (input + start_byte, end_byte - start_byte, hash);
+
+  return secure_hash_string (hash, digest_size, !NILP (binary));
+}
+
 DEFUN ("md5", Fmd5, Smd5, 1, 5, 0,
        doc: /* Return MD5 message digest of OBJECT, a buffer or string.
 
@@ -6411,6 +6430,83 @@ DEFUN ("secure-hash", Fsecure_hash, Ssecure_hash, 2, 5, 0,
   return secure_hash (algorithm, object, start, end, Qnil, Qnil, binary);
 }
 
+struct async_hash
+{
+  struct async_job job;
+  void *(*func) (const char *, size_t, void *);
+  size_t len;
+  int digest_size;
+  bool binary;
+  char hash[SHA512_DIGEST_SIZE];
+  char input[FLEXIBLE_ARRAY_MEMBER];
+};
+
+static void
+run_async_hash (struct async_job *job)
+{
+  struct async_hash *ah = (struct async_hash *) job;
+  ah->func (ah->input, ah->len, ah->hash);
+}
+
+static Lisp_Object
+finish_async_hash (struct async_job *job)
+{
+  struct async_hash *ah = (struct async_hash *) job;
+  char hash[SHA512_DIGEST_SIZE];
+  int digest_size = ah->digest_size;
+  bool binary = ah->binary;
+  memcpy (hash, ah->hash, digest_size);
+  xfree (ah);
+  return secure_hash_string (hash, digest_size, binary);
+}
+
+DEFUN ("async-secure-hash", Fasync_secure_hash, Sasync_secure_hash, 2, 6, 0,
+       doc: /* Compute the secure hash of OBJECT in a worker thread.
+Return a future for the result, which is what `secure-hash' would
+return for ALGORITHM, OBJECT, START, END and BINARY.  The hash is
+computed from a copy of OBJECT, so later changes to OBJECT do not
+affect it.
+
+Use `async-wait' to wait for the result, or `async-done-p' to check
+whether it is there.  If CALLBACK is non-nil, it is called with the
+result from the command loop, by means of an `async-event'.  */)
+  (Lisp_Object algorithm, Lisp_Object object, Lisp_Object start,
+   Lisp_Object end, Lisp_Object binary, Lisp_Object callback)
+{
+  ptrdiff_t start_byte, end_byte;
+  void *(*hash_func) (const char *, size_t, void *);
+
+  CHECK_SYMBOL (algorithm);
+
+  Lisp_Object spec = list5 (object, start, end, Qnil, Qnil);
+
+  const char *input = extract_data_from_object (spec, &start_byte, &end_byte);
+
+  if (input == NULL)
+    error ("secure_hash: Failed to extract data from object, aborting!");
+
+  int digest_size = secure_hash_algorithm (algorithm, &hash_func);
+
+  ptrdiff_t nbytes = end_byte - start_byte;
+  struct async_hash *ah
+    = xmalloc (FLEXSIZEOF (struct async_hash, input, nbytes));
+  specpdl_ref count = SPECPDL_INDEX ();
+  record_unwind_protect_ptr (xfree, ah);
+  ah->job.run = run_async_hash;
+  ah->job.finish = finish_async_hash;
+  ah->func = hash_func;
+  memcpy (ah->input, input + start_byte, nbytes);
+  ah->len = nbytes;
+  ah->digest_size = digest_size;
+  ah->binary = !NILP (binary);
+
+  /* AH belongs to the pool once it is submitted.  */
+  Lisp_Object future = async_make_future (callback);
+  clear_unwind_protect (count);
+  async_submit (&ah->job, future);
+  return unbind_to (count, future);
+}
+
 DEFUN ("buffer-hash", Fbuffer_hash, Sbuffer_hash, 0, 1, 0,
        doc: /* Return a hash of the contents of BUFFER-OR-NAME.
 This hash is performed on the raw internal format of the buffer,
@@ -6914,6 +7010,7 @@ syms_of_fns (void)
   defsubr (&Smd5);
   defsubr (&Ssecure_hash_algorithms);
   defsubr (&Ssecure_hash);
+  defsubr (&Sasync_secure_hash);
   defsubr (&Sbuffer_hash);
   defsubr (&Slocale_info);
   defsubr (&Sbuffer_line_statistics);
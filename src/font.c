@@ -4127,7 +4127,7 @@ DEFUN ("font-spec", Ffont_spec, Sfont_spec, 0, MANY, 0,
 copy_font_spec (Lisp_Object font)
 {
   enum { font_spec_size = VECSIZE (struct font_spec) };
-  Lisp_Object new_spec, tail, *pcdr;
+  Lisp_Object new_spec, tail, last;
   struct font_spec *spec;
 
   CHECK_FONT (font);
@@ -4144,12 +4144,17 @@ copy_font_spec (Lisp_Object font)
 	  (FONT_EXTRA_INDEX - 1) * word_size);
 
   /* Copy an alist of extra information but discard :font-entity property.  */
-  pcdr = spec->props + FONT_EXTRA_INDEX;
+  last = Qnil;
   for (tail = AREF (font, FONT_EXTRA_INDEX); CONSP (tail); tail = XCDR (tail))
     if (!EQ (XCAR (XCAR (tail)), QCfont_entity))
       {
-        *pcdr = Fcons (Fcons (XCAR (XCAR (tail)), CDR (XCAR (tail))), Qnil);
-        pcdr = xcdr_addr (*pcdr);
+        Lisp_Object nc
+          = list1 (Fcons (XCAR (XCAR (tail)), CDR (XCAR (tail))));
+        if (NILP (last))
+          spec->props[FONT_EXTRA_INDEX] = nc;
+        else
+          XSETCDR (last, nc);
+        last = nc;
       }
 
   XSETFONT (new_spec, spec);
@@ -29,6 +29,7 @@
 #include "buffer.h"
 #include "window.h"
 #include "region-cache.h"
+#include "line-index.h"
 #include "pdumper.h"
 
 #ifdef HAVE_TREE_SITTER
@@ -72,11 +73,11 @@ check_markers (void)
     {
       if (tail->buffer->text != current_buffer->text)
 	emacs_abort ();
-      if (tail->charpos > Z)
+      if (marker_charpos (tail) > Z)
 	emacs_abort ();
-      if (tail->bytepos > Z_BYTE)
+      if (marker_bytepos (tail) > Z_BYTE)
 	emacs_abort ();
-      if (multibyte && ! CHAR_HEAD_P (FETCH_BYTE (tail->bytepos)))
+      if (multibyte && ! CHAR_HEAD_P (FETCH_BYTE (marker_bytepos (tail))))
 	emacs_abort ();
     }
 }
@@ -231,8 +232,8 @@ adjust_suspend_auto_hscroll (ptrdiff_t from, ptrdiff_t to)
 
       if (BUFFERP (w->contents)
 	  && XBUFFER (w->contents) == current_buffer
-	  && XMARKER (w->old_pointm)->charpos >= from
-	  && XMARKER (w->old_pointm)->charpos <= to)
+	  && marker_charpos (XMARKER (w->old_pointm)) >= from
+	  && marker_charpos (XMARKER (w->old_pointm)) <= to)
 	w->suspend_auto_hscroll = 0;
     }
 }
@@ -249,29 +250,14 @@ adjust_suspend_auto_hscroll (ptrdiff_t from, ptrdiff_t to)
 adjust_markers_for_delete (ptrdiff_t from, ptrdiff_t from_byte,
 			   ptrdiff_t to, ptrdiff_t to_byte)
 {
-  struct Lisp_Marker *m;
-  ptrdiff_t charpos;
-
   adjust_suspend_auto_hscroll (from, to);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      charpos = m->charpos;
-      eassert (charpos <= Z);
 
-      /* If the marker is after the deletion,
-	 relocate by number of chars / bytes deleted.  */
-      if (charpos > to)
-	{
-	  m->charpos -= to - from;
-	  m->bytepos -= to_byte - from_byte;
-	}
-      /* Here's the case where a marker is inside text being deleted.  */
-      else if (charpos > from)
-	{
-	  m->charpos = from;
-	  m->bytepos = from_byte;
-	}
-    }
+  /* Markers inside the text being deleted go to its start, and the
+     ones after it are relocated by the number of chars / bytes
+     deleted.  */
+  marker_tree_collapse (current_buffer, from, from_byte, to + 1);
+  marker_tree_shift (current_buffer, to, false,
+		     from - to, from_byte - to_byte);
   adjust_overlays_for_delete (from, to - from);
 }
 
@@ -288,30 +274,9 @@ adjust_markers_for_delete (ptrdiff_t from, ptrdiff_t from_byte,
 adjust_markers_for_insert (ptrdiff_t from, ptrdiff_t from_byte,
 			   ptrdiff_t to, ptrdiff_t to_byte, bool before_markers)
 {
-  struct Lisp_Marker *m;
-  ptrdiff_t nchars = to - from;
-  ptrdiff_t nbytes = to_byte - from_byte;
-
   adjust_suspend_auto_hscroll (from, to);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      eassert (m->bytepos >= m->charpos
-	       && m->bytepos - m->charpos <= Z_BYTE - Z);
-
-      if (m->bytepos == from_byte)
-	{
-	  if (m->insertion_type || before_markers)
-	    {
-	      m->bytepos = to_byte;
-	      m->charpos = to;
-	    }
-	}
-      else if (m->bytepos > from_byte)
-	{
-	  m->bytepos += nbytes;
-	  m->charpos += nchars;
-	}
-    }
+  marker_tree_insert_gap (current_buffer, from, from_byte,
+			  to - from, to_byte - from_byte, before_markers);
   adjust_overlays_for_insert (from, to - from, before_markers);
 }
 
@@ -343,30 +308,15 @@ adjust_markers_for_replace (ptrdiff_t from, ptrdiff_t from_byte,
 			    ptrdiff_t old_chars, ptrdiff_t old_bytes,
 			    ptrdiff_t new_chars, ptrdiff_t new_bytes)
 {
-  register struct Lisp_Marker *m;
-  ptrdiff_t prev_to_byte = from_byte + old_bytes;
-  ptrdiff_t diff_chars = new_chars - old_chars;
-  ptrdiff_t diff_bytes = new_bytes - old_bytes;
-
   adjust_suspend_auto_hscroll (from, from + old_chars);
 
   /* FIXME: When OLD_CHARS is 0, this "replacement" is really just an
      insertion, but the behavior we provide here in that case is that of
      `insert-before-markers` rather than that of `insert`.
      Maybe not a bug, but not a feature either.  */
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      if (m->bytepos >= prev_to_byte)
-	{
-	  m->charpos += diff_chars;
-	  m->bytepos += diff_bytes;
-	}
-      else if (m->bytepos > from_byte)
-	{
-	  m->charpos = from;
-	  m->bytepos = from_byte;
-	}
-    }
+  marker_tree_collapse (current_buffer, from, from_byte, from + old_chars);
+  marker_tree_shift (current_buffer, from + old_chars, true,
+		     new_chars - old_chars, new_bytes - old_bytes);
 
   check_markers ();
 
@@ -411,35 +361,26 @@ adjust_markers_bytepos (ptrdiff_t from, ptrdiff_t from_byte,
 
   adjust_suspend_auto_hscroll (from, to);
 
+  /* The affected markers are visited in order, and their char
+     positions don't change, so the tree of markers stays in order
+     whatever is done to their byte positions.  */
   if (Z == Z_BYTE || (!to_z && to == to_byte))
     {
       /* Make sure each affected marker's bytepos is equal to
 	 its charpos.  */
-      for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-	{
-	  if (m->bytepos > from_byte
-	      && (to_z || m->bytepos <= to_byte))
-	    m->bytepos = m->charpos;
-	}
+      for (m = marker_tree_first_after (current_buffer, from);
+	   m && (to_z || m->charpos <= to); m = marker_tree_next (m))
+	m->bytepos = m->charpos;
     }
   else
     {
-      for (m = BUF_MARKERS (current_buffer); m; m = m->next)
+      for (m = marker_tree_first_after (current_buffer, from);
+	   m && (to_z || m->charpos <= to); m = marker_tree_next (m))
 	{
 	  /* Recompute each affected marker's bytepos.  */
-	  if (m->bytepos > from_byte
-	      && (to_z || m->bytepos <= to_byte))
-	    {
-	      if (m->charpos < beg
-		  && beg - m->charpos > m->charpos - from)
-		{
-		  beg = from;
-		  begbyte = from_byte;
-		}
-	      m->bytepos = count_bytes (beg, begbyte, m->charpos);
-	      beg = m->charpos;
-	      begbyte = m->bytepos;
-	    }
+	  m->bytepos = count_bytes (beg, begbyte, m->charpos);
+	  beg = m->charpos;
+	  begbyte = m->bytepos;
 	}
     }
 
@@ -1990,6 +1931,15 @@ run_undoable_change (void)
   call0 (Qundo_auto__undoable_change);
 }
 
+/* Return true if the current thread is coalescing the change hooks of
+   the current buffer.  */
+
+static bool
+coalescing_hooks_p (void)
+{
+  return coalesced_hooks.buffer == current_buffer;
+}
+
 /* Check that it is okay to modify the buffer between START and END,
    which are char positions.
 
@@ -2024,7 +1974,15 @@ prepare_to_modify_buffer_1 (ptrdiff_t start, ptrdiff_t end,
     enlarge_buffer_text (current_buffer, 0);
   eassert (!pdumper_object_p (BEG_ADDR));
 
-  run_undoable_change();
+  /* While the change hooks are coalesced, changes after the first are
+     part of the same undoable change.  */
+  if (!coalescing_hooks_p ())
+    run_undoable_change ();
+  else if (!coalesced_hooks.undoable)
+    {
+      coalesced_hooks.undoable = true;
+      run_undoable_change ();
+    }
 
   bset_redisplay (current_buffer);
 
@@ -2136,6 +2094,10 @@ invalidate_buffer_caches (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
     invalidate_region_cache (buf,
                              buf->width_run_cache,
                              start - BUF_BEG (buf), BUF_Z (buf) - end);
+  if (buf->line_index)
+    invalidate_line_index (buf, buf->line_index,
+			   start - BUF_BEG (buf), BUF_Z (buf) - end);
+  invalidate_syntax_ppss_cache (buf, start);
 }
 
 /* These macros work with an argument named `preserve_ptr'
@@ -2218,8 +2180,13 @@ signal_before_change (ptrdiff_t start_int, ptrdiff_t end_int,
       run_hook (Qfirst_change_hook);
     }
 
-  /* Now run the before-change-functions if any.  */
-  if (!NILP (Vbefore_change_functions))
+  /* Now run the before-change-functions if any.  While they are
+     coalesced, run them only before the first change, and for the whole
+     accessible portion of the buffer, since the extent of the
+     changes to come is unknown.  */
+  bool coalesced = coalescing_hooks_p ();
+  if (!NILP (Vbefore_change_functions)
+      && !(coalesced && coalesced_hooks.before_run))
     {
       rvoe_arg.location = &Vbefore_change_functions;
       rvoe_arg.errorp = 1;
@@ -2231,12 +2198,21 @@ signal_before_change (ptrdiff_t start_int, ptrdiff_t end_int,
       record_unwind_protect_ptr (reset_var_on_error, &rvoe_arg);
 
       /* Actually run the hook functions.  */
-      CALLN (Frun_hook_with_args, Qbefore_change_functions,
-	     FETCH_START, FETCH_END);
+      if (coalesced)
+	{
+	  coalesced_hooks.before_run = true;
+	  CALLN (Frun_hook_with_args, Qbefore_change_functions,
+		 make_fixnum (BEGV), make_fixnum (ZV));
+	}
+      else
+	CALLN (Frun_hook_with_args, Qbefore_change_functions,
+	       FETCH_START, FETCH_END);
 
       /* There was no error: unarm the reset_on_error.  */
       rvoe_arg.errorp = 0;
     }
+  else if (coalesced)
+    coalesced_hooks.before_run = true;
 
   if (buffer_has_overlays ())
     {
@@ -2254,6 +2230,35 @@ signal_before_change (ptrdiff_t start_int, ptrdiff_t end_int,
   unbind_to (count, Qnil);
 }
 
+/* Run the after-change-functions for the change of LENDEL chars at
+   CHARPOS into LENINS chars.  */
+
+static void
+run_after_change_functions (ptrdiff_t charpos, ptrdiff_t lendel,
+			    ptrdiff_t lenins)
+{
+  specpdl_ref count = SPECPDL_INDEX ();
+  struct rvoe_arg rvoe_arg;
+
+  if (NILP (Vafter_change_functions))
+    return;
+
+  rvoe_arg.location = &Vafter_change_functions;
+  rvoe_arg.errorp = 1;
+
+  /* Mark after-change-functions to be reset to nil in case of error.  */
+  record_unwind_protect_ptr (reset_var_on_error, &rvoe_arg);
+
+  /* Actually run the hook functions.  */
+  CALLN (Frun_hook_with_args, Qafter_change_functions,
+	 make_fixnum (charpos), make_fixnum (charpos + lenins),
+	 make_fixnum (lendel));
+
+  /* There was no error: unarm the reset_on_error.  */
+  rvoe_arg.errorp = 0;
+  unbind_to (count, Qnil);
+}
+
 /* Signal a change immediately after it happens.
    CHARPOS is the character position of the start of the changed text.
    LENDEL is the number of characters of the text before the change.
@@ -2265,16 +2270,34 @@ signal_before_change (ptrdiff_t start_int, ptrdiff_t end_int,
 signal_after_change (ptrdiff_t charpos, ptrdiff_t lendel, ptrdiff_t lenins)
 {
   specpdl_ref count = SPECPDL_INDEX ();
-  struct rvoe_arg rvoe_arg;
   Lisp_Object tmp, save_insert_behind_hooks, save_insert_in_from_hooks;
 
+  /* The modification is complete, so the line index can be brought
+     up to date again whenever it is needed.  */
+  settle_line_index (current_buffer);
+
   if (inhibit_modification_hooks)
     return;
 
+  /* While the change hooks are coalesced, the after-change-functions
+     are run only once, when coalescing ends, so just accumulate the
+     extent of the change.  Another thread coalescing in this buffer must
+     take in the change too, for the extent it reports to be right,
+     even though the change is not part of it.  */
+  bool coalesced = coalescing_hooks_p ();
+  for (struct thread_state *t = all_threads; t; t = t->next_thread)
+    if (t->m_coalesced_hooks.buffer == current_buffer)
+      {
+	struct coalesced_hooks_state *b = &t->m_coalesced_hooks;
+	b->beg = min (b->beg, charpos - BEG);
+	b->end = min (b->end, Z - (charpos + lenins));
+	b->change += lenins - lendel;
+      }
+
   /* If we are deferring calls to the after-change functions
      and there are no before-change functions,
      just record the args that we were going to use.  */
-  if (! NILP (Vcombine_after_change_calls)
+  if (!coalesced && ! NILP (Vcombine_after_change_calls)
       /* It's OK to defer after-changes even if syntax-ppss-flush-cache
        * is on before-change-functions, which is common enough to be worth
        * adding a special case for it.  */
@@ -2313,22 +2336,8 @@ signal_after_change (ptrdiff_t charpos, ptrdiff_t lendel, ptrdiff_t lenins)
 
   specbind (Qinhibit_modification_hooks, Qt);
 
-  if (!NILP (Vafter_change_functions))
-    {
-      rvoe_arg.location = &Vafter_change_functions;
-      rvoe_arg.errorp = 1;
-
-      /* Mark after-change-functions to be reset to nil in case of error.  */
-      record_unwind_protect_ptr (reset_var_on_error, &rvoe_arg);
-
-      /* Actually run the hook functions.  */
-      CALLN (Frun_hook_with_args, Qafter_change_functions,
-	     make_fixnum (charpos), make_fixnum (charpos + lenins),
-	     make_fixnum (lendel));
-
-      /* There was no error: unarm the reset_on_error.  */
-      rvoe_arg.errorp = 0;
-    }
+  if (!coalesced)
+    run_after_change_functions (charpos, lendel, lenins);
 
   interval_insert_behind_hooks = save_insert_behind_hooks;
   interval_insert_in_front_hooks = save_insert_in_from_hooks;
@@ -2440,6 +2449,53 @@ DEFUN ("combine-after-change-execute", Fcombine_after_change_execute,
 
   return unbind_to (count, Qnil);
 }
+
+/* Stop coalescing the change hooks, and run the after-change-functions
+   for the changes made meanwhile.  */
+
+static void
+finish_coalesced_hooks (void)
+{
+  struct buffer *b = coalesced_hooks.buffer;
+
+  coalesced_hooks.buffer = NULL;
+  if (coalesced_hooks.beg == PTRDIFF_MAX || !BUFFER_LIVE_P (b)
+      || inhibit_modification_hooks)
+    return;
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  record_unwind_current_buffer ();
+  set_buffer_internal (b);
+
+  ptrdiff_t begpos = BEG + min (coalesced_hooks.beg, Z - BEG);
+  ptrdiff_t endpos = max (begpos, Z - coalesced_hooks.end);
+  ptrdiff_t lendel = max (0, endpos - begpos - coalesced_hooks.change);
+
+  specbind (Qinhibit_modification_hooks, Qt);
+  run_after_change_functions (begpos, lendel, endpos - begpos);
+  unbind_to (count, Qnil);
+}
+
+DEFUN ("internal--with-coalesced-change-hooks",
+       Finternal__with_coalesced_change_hooks,
+       Sinternal__with_coalesced_change_hooks, 1, 1, 0,
+       doc: /* Call BODYFUN with no arguments, coalescing the change hooks.
+This function is for use internally in `with-coalesced-change-hooks'.  */)
+  (Lisp_Object bodyfun)
+{
+  /* Coalescing does not nest: while it goes on, even in another
+     buffer, BODYFUN just runs as part of it.  */
+  if (coalesced_hooks.buffer)
+    return call0 (bodyfun);
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  coalesced_hooks.buffer = current_buffer;
+  coalesced_hooks.before_run = coalesced_hooks.undoable = false;
+  coalesced_hooks.beg = coalesced_hooks.end = PTRDIFF_MAX;
+  coalesced_hooks.change = 0;
+  record_unwind_protect_void (finish_coalesced_hooks);
+  return unbind_to (count, call0 (bodyfun));
+}
 
 void
 syms_of_insdel (void)
@@ -2473,4 +2529,5 @@ syms_of_insdel (void)
   DEFSYM (Qinhibit_modification_hooks, "inhibit-modification-hooks");
 
   defsubr (&Scombine_after_change_execute);
+  defsubr (&Sinternal__with_coalesced_change_hooks);
 }
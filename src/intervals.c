@@ -475,6 +475,164 @@ buffer_balance_intervals (struct buffer *b)
     set_buffer_intervals (b, balance_an_interval (i));
 }
 
+/* Apart from garbage collection, which balances whole trees, the
+   balancing above only looks at a few nodes near the root or near a
+   split.  So a tree can get paths much longer than they should be,
+   typically after many intervals have been deleted, since delete_node
+   hangs the left subtree of the deleted node below its right one.
+   A tree balanced by weight is at most about elogb (TOTAL) deep,
+   where TOTAL is the length of its text, so when find_interval finds
+   an interval much deeper than that, it rebuilds the smallest subtree
+   above it that is too deep for its own length, as in a scapegoat
+   tree.  This keeps the depth of the tree logarithmic without slowing
+   down the operations that don't meet long paths.  */
+
+/* Return the depth beyond which an interval is considered too deep
+   in a tree whose text has length TOTAL.  */
+
+static int
+interval_depth_limit (ptrdiff_t total)
+{
+  return 2 * elogb (total) + 8;
+}
+
+/* Return the successor of interval I within the subtree rooted at
+   TREE, or NULL if I is the last interval in it.  */
+
+static INTERVAL
+subtree_successor (INTERVAL i, INTERVAL tree)
+{
+  if (i->right)
+    {
+      i = i->right;
+      while (i->left)
+	i = i->left;
+      return i;
+    }
+  while (i != tree && AM_RIGHT_CHILD (i))
+    i = INTERVAL_PARENT (i);
+  return i == tree ? NULL : INTERVAL_PARENT (i);
+}
+
+/* Link the intervals NODES[LO] .. NODES[HI - 1] into a tree balanced
+   by weight, and return its root.  STARTS[K] is the offset of the
+   beginning of NODES[K], and STARTS[HI] that of the end of the last
+   one.  */
+
+static INTERVAL
+link_balanced_intervals (INTERVAL *nodes, ptrdiff_t *starts,
+			 ptrdiff_t lo, ptrdiff_t hi)
+{
+  if (lo == hi)
+    return NULL;
+
+  /* Make the interval holding the middle character the root.  */
+  ptrdiff_t middle = starts[lo] + (starts[hi] - starts[lo]) / 2;
+  ptrdiff_t a = lo, b = hi - 1;
+  while (a < b)
+    {
+      ptrdiff_t m = a + (b - a + 1) / 2;
+      if (starts[m] <= middle)
+	a = m;
+      else
+	b = m - 1;
+    }
+
+  INTERVAL i = nodes[a];
+  INTERVAL left = link_balanced_intervals (nodes, starts, lo, a);
+  INTERVAL right = link_balanced_intervals (nodes, starts, a + 1, hi);
+  set_interval_left (i, left);
+  if (left)
+    set_interval_parent (left, i);
+  set_interval_right (i, right);
+  if (right)
+    set_interval_parent (right, i);
+  i->total_length = starts[hi] - starts[lo];
+  eassert (LENGTH (i) > 0);
+  return i;
+}
+
+/* Rebuild the subtree rooted at TREE into one balanced by weight, and
+   put it back in place of TREE.  TREE must belong to a buffer or a
+   string.  */
+
+static void
+rebuild_interval_subtree (INTERVAL tree)
+{
+  ptrdiff_t n = 0, k = 0;
+  INTERVAL i, first = tree;
+
+  while (first->left)
+    first = first->left;
+  for (i = first; i; i = subtree_successor (i, tree))
+    n++;
+
+  INTERVAL *nodes = xnmalloc (n, sizeof *nodes);
+  ptrdiff_t *starts = xnmalloc (n + 1, sizeof *starts);
+  starts[0] = 0;
+  for (i = first; i; i = subtree_successor (i, tree), k++)
+    {
+      nodes[k] = i;
+      starts[k + 1] = starts[k] + LENGTH (i);
+    }
+
+  bool root = ROOT_INTERVAL_P (tree);
+  Lisp_Object owner = Qnil;
+  INTERVAL parent = NULL;
+  bool left_child = false;
+  if (root)
+    GET_INTERVAL_OBJECT (owner, tree);
+  else
+    {
+      parent = INTERVAL_PARENT (tree);
+      left_child = AM_LEFT_CHILD (tree);
+    }
+
+  i = link_balanced_intervals (nodes, starts, 0, n);
+  xfree (nodes);
+  xfree (starts);
+
+  if (root)
+    {
+      set_interval_object (i, owner);
+      if (BUFFERP (owner))
+	set_buffer_intervals (XBUFFER (owner), i);
+      else
+	set_string_intervals (owner, i);
+    }
+  else
+    {
+      set_interval_parent (i, parent);
+      if (left_child)
+	set_interval_left (parent, i);
+      else
+	set_interval_right (parent, i);
+    }
+}
+
+/* Rebuild the smallest subtree containing interval I that is too deep
+   for the length of its text, if any.  */
+
+static void
+rebuild_deep_interval (INTERVAL i)
+{
+  int depth = 0;
+
+  while (! NULL_PARENT (i))
+    {
+      i = INTERVAL_PARENT (i);
+      depth++;
+      if (depth > interval_depth_limit (TOTAL_LENGTH (i)))
+	{
+	  /* A tree not attached to any object is only known to its
+	     caller by its root, which must not change.  */
+	  if (! ROOT_INTERVAL_P (i) || INTERVAL_HAS_OBJECT (i))
+	    rebuild_interval_subtree (i);
+	  return;
+	}
+    }
+}
+
 /* Split INTERVAL into two pieces, starting the second piece at
    character position OFFSET (counting from 0), relative to INTERVAL.
    INTERVAL becomes the left-hand piece, and the right-hand piece
@@ -619,6 +777,9 @@ find_interval (register INTERVAL tree, register ptrdiff_t position)
   eassert (relative_position <= TOTAL_LENGTH (tree));
 
   tree = balance_possible_root_interval (tree);
+  int depth_limit = (ROOT_INTERVAL_P (tree)
+		     ? interval_depth_limit (TOTAL_LENGTH (tree)) : INT_MAX);
+  int depth = 0;
 
   while (1)
     {
@@ -626,6 +787,7 @@ find_interval (register INTERVAL tree, register ptrdiff_t position)
       if (relative_position < LEFT_TOTAL_LENGTH (tree))
 	{
 	  tree = tree->left;
+	  depth++;
 	}
       else if (! NULL_RIGHT_CHILD (tree)
 	       && relative_position >= (TOTAL_LENGTH (tree)
@@ -634,6 +796,7 @@ find_interval (register INTERVAL tree, register ptrdiff_t position)
 	  relative_position -= (TOTAL_LENGTH (tree)
 				- RIGHT_TOTAL_LENGTH (tree));
 	  tree = tree->right;
+	  depth++;
 	}
       else
 	{
@@ -641,6 +804,8 @@ find_interval (register INTERVAL tree, register ptrdiff_t position)
 	    = (position - relative_position /* left edge of *tree.  */
 	       + LEFT_TOTAL_LENGTH (tree)); /* left edge of this interval.  */
 
+	  if (depth > depth_limit)
+	    rebuild_deep_interval (tree);
 	  return tree;
 	}
     }
@@ -125,7 +125,18 @@ Copyright (C) 2017-2024 Free Software Foundation, Inc.
    remember the fact, that a node's path to the root has no offsets
    applied (i.e. its values are up to date).  This is the case if some
    node's value differs from the tree's one, the later of which is
-   incremented whenever some node's offset has changed.  */
+   incremented whenever some node's offset has changed.
+
+   Deleting text is similar, except that the overlays in the deleted
+   text must shrink or collapse to its start, rather than just move.
+   So a node also has a CLAMP, the minimum that the positions of its
+   subtree are to have once they are shifted by its OFFSET.  After a
+   deletion at P, the positions of all the overlays of a subtree that
+   begin at or after P are then adjusted by setting its OFFSET and
+   CLAMP, however many of these overlays were in the deleted text.
+   When a node's OFFSET and CLAMP are applied, the OFFSET and CLAMP of
+   its children are combined with them, so that they describe the
+   succession of the shifts of the subtree.  */
 
 /* +=======================================================================+
  * | Stack
@@ -216,7 +227,7 @@ itree_max_height (const struct itree_tree *tree)
 static struct check_subtree_result
 check_subtree (struct itree_node *node,
 	       bool check_red_black_invariants, uintmax_t tree_otick,
-	       ptrdiff_t offset, ptrdiff_t min_begin,
+	       ptrdiff_t offset, ptrdiff_t clamp, ptrdiff_t min_begin,
 	       ptrdiff_t max_begin)
 {
   struct check_subtree_result result = { .size = 0,
@@ -238,12 +249,16 @@ check_subtree (struct itree_node *node,
      is a need.  */
   eassert (node->otick <= tree_otick);
   eassert (node->parent == NULL || node->otick <= node->parent->otick);
-  eassert (node->otick != tree_otick || node->offset == 0);
+  eassert (node->otick != tree_otick
+	   || (node->offset == 0 && node->clamp == PTRDIFF_MIN));
 
+  /* The shifts of the ancestors apply after that of NODE.  */
+  if (node->clamp != PTRDIFF_MIN)
+    clamp = max (clamp, node->clamp + offset);
   offset += node->offset;
-  ptrdiff_t begin = node->begin + offset;
-  ptrdiff_t end = node->end + offset;
-  ptrdiff_t limit = node->limit + offset;
+  ptrdiff_t begin = max (clamp, node->begin + offset);
+  ptrdiff_t end = max (clamp, node->end + offset);
+  ptrdiff_t limit = max (clamp, node->limit + offset);
 
   eassert (min_begin <= max_begin);
   eassert (min_begin <= begin);
@@ -252,10 +267,10 @@ check_subtree (struct itree_node *node,
 
   struct check_subtree_result left_result
     = check_subtree (node->left, check_red_black_invariants,
-		     tree_otick, offset, min_begin, begin);
+		     tree_otick, offset, clamp, min_begin, begin);
   struct check_subtree_result right_result
     = check_subtree (node->right, check_red_black_invariants,
-		     tree_otick, offset, begin, max_begin);
+		     tree_otick, offset, clamp, begin, max_begin);
 
   eassert (left_result.limit <= limit);
   eassert (right_result.limit <= limit);
@@ -297,8 +312,7 @@ check_tree (struct itree_tree *tree,
   struct itree_node *node = tree->root;
   struct check_subtree_result result
     = check_subtree (node, check_red_black_invariants, tree->otick,
-		     node->offset, PTRDIFF_MIN,
-		     PTRDIFF_MAX);
+		     0, PTRDIFF_MIN, PTRDIFF_MIN, PTRDIFF_MAX);
   eassert (result.size == tree->size);
 
   /* The only way this function fails is eassert().  */
@@ -321,6 +335,28 @@ null_safe_is_black (struct itree_node *node)
   return node == NULL || !node->red; /* NULL nodes are black */
 }
 
+/* Return POS, a position of the subtree rooted at NODE, with NODE's
+   OFFSET and CLAMP applied.  */
+
+static inline ptrdiff_t
+itree_shifted (const struct itree_node *node, ptrdiff_t pos)
+{
+  return max (node->clamp, pos + node->offset);
+}
+
+/* Shift the positions of the subtree rooted at NODE by OFFSET, and
+   then raise them to at least CLAMP.  */
+
+static inline void
+itree_shift_subtree (struct itree_node *node, ptrdiff_t offset,
+		     ptrdiff_t clamp)
+{
+  if (node->clamp != PTRDIFF_MIN)
+    node->clamp += offset;
+  node->clamp = max (node->clamp, clamp);
+  node->offset += offset;
+}
+
 static inline ptrdiff_t
 itree_newlimit (struct itree_node *node)
 {
@@ -328,10 +364,10 @@ itree_newlimit (struct itree_node *node)
   return max (node->end,
 	      max (node->left == NULL
 		     ? PTRDIFF_MIN
-		     : node->left->limit + node->left->offset,
+		     : itree_shifted (node->left, node->left->limit),
 		   node->right == NULL
 		     ? PTRDIFF_MIN
-		     : node->right->limit + node->right->offset));
+		     : itree_shifted (node->right, node->right->limit)));
 }
 
 /* Update NODE's limit attribute according to its children. */
@@ -345,8 +381,8 @@ itree_update_limit (struct itree_node *node)
   node->limit = itree_newlimit (node);
 }
 
-/* Apply NODE's offset to its begin, end and limit values and
-   propagate it to its children.
+/* Apply NODE's offset and clamp to its begin, end and limit values
+   and propagate them to its children.
 
    Does nothing, if NODE is clean, i.e. NODE.otick = tree.otick .
 */
@@ -357,7 +393,7 @@ itree_inherit_offset (uintmax_t otick, struct itree_node *node)
   eassert (node->parent == NULL || node->parent->otick >= node->otick);
   if (node->otick == otick)
     {
-      eassert (node->offset == 0);
+      eassert (node->offset == 0 && node->clamp == PTRDIFF_MIN);
       return;
     }
 
@@ -367,16 +403,17 @@ itree_inherit_offset (uintmax_t otick, struct itree_node *node)
      potentially "dirty" nodes, where we only need to make sure the
      *local* offsets are zero.  */
 
-  if (node->offset)
+  if (node->offset || node->clamp != PTRDIFF_MIN)
     {
-      node->begin += node->offset;
-      node->end   += node->offset;
-      node->limit += node->offset;
+      node->begin = itree_shifted (node, node->begin);
+      node->end   = itree_shifted (node, node->end);
+      node->limit = itree_shifted (node, node->limit);
       if (node->left != NULL)
-	node->left->offset += node->offset;
+	itree_shift_subtree (node->left, node->offset, node->clamp);
       if (node->right != NULL)
-	node->right->offset += node->offset;
+	itree_shift_subtree (node->right, node->offset, node->clamp);
       node->offset = 0;
+      node->clamp = PTRDIFF_MIN;
     }
   /* The only thing that matters about `otick` is whether it's equal to
      that of the tree.  We could also "blindly" inherit from parent->otick,
@@ -693,7 +730,7 @@ itree_insert_node (struct itree_tree *tree, struct itree_node *node)
     {
       itree_inherit_offset (otick, child);
       parent = child;
-      eassert (child->offset == 0);
+      eassert (child->offset == 0 && child->clamp == PTRDIFF_MIN);
       child->limit = max (child->limit, node->end);
       /* This suggests that nodes in the right subtree are strictly
 	 greater.  But this is not true due to later rotations.  */
@@ -713,6 +750,7 @@ itree_insert_node (struct itree_tree *tree, struct itree_node *node)
   node->left = NULL;
   node->right = NULL;
   node->offset = 0;
+  node->clamp = PTRDIFF_MIN;
   node->limit = node->end;
   eassert (node->parent == NULL || node->parent->otick >= node->otick);
 
@@ -894,18 +932,20 @@ itree_remove_fix (struct itree_tree *tree,
     node->red = false;
 }
 
-/* Return accumulated offsets of NODE's parents.  */
-static ptrdiff_t
-itree_total_offset (struct itree_node *node)
+/* Return whether the accumulated offsets and clamps of the parents of
+   NODE1 and NODE2 are the same.  */
+static bool
+itree_same_total_offset (struct itree_node *node1, struct itree_node *node2)
 {
-  eassert (node != NULL);
-  ptrdiff_t offset = 0;
-  while (node->parent != NULL)
-    {
-      node = node->parent;
-      offset += node->offset;
-    }
-  return offset;
+  struct itree_node total[2] = { { .offset = 0, .clamp = PTRDIFF_MIN },
+				 { .offset = 0, .clamp = PTRDIFF_MIN } };
+  struct itree_node *node[2] = { node1, node2 };
+
+  for (int i = 0; i < 2; i++)
+    for (struct itree_node *n = node[i]->parent; n; n = n->parent)
+      itree_shift_subtree (&total[i], n->offset, n->clamp);
+  return (total[0].offset == total[1].offset
+	  && total[0].clamp == total[1].clamp);
 }
 
 /* Replace DEST with SOURCE as a child of DEST's parent.  Adjusts
@@ -921,8 +961,7 @@ itree_replace_child (struct itree_tree *tree,
 			     struct itree_node *dest)
 {
   eassert (tree && dest != NULL);
-  eassert (source == NULL
-	   || itree_total_offset (source) == itree_total_offset (dest));
+  eassert (source == NULL || itree_same_total_offset (source, dest));
 
   if (dest == tree->root)
     tree->root = source;
@@ -1025,7 +1064,7 @@ itree_remove (struct itree_tree *tree, struct itree_node *node)
   /* Must be clean (all offsets applied).  Also, some callers rely on
      node's otick being the tree's otick.  */
   eassert (node->otick == tree->otick);
-  eassert (node->offset == 0);
+  eassert (node->offset == 0 && node->clamp == PTRDIFF_MIN);
 
   return node;
 }
@@ -1055,7 +1094,13 @@ itree_insert_gap (struct itree_tree *tree,
   /* Nodes with front_advance starting at pos may mess up the tree
      order, so we need to remove them first.  This doesn't apply for
      `before_markers` since in that case, all positions move identically
-     regardless of `front_advance` or `rear_advance`.  */
+     regardless of `front_advance` or `rear_advance`.
+
+     This makes an insertion take O(K log N) time for the K such nodes,
+     rather than O(log N).  Ordering the nodes that begin at the same
+     position by `front_advance` would let them stay, but deletions
+     collapse nodes to a common beginning in no particular order, so
+     that order could not be kept cheaply.  */
   struct itree_stack *saved = itree_stack_create (0);
   struct itree_node *node = NULL;
   if (!before_markers)
@@ -1092,7 +1137,7 @@ itree_insert_gap (struct itree_tree *tree,
 	      if (node->begin > pos)
 		{
 		  /* All nodes in this subtree are shifted by length.  */
-		  node->right->offset += length;
+		  itree_shift_subtree (node->right, length, PTRDIFF_MIN);
 		  ++tree->otick;
 		}
 	      else
@@ -1158,10 +1203,12 @@ itree_delete_gap (struct itree_tree *tree,
 	continue;
       if (node->right != NULL)
 	{
-	  if (node->begin > pos + length)
+	  if (node->begin >= pos)
 	    {
-	      /* Shift right subtree to the left. */
-	      node->right->offset -= length;
+	      /* All nodes in the right subtree begin at or after POS,
+		 so shift it to the left, collapsing the intervals in
+		 the deleted text to POS.  */
+	      itree_shift_subtree (node->right, -length, pos);
 	      ++tree->otick;
 	    }
 	  else
@@ -1173,11 +1220,8 @@ itree_delete_gap (struct itree_tree *tree,
       if (pos < node->begin)
 	node->begin = max (pos, node->begin - length);
       if (node->end > pos)
-	{
-	  node->end = max (pos , node->end - length);
-	  eassert (node != NULL);
-	  itree_propagate_limit (node);
-	}
+	node->end = max (pos , node->end - length);
+      itree_propagate_limit (node);
     }
   itree_stack_destroy (stack);
 }
@@ -1194,14 +1238,27 @@ itree_delete_gap (struct itree_tree *tree,
    at BEGIN or ending at END.  This seems to match the behavior of the
    old overlays code but it's not clear if it's The Right Thing
    (e.g. it breaks the expectation that if NODE1 is included, then
-   a NODE2 strictly bigger than NODE1 should also be included).  */
+   a NODE2 strictly bigger than NODE1 should also be included).
+   Empty nodes at BEGIN are excluded if EMPTY_AT_BEGIN is false.  */
 
 static inline bool
 itree_node_intersects (const struct itree_node *node,
-		       ptrdiff_t begin, ptrdiff_t end)
+		       ptrdiff_t begin, ptrdiff_t end, bool empty_at_begin)
 {
   return (begin < node->end && node->begin < end)
-    || (node->begin == node->end && begin == node->begin);
+    || (empty_at_begin && node->begin == node->end && begin == node->begin);
+}
+
+/* Return true if the subtree rooted at NODE may contain nodes that
+   ITER should visit, judging by its LIMIT.  */
+
+static inline bool
+itree_iter_reaches (const struct itree_iterator *iter,
+		    const struct itree_node *node)
+{
+  return (iter->empty_at_begin
+	  ? iter->begin <= node->limit
+	  : iter->begin < node->limit);
 }
 
 /* Return the "next" node in the current traversal order.
@@ -1245,7 +1302,7 @@ itree_iter_next_in_subtree (struct itree_node *node,
           itree_inherit_offset (iter->otick, node);
           while ((next = node->left)
                  && (itree_inherit_offset (iter->otick, next),
-                     iter->begin <= next->limit))
+                     itree_iter_reaches (iter, next)))
             node = next;
         }
       if (node->begin > iter->end)
@@ -1256,7 +1313,7 @@ itree_iter_next_in_subtree (struct itree_node *node,
       next = node->left;
       if (!next
           || (itree_inherit_offset (iter->otick, next),
-              next->limit < iter->begin))
+              !itree_iter_reaches (iter, next)))
         {
           while ((next = node->parent)
                  && next->left == node)
@@ -1281,7 +1338,7 @@ itree_iter_next_in_subtree (struct itree_node *node,
       next = node->left;
       if (next
           && (itree_inherit_offset (iter->otick, next),
-              !(next->limit < iter->begin)))
+              itree_iter_reaches (iter, next)))
         return next;
       next = node->right;
       if (node->begin <= iter->end && next)
@@ -1320,7 +1377,7 @@ itree_iter_next_in_subtree (struct itree_node *node,
       itree_inherit_offset (iter->otick, node);
       while (((next = node->left)
               && (itree_inherit_offset (iter->otick, next),
-                  iter->begin <= next->limit))
+                  itree_iter_reaches (iter, next)))
              || (node->begin <= iter->end
                  && (next = node->right)
                  && (itree_inherit_offset (iter->otick, next), true)))
@@ -1375,16 +1432,19 @@ itree_iterator_first_node (struct itree_tree *tree,
 }
 
 /* Start an iterator enumerating all intervals in [BEGIN,END) in the
-   given ORDER.  */
+   given ORDER.  Include the empty intervals at BEGIN only if
+   EMPTY_AT_BEGIN.  */
 
 struct itree_iterator *
 itree_iterator_start (struct itree_iterator *iter,
 		      struct itree_tree *tree,
-		      ptrdiff_t begin, ptrdiff_t end, enum itree_order order)
+		      ptrdiff_t begin, ptrdiff_t end, bool empty_at_begin,
+		      enum itree_order order)
 {
   eassert (iter);
   iter->begin = begin;
   iter->end = end;
+  iter->empty_at_begin = empty_at_begin;
   iter->otick = tree->otick;
   iter->order = order;
   /* Beware: the `node` field always holds "the next" node to consider.
@@ -1402,7 +1462,8 @@ itree_iterator_next (struct itree_iterator *iter)
 {
   struct itree_node *node = iter->node;
   while (node
-         && !itree_node_intersects (node, iter->begin, iter->end))
+         && !itree_node_intersects (node, iter->begin, iter->end,
+                                    iter->empty_at_begin))
     {
       node = itree_iter_next_in_subtree (node, iter);
       eassert (itree_limit_is_stable (node));
@@ -53,26 +53,30 @@ #define ITREE_H
      node is in a tree these fields are read only, written only by
      itree functions.
 
-     The LIMIT, OFFSET and OTICK fields should be considered internal
+     The LIMIT, OFFSET, CLAMP and OTICK fields should be considered internal
      to itree.c and used only by itree functions.
 
      LIMIT is a buffer position, the maximum of END of this node and
      its children.  See itree.c for its use.
 
      OFFSET is in buffer position units, and will be non-zero only
-     when the node is dirty.
+     when the node is dirty.  CLAMP is a buffer position, or
+     PTRDIFF_MIN when the node is clean.  Together, they describe the
+     adjustment still to be made to the positions of the subtree
+     rooted at the node: each position POS is to become
+     max (CLAMP, POS + OFFSET).
 
-     OTICK determines whether BEGIN, END, LIMIT and OFFSET are
+     OTICK determines whether BEGIN, END, LIMIT, OFFSET and CLAMP are
      considered dirty.  A node is clean when its OTICK is equal to the
      OTICK of its tree (see struct itree_tree).  Otherwise, it is
      dirty.
 
      In a clean node, BEGIN, END and LIMIT are correct buffer
-     positions, and OFFSET is zero.  The parent of a clean node is
-     also clean, recursively.
+     positions, OFFSET is zero and CLAMP is PTRDIFF_MIN.  The parent
+     of a clean node is also clean, recursively.
 
      In a dirty node, the node's OTICK won't equal its tree's OTICK,
-     and its OFFSET may be non-zero.  At all times the descendents of
+     and its OFFSET and CLAMP may be set.  At all times the descendents of
      a dirty node are also dirty.  BEGIN, END and LIMIT require
      adjustment before use as buffer positions.
 
@@ -87,6 +91,7 @@ #define ITREE_H
   ptrdiff_t end;		/* The end of the interval. */
   ptrdiff_t limit;		/* The maximum end in this subtree. */
   ptrdiff_t offset;		/* The amount of shift to apply to this subtree. */
+  ptrdiff_t clamp;		/* The minimum position after the shift.  */
   uintmax_t otick;              /* offset modified tick */
   Lisp_Object data;             /* Exclusively used by the client. */
   bool_bf red : 1;
@@ -136,6 +141,7 @@ itree_empty_p (struct itree_tree *tree)
 						    struct itree_tree *,
 						    ptrdiff_t,
 						    ptrdiff_t,
+						    bool,
 						    enum itree_order);
 extern void itree_iterator_narrow (struct itree_iterator *, ptrdiff_t,
 				   ptrdiff_t);
@@ -147,6 +153,7 @@ itree_empty_p (struct itree_tree *tree)
     struct itree_node *node;
     ptrdiff_t begin;
     ptrdiff_t end;
+    bool empty_at_begin; /* Whether to visit the empty intervals at BEGIN.  */
     uintmax_t otick;    /* A copy of the tree's `otick`.  */
     enum itree_order order;
   };
@@ -167,6 +174,16 @@ itree_empty_p (struct itree_tree *tree)
    - Don't modify the tree during the iteration.
  */
 #define ITREE_FOREACH(n, t, beg, end, order)                        \
+  ITREE_FOREACH_1 (n, t, beg, end, true, order)
+
+/* Like ITREE_FOREACH, but skip the empty intervals at BEG, i.e. only
+   visit the intervals sharing some text with BEG..END, and the empty
+   ones strictly inside it.  This avoids visiting the many empty
+   intervals that deleting text can leave at the same position.  */
+#define ITREE_FOREACH_OVERLAPPING(n, t, beg, end, order)            \
+  ITREE_FOREACH_1 (n, t, beg, end, false, order)
+
+#define ITREE_FOREACH_1(n, t, beg, end, empty_at_begin, order)      \
   /* FIXME: We'd want to declare `n` right here, but I can't figure out
      how to make that work here: the `for` syntax only allows a single
      clause for the var declarations where we need 2 different types.
@@ -179,7 +196,8 @@ #define ITREE_FOREACH(n, t, beg, end, order)                        \
     for (struct itree_iterator itree_local_iter_,                \
                                *itree_iter_                      \
             = itree_iterator_start (&itree_local_iter_,          \
-                                    t, beg, end, ITREE_##order); \
+                                    t, beg, end, empty_at_begin, \
+                                    ITREE_##order);              \
           ((n = itree_iterator_next (itree_iter_)));)
 
 #define ITREE_FOREACH_NARROW(beg, end) \
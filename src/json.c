@@ -1405,7 +1405,7 @@ json_parse_array (struct json_parser *parser)
       if (parser->available_depth < 0)
 	json_signal_error (parser, Qjson_object_too_deep);
 
-      Lisp_Object *cdr = &result;
+      Lisp_Object last = Qnil;
       /* This loop collects the array elements in the object workspace
        */
       for (;;)
@@ -1422,8 +1422,11 @@ json_parse_array (struct json_parser *parser)
 	    case json_array_list:
 	      {
 		Lisp_Object nc = Fcons (element, Qnil);
-		*cdr = nc;
-		cdr = xcdr_addr (nc);
+		if (NILP (last))
+		  result = nc;
+		else
+		  XSETCDR (last, nc);
+		last = nc;
 		break;
 	      }
 	    default:
@@ -1496,7 +1499,7 @@ json_parse_object (struct json_parser *parser)
       if (parser->available_depth < 0)
 	json_signal_error (parser, Qjson_object_too_deep);
 
-      Lisp_Object *cdr = &result;
+      Lisp_Object last = Qnil;
 
       /* This loop collects the object members (key/value pairs) in
        * the object workspace */
@@ -1523,21 +1526,23 @@ json_parse_object (struct json_parser *parser)
 		Lisp_Object key = json_parse_string (parser, true, false);
 		Lisp_Object value = json_parse_object_member_value (parser);
 		Lisp_Object nc = Fcons (Fcons (key, value), Qnil);
-		*cdr = nc;
-		cdr = xcdr_addr (nc);
+		if (NILP (last))
+		  result = nc;
+		else
+		  XSETCDR (last, nc);
+		last = nc;
 		break;
 	      }
 	    case json_object_plist:
 	      {
 		Lisp_Object key = json_parse_string (parser, true, true);
 		Lisp_Object value = json_parse_object_member_value (parser);
-		Lisp_Object nc = Fcons (key, Qnil);
-		*cdr = nc;
-		cdr = xcdr_addr (nc);
-
-		nc = Fcons (value, Qnil);
-		*cdr = nc;
-		cdr = xcdr_addr (nc);
+		Lisp_Object nc = list2 (key, value);
+		if (NILP (last))
+		  result = nc;
+		else
+		  XSETCDR (last, nc);
+		last = XCDR (nc);
 		break;
 	      }
 	    default:
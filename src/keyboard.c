@@ -4263,6 +4263,7 @@ kbd_buffer_get_event (KBOARD **kbp,
 #ifdef THREADS_ENABLED
       case THREAD_EVENT:
 #endif
+      case ASYNC_EVENT:
 #ifdef HAVE_XWIDGETS
       case XWIDGET_EVENT:
       case XWIDGET_DISPLAY_EVENT:
@@ -4836,7 +4837,8 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
    Returns the time to wait until the next timer fires.
    If no timer is active, return an invalid value.
 
-   As long as any timer is ripe, we run it.  */
+   As long as any timer is ripe, we run it.  Then do a slice of the
+   incremental garbage collection in progress, if any.  */
 
 struct timespec
 timer_check (void)
@@ -4871,6 +4873,15 @@ timer_check (void)
     }
   while (nexttime.tv_sec == 0 && nexttime.tv_nsec == 0);
 
+  /* Continue an incremental garbage collection while Emacs waits, and
+     have the caller come back at once if it is not done yet.  */
+  if (gc_marking_incrementally)
+    {
+      mark_incrementally ();
+      if (gc_marking_incrementally)
+	nexttime = make_timespec (0, 0);
+    }
+
   return nexttime;
 }
 
@@ -6434,7 +6445,7 @@ make_lispy_event (struct input_event *event)
 	    else
 	      double_click_count = 1;
 	    button_down_time = event->timestamp;
-	    *start_pos_ptr = Fcopy_alist (position);
+	    ASET (button_down_location, button, Fcopy_alist (position));
 	    frame_relative_event_pos = Fcons (event->x, event->y);
 	    ignore_mouse_drag_p = false;
 	    /* Squirrel away the line-number width, if any.  */
@@ -7093,6 +7104,9 @@ make_lispy_event (struct input_event *event)
       return Fcons (Qthread_event, event->arg);
 #endif /* THREADS_ENABLED */
 
+    case ASYNC_EVENT:
+      return Fcons (Qasync_event, event->arg);
+
 #ifdef HAVE_XWIDGETS
     case XWIDGET_EVENT:
       return Fcons (Qxwidget_event, event->arg);
@@ -12922,6 +12936,8 @@ syms_of_keyboard (void)
   DEFSYM (Qthread_event, "thread-event");
 #endif
 
+  DEFSYM (Qasync_event, "async-event");
+
 #ifdef HAVE_XWIDGETS
   DEFSYM (Qxwidget_event, "xwidget-event");
   DEFSYM (Qxwidget_display_event, "xwidget-display-event");
@@ -13999,6 +14015,11 @@ keys_of_keyboard (void)
 			    "thread-handle-event");
 #endif
 
+  /* Define a special event which is raised when an async job
+     finishes.  */
+  initial_define_lispy_key (Vspecial_event_map, "async-event",
+			    "async-handle-event");
+
 #ifdef USE_FILE_NOTIFY
   /* Define a special event which is raised for notification callback
      functions.  */
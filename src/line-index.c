@@ -0,0 +1,492 @@
+/* Indexing the lines of a buffer, for optimization.
+
+Copyright (C) 2026 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+
+#include <config.h>
+
+#include "lisp.h"
+#include "character.h"
+#include "buffer.h"
+#include "line-index.h"
+
+
+/* Data structures.  */
+
+/* The text of the buffer is divided into consecutive chunks, and we
+   remember the number of bytes, characters and newlines in each.
+   Chunks are made about LINE_INDEX_CHUNK bytes long and never split a
+   multibyte character; insertions make them grow until they are
+   twice that size, at which point they are split again.
+
+   To find the chunk holding a given byte position, character position
+   or newline in logarithmic time, the counts are also kept in a
+   Fenwick tree (a.k.a. binary indexed tree), whose node I holds the
+   sums of the counts of the I & -I chunks ending with chunk I - 1.
+   Changing the counts of a chunk updates a logarithmic number of
+   nodes; inserting or removing chunks rebuilds the tree, in linear
+   time, but that only happens after a lot of text has changed.
+
+   Like the region cache, we don't keep the index accurate while the
+   buffer is modified.  We just remember how many characters are
+   unchanged at the beginning and the end of the buffer, and recount
+   the chunks in between the next time the index is consulted.  */
+
+/* The size chunks are made when they are (re)counted.  */
+enum { LINE_INDEX_CHUNK = 8 * 1024 };
+
+/* The kinds of things we count.  */
+enum { LI_BYTES, LI_CHARS, LI_LINES, LI_NCOUNTS };
+
+struct line_counts
+{
+  ptrdiff_t n[LI_NCOUNTS];
+};
+
+struct line_index
+{
+  /* The counts for each chunk, in buffer order.  */
+  struct line_counts *chunks;
+
+  /* The Fenwick tree over CHUNKS.  tree[0] is not used.  */
+  struct line_counts *tree;
+
+  /* The number of chunks, and the number of elements allocated to
+     CHUNKS; TREE has room for one more.  */
+  ptrdiff_t nchunks, size;
+
+  /* The largest power of two not greater than NCHUNKS, or zero.  */
+  ptrdiff_t top;
+
+  /* The counts for the whole buffer, as of the last revalidation.  */
+  struct line_counts total;
+
+  /* The number of chars unchanged at the beginning and at the end of
+     the buffer since the last revalidation.  They add up to more than
+     total.n[LI_CHARS] when the buffer is entirely unchanged.  */
+  ptrdiff_t beg_unchanged, end_unchanged;
+
+  /* BUF_CHARS_MODIFF of the buffer as of the last revalidation.  */
+  modiff_count modiff;
+
+  /* True if no modification has been started since the last
+     revalidation, or since the last one was completed.  Only then
+     can the index be revalidated on behalf of code that might run in
+     the middle of a modification, like the position conversion
+     functions in marker.c.  */
+  bool settled;
+};
+
+static void
+add_counts (struct line_counts *sum, struct line_counts const *c)
+{
+  for (int k = 0; k < LI_NCOUNTS; k++)
+    sum->n[k] += c->n[k];
+}
+
+static void
+subtract_counts (struct line_counts *sum, struct line_counts const *c)
+{
+  for (int k = 0; k < LI_NCOUNTS; k++)
+    sum->n[k] -= c->n[k];
+}
+
+
+/* Maintaining the tree.  */
+
+/* Rebuild the tree of LI and its totals from LI->chunks.  */
+static void
+rebuild_line_index_tree (struct line_index *li)
+{
+  ptrdiff_t n = li->nchunks;
+
+  memset (&li->total, 0, sizeof li->total);
+  for (ptrdiff_t i = 1; i <= n; i++)
+    {
+      li->tree[i] = li->chunks[i - 1];
+      add_counts (&li->total, &li->chunks[i - 1]);
+    }
+  for (ptrdiff_t i = 1; i <= n; i++)
+    {
+      ptrdiff_t parent = i + (i & -i);
+      if (parent <= n)
+	add_counts (&li->tree[parent], &li->tree[i]);
+    }
+
+  for (li->top = n ? 1 : 0; li->top && li->top <= n / 2; li->top *= 2)
+    continue;
+}
+
+/* Add DELTA to the counts of chunk I of LI.  */
+static void
+add_to_chunk (struct line_index *li, ptrdiff_t i,
+	      struct line_counts const *delta)
+{
+  add_counts (&li->chunks[i], delta);
+  add_counts (&li->total, delta);
+  for (i++; i <= li->nchunks; i += i & -i)
+    add_counts (&li->tree[i], delta);
+}
+
+/* Return the number of chunks at the start of LI whose counts of kind
+   K add up to less than TARGET.  That is the index of the chunk where
+   the total reaches TARGET, if it does.  Store the sums of the counts
+   of those chunks in *BEFORE.  */
+static ptrdiff_t
+find_chunk (struct line_index *li, int k, ptrdiff_t target,
+	    struct line_counts *before)
+{
+  ptrdiff_t i = 0;
+
+  memset (before, 0, sizeof *before);
+  for (ptrdiff_t step = li->top; step; step /= 2)
+    if (i + step <= li->nchunks
+	&& before->n[k] + li->tree[i + step].n[k] < target)
+      {
+	i += step;
+	add_counts (before, &li->tree[i]);
+      }
+  return i;
+}
+
+
+/* Looking at the text.  */
+
+/* Return the number of newlines between byte positions FROM and TO
+   of BUF.  */
+static ptrdiff_t
+buf_count_newlines (struct buffer *buf, ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t n = 0;
+
+  if (from < BUF_GPT_BYTE (buf))
+    {
+      ptrdiff_t stop = min (to, BUF_GPT_BYTE (buf));
+      n += count_newlines (BUF_BYTE_ADDRESS (buf, from), stop - from);
+      from = stop;
+    }
+  if (from < to)
+    n += count_newlines (BUF_BYTE_ADDRESS (buf, from), to - from);
+  return n;
+}
+
+/* Return the number of characters between byte positions FROM and TO
+   of BUF.  */
+static ptrdiff_t
+buf_count_chars (struct buffer *buf, ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t n = 0;
+
+  if (NILP (BVAR (buf, enable_multibyte_characters)))
+    return to - from;
+
+  while (from < to)
+    {
+      ptrdiff_t stop = (from < BUF_GPT_BYTE (buf)
+			? min (to, BUF_GPT_BYTE (buf)) : to);
+      unsigned char *p = BUF_BYTE_ADDRESS (buf, from);
+      unsigned char *lim = p + (stop - from);
+      for (; p < lim; p++)
+	n += CHAR_HEAD_P (*p);
+      from = stop;
+    }
+  return n;
+}
+
+/* Return the byte position just after the Nth newline of BUF at or
+   after byte position FROM.  There must be at least N of them.  */
+static ptrdiff_t
+buf_after_newline (struct buffer *buf, ptrdiff_t from, ptrdiff_t n)
+{
+  while (true)
+    {
+      ptrdiff_t stop = (from < BUF_GPT_BYTE (buf)
+			? BUF_GPT_BYTE (buf) : BUF_Z_BYTE (buf));
+      unsigned char *base = BUF_BYTE_ADDRESS (buf, from);
+      unsigned char *p = base, *lim = base + (stop - from);
+
+      eassert (from < BUF_Z_BYTE (buf));
+      while ((p = memchr (p, '\n', lim - p)))
+	{
+	  p++;
+	  if (--n == 0)
+	    return from + (p - base);
+	}
+      from = stop;
+    }
+}
+
+
+/* Allocating, invalidating and revalidating the index.  */
+
+void
+free_line_index (struct line_index *li)
+{
+  xfree (li->chunks);
+  xfree (li->tree);
+  xfree (li);
+}
+
+void
+invalidate_line_index (struct buffer *buf, struct line_index *li,
+		       ptrdiff_t head, ptrdiff_t tail)
+{
+  if (head < li->beg_unchanged)
+    li->beg_unchanged = head;
+  if (tail < li->end_unchanged)
+    li->end_unchanged = tail;
+  li->settled = false;
+}
+
+/* Recount the chunks of LI that overlap the text of BUF changed since
+   the last revalidation, and make the index accurate again.  */
+static void
+revalidate_line_index (struct buffer *buf, struct line_index *li)
+{
+  ptrdiff_t head = li->beg_unchanged, tail = li->end_unchanged;
+  ptrdiff_t old_chars = li->total.n[LI_CHARS];
+  struct line_counts first, last;
+  ptrdiff_t i, j;
+
+  /* If the text was changed without invalidating the index, we can't
+     know which part of it is still good.  */
+  if (head + tail > old_chars
+      && (li->modiff != BUF_CHARS_MODIFF (buf)
+	  || old_chars != BUF_Z (buf) - BUF_BEG (buf)
+	  || li->total.n[LI_BYTES] != BUF_Z_BYTE (buf) - BUF_BEG_BYTE (buf)))
+    {
+      memset (&li->total, 0, sizeof li->total);
+      li->nchunks = li->top = 0;
+      head = tail = old_chars = 0;
+    }
+
+  if (head + tail > old_chars)
+    return;
+
+  /* Chunks I through J - 1 overlap the modified text, as far as the
+     index can tell.  Chunks before them are in the unchanged head,
+     and those after are in the unchanged tail, so their counts are
+     still good; only their positions may have moved.  */
+  i = find_chunk (li, LI_CHARS, head + 1, &first);
+  j = find_chunk (li, LI_CHARS, old_chars - tail + 1, &last);
+  if (last.n[LI_CHARS] < old_chars - tail)
+    add_counts (&last, &li->chunks[j++]);
+
+  /* An insertion at a chunk boundary overlaps no chunk; recount one
+     of its neighbors along with it, so it doesn't make a new chunk
+     of its own.  */
+  if (i == j)
+    {
+      if (j < li->nchunks)
+	add_counts (&last, &li->chunks[j++]);
+      else if (i > 0)
+	subtract_counts (&first, &li->chunks[--i]);
+    }
+
+  /* The bytes of BUF now occupied by chunks I through J - 1.  */
+  ptrdiff_t from = BUF_BEG_BYTE (buf) + first.n[LI_BYTES];
+  ptrdiff_t to = (BUF_Z_BYTE (buf)
+		  - (li->total.n[LI_BYTES] - last.n[LI_BYTES]));
+  eassert (from <= to);
+
+  if (j - i == 1 && from < to && to - from <= 2 * LINE_INDEX_CHUNK)
+    {
+      /* The common case: the changes are within a single chunk, which
+	 didn't grow too big.  */
+      struct line_counts delta;
+
+      delta.n[LI_BYTES] = to - from;
+      delta.n[LI_CHARS] = buf_count_chars (buf, from, to);
+      delta.n[LI_LINES] = buf_count_newlines (buf, from, to);
+      subtract_counts (&delta, &li->chunks[i]);
+      add_to_chunk (li, i, &delta);
+    }
+  else
+    {
+      /* Replace chunks I through J - 1 with new chunks for the text
+	 between FROM and TO.  Chunks are never shorter than
+	 LINE_INDEX_CHUNK - MAX_MULTIBYTE_LENGTH + 1 bytes, except
+	 the last one, which bounds their number.  */
+      ptrdiff_t tail_chunks = li->nchunks - j;
+      ptrdiff_t room = (to - from) / (LINE_INDEX_CHUNK
+				      - MAX_MULTIBYTE_LENGTH + 1) + 1;
+      ptrdiff_t needed = i + room + tail_chunks;
+      bool multibyte = !NILP (BVAR (buf, enable_multibyte_characters));
+
+      if (li->size < needed)
+	{
+	  li->chunks = xpalloc (li->chunks, &li->size, needed - li->size,
+				-1, sizeof *li->chunks);
+	  li->tree = xnrealloc (li->tree, li->size + 1, sizeof *li->tree);
+	}
+      memmove (li->chunks + i + room, li->chunks + j,
+	       tail_chunks * sizeof *li->chunks);
+
+      ptrdiff_t n = i;
+      while (from < to)
+	{
+	  ptrdiff_t stop = min (from + LINE_INDEX_CHUNK, to);
+	  if (multibyte)
+	    while (stop < to && !CHAR_HEAD_P (BUF_FETCH_BYTE (buf, stop)))
+	      stop--;
+	  li->chunks[n].n[LI_BYTES] = stop - from;
+	  li->chunks[n].n[LI_CHARS] = buf_count_chars (buf, from, stop);
+	  li->chunks[n].n[LI_LINES] = buf_count_newlines (buf, from, stop);
+	  n++;
+	  from = stop;
+	}
+      eassert (n <= i + room);
+
+      memmove (li->chunks + n, li->chunks + i + room,
+	       tail_chunks * sizeof *li->chunks);
+      li->nchunks = n + tail_chunks;
+      rebuild_line_index_tree (li);
+    }
+
+  eassert (li->total.n[LI_BYTES] == BUF_Z_BYTE (buf) - BUF_BEG_BYTE (buf));
+  eassert (li->total.n[LI_CHARS] == BUF_Z (buf) - BUF_BEG (buf));
+
+  /* Now the entire index is valid.  */
+  li->beg_unchanged = li->end_unchanged = li->total.n[LI_CHARS] + 1;
+  li->modiff = BUF_CHARS_MODIFF (buf);
+}
+
+struct line_index *
+buffer_line_index (struct buffer *buf)
+{
+  /* Indirect buffers share the index of their base buffer, just like
+     its text.  */
+  if (buf->base_buffer)
+    buf = buf->base_buffer;
+
+  if (NILP (BVAR (buf, cache_long_scans)))
+    {
+      if (buf->line_index)
+	{
+	  free_line_index (buf->line_index);
+	  buf->line_index = NULL;
+	}
+      return NULL;
+    }
+
+  /* A new index knows of no chunks and no unchanged text, so it is
+     filled in by the revalidation below.  */
+  if (!buf->line_index)
+    {
+      buf->line_index = xzalloc (sizeof *buf->line_index);
+      __lsan_ignore_object (buf->line_index);
+    }
+  revalidate_line_index (buf, buf->line_index);
+
+  /* Our callers search for newlines, which they never do between the
+     invalidation of the buffer caches and the modification itself.  */
+  buf->line_index->settled = true;
+  return buf->line_index;
+}
+
+struct line_index *
+settled_line_index (struct buffer *buf)
+{
+  if (buf->base_buffer)
+    buf = buf->base_buffer;
+
+  if (!buf->line_index || !buf->line_index->settled
+      || NILP (BVAR (buf, cache_long_scans)))
+    return NULL;
+  revalidate_line_index (buf, buf->line_index);
+  return buf->line_index;
+}
+
+void
+settle_line_index (struct buffer *buf)
+{
+  if (buf->base_buffer)
+    buf = buf->base_buffer;
+
+  if (NILP (BVAR (buf, cache_long_scans)))
+    return;
+
+  /* Large buffers with non-ASCII text get an index as soon as they
+     are modified, because converting between character and byte
+     positions in them is otherwise costly.  It is filled in the next
+     time it is consulted.  */
+  if (!buf->line_index
+      && LINE_INDEX_MIN_SPAN <= BUF_Z (buf) - BUF_BEG (buf)
+      && BUF_Z (buf) != BUF_Z_BYTE (buf))
+    {
+      buf->line_index = xzalloc (sizeof *buf->line_index);
+      __lsan_ignore_object (buf->line_index);
+    }
+  if (buf->line_index)
+    buf->line_index->settled = true;
+}
+
+
+/* Using the index.  */
+
+ptrdiff_t
+line_index_newlines_before (struct buffer *buf, struct line_index *li,
+			    ptrdiff_t bytepos)
+{
+  struct line_counts before;
+
+  find_chunk (li, LI_BYTES, bytepos - BUF_BEG_BYTE (buf) + 1, &before);
+  return (before.n[LI_LINES]
+	  + buf_count_newlines (buf, BUF_BEG_BYTE (buf) + before.n[LI_BYTES],
+				bytepos));
+}
+
+void
+line_index_chunk_bounds (struct buffer *buf, struct line_index *li,
+			 ptrdiff_t pos, bool byte,
+			 ptrdiff_t *below, ptrdiff_t *below_byte,
+			 ptrdiff_t *above, ptrdiff_t *above_byte)
+{
+  struct line_counts before;
+  ptrdiff_t i;
+
+  if (byte)
+    i = find_chunk (li, LI_BYTES, pos - BUF_BEG_BYTE (buf) + 1, &before);
+  else
+    i = find_chunk (li, LI_CHARS, pos - BUF_BEG (buf) + 1, &before);
+  *below = *above = BUF_BEG (buf) + before.n[LI_CHARS];
+  *below_byte = *above_byte = BUF_BEG_BYTE (buf) + before.n[LI_BYTES];
+  if (i < li->nchunks)
+    {
+      *above += li->chunks[i].n[LI_CHARS];
+      *above_byte += li->chunks[i].n[LI_BYTES];
+    }
+}
+
+bool
+line_index_after_newline (struct buffer *buf, struct line_index *li,
+			  ptrdiff_t n, ptrdiff_t *charpos, ptrdiff_t *bytepos)
+{
+  struct line_counts before;
+
+  if (n <= 0 || li->total.n[LI_LINES] < n)
+    return false;
+
+  find_chunk (li, LI_LINES, n, &before);
+  ptrdiff_t from = BUF_BEG_BYTE (buf) + before.n[LI_BYTES];
+  ptrdiff_t pos = buf_after_newline (buf, from, n - before.n[LI_LINES]);
+  *bytepos = pos;
+  *charpos = (BUF_BEG (buf) + before.n[LI_CHARS]
+	      + buf_count_chars (buf, from, pos));
+  return true;
+}
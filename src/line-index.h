@@ -0,0 +1,91 @@
+/* Indexing the lines of a buffer, for optimization.
+
+Copyright (C) 2026 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+#ifndef EMACS_LINE_INDEX_H
+#define EMACS_LINE_INDEX_H
+
+/* The newline cache (see region-cache.h) only knows which stretches
+   of text have no newlines, so finding the line number of a position
+   near the end of a large buffer still means counting every newline
+   before it.  The line index remembers how many newlines each chunk
+   of a few kilobytes of text holds, in a Fenwick tree, so that the
+   line number of any position, and the position of any line, can be
+   found in logarithmic time plus a scan of at most one chunk.
+
+   Like the region caches, the index is invalidated by the buffer
+   modification primitives (see invalidate_buffer_caches) and brought
+   up to date lazily, the next time it is consulted, by recounting
+   only the chunks that overlap the modified text.  */
+
+struct buffer;
+struct line_index;
+
+/* Scans shorter than this many bytes are not worth consulting the
+   line index for.  */
+enum { LINE_INDEX_MIN_SPAN = 64 * 1024 };
+
+/* Likewise for looking for fewer newlines than this.  */
+enum { LINE_INDEX_MIN_LINES = 256 };
+
+/* Free a line index.  */
+extern void free_line_index (struct line_index *);
+
+/* Return the line index of BUF, creating it if needed, or NULL if BUF
+   should not have one.  */
+extern struct line_index *buffer_line_index (struct buffer *buf);
+
+/* Return the line index of BUF if it can be brought up to date even
+   in the middle of a modification of BUF, or NULL.  */
+extern struct line_index *settled_line_index (struct buffer *buf);
+
+/* Note that a modification of BUF is complete.  */
+extern void settle_line_index (struct buffer *buf);
+
+/* Indicate that a section of BUF has changed, to invalidate INDEX.
+   HEAD and TAIL are the number of chars unchanged at the beginning
+   and the end of the buffer, as for invalidate_region_cache.  */
+extern void invalidate_line_index (struct buffer *buf,
+				   struct line_index *index,
+				   ptrdiff_t head, ptrdiff_t tail);
+
+/* Return the number of newlines in BUF before byte position
+   BYTEPOS.  */
+extern ptrdiff_t line_index_newlines_before (struct buffer *buf,
+					     struct line_index *index,
+					     ptrdiff_t bytepos);
+
+/* Find the position just after the Nth newline of BUF, counting from
+   one, and store it in *CHARPOS and *BYTEPOS.  Return false if BUF
+   has fewer than N newlines.  */
+extern bool line_index_after_newline (struct buffer *buf,
+				      struct line_index *index,
+				      ptrdiff_t n, ptrdiff_t *charpos,
+				      ptrdiff_t *bytepos);
+
+/* Find the chunk of INDEX containing position POS of BUF, a byte
+   position if BYTE is true, and a character position otherwise.
+   Store the character and byte positions of its start in *BELOW and
+   *BELOW_BYTE, and those of its end in *ABOVE and *ABOVE_BYTE.  */
+extern void line_index_chunk_bounds (struct buffer *buf,
+				     struct line_index *index,
+				     ptrdiff_t pos, bool byte,
+				     ptrdiff_t *below, ptrdiff_t *below_byte,
+				     ptrdiff_t *above, ptrdiff_t *above_byte);
+
+#endif /* EMACS_LINE_INDEX_H */
@@ -824,7 +824,9 @@ #define XUNTAG(a, type, ctype) \
   {
     struct
     {
-      bool_bf gcmarkbit : 1;
+      /* Not a bit-field, so that the threads of a parallel mark can
+	 set it without touching the fields below.  */
+      bool gcmarkbit;
 
       /* Indicates where the value can be found.  */
       ENUM_BF (symbol_redirect) redirect : 2;
@@ -1042,6 +1044,8 @@ DEFINE_GDB_SYMBOL_END (PSEUDOVECTOR_FLAG)
   PVEC_THREAD,
   PVEC_MUTEX,
   PVEC_CONDVAR,
+  PVEC_CHANNEL,
+  PVEC_ASYNC_FUTURE,
   PVEC_MODULE_FUNCTION,
   PVEC_NATIVE_COMP_UNIT,
   PVEC_TS_PARSER,
@@ -1427,6 +1431,8 @@ #define XSETSUB_CHAR_TABLE(a, b) XSETPSEUDOVECTOR (a, b, PVEC_SUB_CHAR_TABLE)
 #define XSETTHREAD(a, b) XSETPSEUDOVECTOR (a, b, PVEC_THREAD)
 #define XSETMUTEX(a, b) XSETPSEUDOVECTOR (a, b, PVEC_MUTEX)
 #define XSETCONDVAR(a, b) XSETPSEUDOVECTOR (a, b, PVEC_CONDVAR)
+#define XSETCHANNEL(a, b) XSETPSEUDOVECTOR (a, b, PVEC_CHANNEL)
+#define XSETASYNC_FUTURE(a, b) XSETPSEUDOVECTOR (a, b, PVEC_ASYNC_FUTURE)
 #define XSETNATIVE_COMP_UNIT(a, b) XSETPSEUDOVECTOR (a, b, PVEC_NATIVE_COMP_UNIT)
 
 /* Efficiently convert a pointer to a Lisp object and back.  The
@@ -1539,6 +1545,56 @@ xcdr_addr (Lisp_Object c)
   return lisp_h_XCDR (c);
 }
 
+/* True if the cons cells and floats that survived the last garbage
+   collection are still marked.  A minor collection does not look
+   inside such cons cells unless told that they were made to point to
+   another cons or float; see 'note_cons_store'.  */
+extern bool gc_old_conses_marked;
+
+/* True while an incremental garbage collection is marking, between
+   slices of its mark phase.  The collection must then be told of every
+   store into a cons cell it has already marked.  */
+extern bool gc_marking_incrementally;
+extern void note_old_cons_store (struct Lisp_Cons *);
+
+/* Tell the garbage collector that the cons cell C is about to be made
+   to point to N.  Code that stores into a cons cell without going
+   through XSETCAR or XSETCDR must call this first.  */
+INLINE void
+note_cons_store (Lisp_Object c, Lisp_Object n)
+{
+  if (gc_marking_incrementally
+      ? !FIXNUMP (n)
+      : (gc_old_conses_marked
+	 && (TAGGEDP (n, Lisp_Cons) || TAGGEDP (n, Lisp_Float))))
+    note_old_cons_store (XCONS (c));
+}
+
+extern void note_old_object_store (Lisp_Object);
+extern void note_traced_object (Lisp_Object);
+
+/* Tell the garbage collector that the vector, record, char-table or
+   symbol OBJ may now point to conses or floats it did not point to
+   before.  A minor collection looks inside such an object only if told
+   so, since it takes what an old one points to to be old as well.  */
+INLINE void
+note_object_stores (Lisp_Object obj)
+{
+  if (gc_old_conses_marked)
+    note_old_object_store (obj);
+}
+
+/* Likewise, but only if OBJ has just been made to point to N.  Code
+   that stores into such an object without going through ASET and the
+   setters below must call this afterwards.  */
+INLINE void
+note_object_store (Lisp_Object obj, Lisp_Object n)
+{
+  if (gc_old_conses_marked
+      && (TAGGEDP (n, Lisp_Cons) || TAGGEDP (n, Lisp_Float)))
+    note_old_object_store (obj);
+}
+
 /* Use these to set the fields of a cons cell.
 
    Note that both arguments may refer to the same object, so 'n'
@@ -1546,11 +1602,13 @@ xcdr_addr (Lisp_Object c)
 INLINE void
 XSETCAR (Lisp_Object c, Lisp_Object n)
 {
+  note_cons_store (c, n);
   *xcar_addr (c) = n;
 }
 INLINE void
 XSETCDR (Lisp_Object c, Lisp_Object n)
 {
+  note_cons_store (c, n);
   *xcdr_addr (c) = n;
 }
 
@@ -2013,6 +2071,7 @@ ASET (Lisp_Object array, ptrdiff_t idx, Lisp_Object val)
 {
   eassert (0 <= idx && idx < ASIZE (array));
   XVECTOR (array)->contents[idx] = val;
+  note_object_store (array, val);
 }
 
 INLINE void
@@ -2022,6 +2081,7 @@ gc_aset (Lisp_Object array, ptrdiff_t idx, Lisp_Object val)
      sweep_weak_table calls set_hash_key etc. while the table is marked.  */
   eassert (0 <= idx && idx < gc_asize (array));
   XVECTOR (array)->contents[idx] = val;
+  note_object_store (array, val);
 }
 
 /* True, since Qnil's representation is zero.  Every place in the code
@@ -2356,6 +2416,7 @@ SET_SYMBOL_VAL (struct Lisp_Symbol *sym, Lisp_Object v)
 {
   eassert (sym->u.s.redirect == SYMBOL_PLAINVAL);
   sym->u.s.val.value = v;
+  note_object_store (make_lisp_symbol (sym), v);
 }
 
 INLINE void
@@ -2369,6 +2430,10 @@ SET_SYMBOL_BLV (struct Lisp_Symbol *sym, struct Lisp_Buffer_Local_Value *v)
 {
   eassume (sym->u.s.redirect == SYMBOL_LOCALIZED && v);
   sym->u.s.val.blv = v;
+  /* The value cells of V change as buffers are switched, so minor
+     collections must always look inside SYM.  */
+  if (gc_old_conses_marked)
+    note_traced_object (make_lisp_symbol (sym));
 }
 INLINE void
 SET_SYMBOL_FWD (struct Lisp_Symbol *sym, void const *v)
@@ -2866,6 +2931,9 @@ knuth_hash (hash_hash_t hash, unsigned bits)
      leaves the marker after the inserted text.  */
   bool_bf insertion_type : 1;
 
+  /* True if this marker is red in the tree of markers.  */
+  bool_bf red : 1;
+
   /* The remaining fields are meaningless in a marker that
      does not point anywhere.  */
 
@@ -2873,15 +2941,32 @@ knuth_hash (hash_hash_t hash, unsigned bits)
      this is used to chain of all the markers in a given buffer.
      The chain does not preserve markers from garbage collection;
      instead, markers are removed from the chain when freed by GC.  */
-  /* We could remove it and use an array in buffer_text instead.
-     That would also allow us to preserve it ordered.  */
   struct Lisp_Marker *next;
-  /* This is the char position where the marker points.  */
+
+  /* The markers that point somewhere are also kept in a red-black
+     tree ordered by position, so that they can be relocated without
+     looking at each of them; see marker.c.  Like the chain, the tree
+     does not preserve markers from garbage collection.  */
+  struct Lisp_Marker *parent, *left, *right;
+
+  /* Amounts to add to the positions of all the markers in the subtree
+     rooted at this one, including this one, to get their actual
+     positions.  */
+  ptrdiff_t char_offset, byte_offset;
+
+  /* If equal to the BUF_MARKER_OTICK of the buffer, the offsets of
+     the ancestors of this marker are all zero, so that its positions
+     below are up to date.  */
+  uintmax_t otick;
+
+  /* This is the char position where the marker points.
+     Use marker_charpos to read it, and marker_tree_move to change it.  */
   ptrdiff_t charpos;
   /* This is the byte position.
      It's mostly used as a charpos<->bytepos cache (i.e. it's not directly
      used to implement the functionality of markers, but rather to (ab)use
-     markers as a cache for char<->byte mappings).  */
+     markers as a cache for char<->byte mappings).
+     Use marker_bytepos to read it.  */
   ptrdiff_t bytepos;
 } GCALIGNED_STRUCT;
 
@@ -4023,6 +4108,7 @@ vcopy (Lisp_Object v, ptrdiff_t offset, Lisp_Object const *args,
 {
   eassert (0 <= offset && 0 <= count && offset + count <= ASIZE (v));
   memcpy (xvector_contents_addr (v, offset), args, count * sizeof *args);
+  note_object_stores (v);
 }
 
 /* Functions to modify hash tables.  */
@@ -4048,12 +4134,14 @@ set_hash_value_slot (struct Lisp_Hash_Table *h, ptrdiff_t idx, Lisp_Object val)
 set_symbol_function (Lisp_Object sym, Lisp_Object function)
 {
   XSYMBOL (sym)->u.s.function = function;
+  note_object_store (sym, function);
 }
 
 INLINE void
 set_symbol_plist (Lisp_Object sym, Lisp_Object plist)
 {
   XSYMBOL (sym)->u.s.plist = plist;
+  note_object_store (sym, plist);
 }
 
 INLINE void
@@ -4099,6 +4187,10 @@ string_intervals (Lisp_Object s)
 set_string_intervals (Lisp_Object s, INTERVAL i)
 {
   XSTRING (s)->u.s.intervals = i;
+  /* Text properties change without telling the collector, so minor
+     collections must look inside every string that has them.  */
+  if (i && gc_old_conses_marked)
+    note_traced_object (s);
 }
 
 /* Set a Lisp slot in TABLE to VAL.  Most code should use this instead
@@ -4108,11 +4200,13 @@ set_string_intervals (Lisp_Object s, INTERVAL i)
 set_char_table_defalt (Lisp_Object table, Lisp_Object val)
 {
   XCHAR_TABLE (table)->defalt = val;
+  note_object_store (table, val);
 }
 INLINE void
 set_char_table_purpose (Lisp_Object table, Lisp_Object val)
 {
   XCHAR_TABLE (table)->purpose = val;
+  note_object_store (table, val);
 }
 
 /* Set different slots in (sub)character tables.  */
@@ -4122,6 +4216,7 @@ set_char_table_extras (Lisp_Object table, ptrdiff_t idx, Lisp_Object val)
 {
   eassert (0 <= idx && idx < CHAR_TABLE_EXTRA_SLOTS (XCHAR_TABLE (table)));
   XCHAR_TABLE (table)->extras[idx] = val;
+  note_object_store (table, val);
 }
 
 INLINE void
@@ -4129,12 +4224,14 @@ set_char_table_contents (Lisp_Object table, ptrdiff_t idx, Lisp_Object val)
 {
   eassert (0 <= idx && idx < (1 << CHARTAB_SIZE_BITS_0));
   XCHAR_TABLE (table)->contents[idx] = val;
+  note_object_store (table, val);
 }
 
 INLINE void
 set_sub_char_table_contents (Lisp_Object table, ptrdiff_t idx, Lisp_Object val)
 {
   XSUB_CHAR_TABLE (table)->contents[idx] = val;
+  note_object_store (table, val);
 }
 
 /* Defined in bignum.c.  This part of bignum.c's API does not require
@@ -4292,6 +4389,9 @@ #define CONS_TO_INTEGER(cons, type, var)				\
 struct charset;
 
 /* Defined in syntax.c.  */
+extern void free_syntax_ppss_cache (struct buffer *);
+extern void invalidate_syntax_ppss_cache (struct buffer *, ptrdiff_t);
+extern void mark_syntax_ppss_cache (struct buffer *);
 extern void init_syntax_once (void);
 extern void syms_of_syntax (void);
 
@@ -4532,6 +4632,7 @@ flush_stack_call_func (void (*func) (void *arg), void *arg)
 
 extern void garbage_collect (void);
 extern void maybe_garbage_collect (void);
+extern void mark_incrementally (void);
 extern bool maybe_garbage_collect_eagerly (EMACS_INT factor);
 extern const char *pending_malloc_warning;
 extern Lisp_Object zero_vector;
@@ -5030,6 +5131,21 @@ XMODULE_FUNCTION (Lisp_Object o)
 extern Lisp_Object set_marker_restricted_both (Lisp_Object, Lisp_Object,
                                                ptrdiff_t, ptrdiff_t);
 extern Lisp_Object build_marker (struct buffer *, ptrdiff_t, ptrdiff_t);
+extern void marker_tree_validate (struct Lisp_Marker *);
+extern void marker_tree_validate_all (struct buffer *);
+extern void marker_tree_insert (struct Lisp_Marker *);
+extern void marker_tree_remove (struct Lisp_Marker *);
+extern void marker_tree_clear (struct buffer *);
+extern void marker_tree_move (struct Lisp_Marker *, ptrdiff_t, ptrdiff_t);
+extern void marker_tree_insert_gap (struct buffer *, ptrdiff_t, ptrdiff_t,
+				    ptrdiff_t, ptrdiff_t, bool);
+extern void marker_tree_collapse (struct buffer *, ptrdiff_t, ptrdiff_t,
+				  ptrdiff_t);
+extern void marker_tree_shift (struct buffer *, ptrdiff_t, bool,
+			       ptrdiff_t, ptrdiff_t);
+extern struct Lisp_Marker *marker_tree_first_after (struct buffer *,
+						    ptrdiff_t);
+extern struct Lisp_Marker *marker_tree_next (struct Lisp_Marker *);
 extern void syms_of_marker (void);
 
 /* Defined in fileio.c.  */
@@ -5062,6 +5178,7 @@ XMODULE_FUNCTION (Lisp_Object o)
 
 /* Defined in search.c.  */
 extern void shrink_regexp_cache (void);
+extern void mark_regexp_cache (void);
 extern void restore_search_regs (void);
 extern void update_search_regs (ptrdiff_t oldstart,
                                 ptrdiff_t oldend, ptrdiff_t newend);
@@ -5111,6 +5228,10 @@ fast_c_string_match_ignore_case (Lisp_Object regexp,
 				       ptrdiff_t, ptrdiff_t *);
 extern ptrdiff_t find_before_next_newline (ptrdiff_t, ptrdiff_t,
 					   ptrdiff_t, ptrdiff_t *);
+extern ptrdiff_t count_newlines (unsigned char const *, ptrdiff_t);
+/* Scanners looking for a distant newline count newlines this many
+   bytes at a time.  */
+enum { NEWLINE_SCAN_BLOCK = 4096 };
 extern EMACS_INT search_buffer (Lisp_Object, ptrdiff_t, ptrdiff_t,
 				ptrdiff_t, ptrdiff_t, EMACS_INT,
 				bool, Lisp_Object, Lisp_Object, bool);
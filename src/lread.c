@@ -353,8 +353,8 @@ readchar (Lisp_Object readcharfun, bool *multibyte)
 	  bytepos++;
 	}
 
-      XMARKER (readcharfun)->bytepos = bytepos;
-      XMARKER (readcharfun)->charpos++;
+      marker_tree_move (XMARKER (readcharfun),
+			marker_charpos (XMARKER (readcharfun)) + 1, bytepos);
 
       return c;
     }
@@ -503,15 +503,15 @@ unreadchar (Lisp_Object readcharfun, int c)
   else if (MARKERP (readcharfun))
     {
       struct buffer *b = XMARKER (readcharfun)->buffer;
-      ptrdiff_t bytepos = XMARKER (readcharfun)->bytepos;
+      ptrdiff_t bytepos = marker_bytepos (XMARKER (readcharfun));
 
-      XMARKER (readcharfun)->charpos--;
       if (! NILP (BVAR (b, enable_multibyte_characters)))
 	bytepos -= buf_prev_char_len (b, bytepos);
       else
 	bytepos--;
 
-      XMARKER (readcharfun)->bytepos = bytepos;
+      marker_tree_move (XMARKER (readcharfun),
+			marker_charpos (XMARKER (readcharfun)) - 1, bytepos);
     }
   else if (STRINGP (readcharfun))
     {
@@ -28,6 +28,7 @@
 #include "lisp.h"
 #include "character.h"
 #include "buffer.h"
+#include "line-index.h"
 #include "window.h"
 
 /* Record one cached position found recently by
@@ -82,12 +83,606 @@ clear_charpos_cache (struct buffer *b)
     cached_buffer = 0;
 }
 
+/* Keeping markers in order.
+
+   Besides being chained together, the markers of a buffer text are
+   kept in a red-black tree ordered by character position, so that
+   relocating them for an insertion or deletion takes time logarithmic
+   in their number, instead of linear.  This works like the interval
+   tree of overlays (see itree.c): the CHAR_OFFSET and BYTE_OFFSET of
+   a marker are amounts yet to be added to the positions of all the
+   markers in the subtree rooted at it, itself included, so that all
+   the markers after an insertion or deletion can be relocated by
+   changing the offsets of a logarithmic number of them.  The offsets
+   are passed on to the children of a marker whenever we walk past it.
+
+   Each time an offset is changed, the BUF_MARKER_OTICK of the buffer
+   is incremented.  The ancestors of a marker whose own OTICK is equal
+   to it have no offsets, so its positions are up to date; otherwise,
+   marker_tree_validate applies the offsets of its ancestors.  Markers
+   at the same position are in no particular order.  */
+
+/* Apply the offsets of marker M to its positions, and pass them on to
+   its children.  OTICK is the otick of its tree.  */
+
+static void
+marker_inherit_offset (uintmax_t otick, struct Lisp_Marker *m)
+{
+  eassert (!m->parent || m->parent->otick >= m->otick);
+  if (m->otick == otick)
+    {
+      eassert (m->char_offset == 0 && m->byte_offset == 0);
+      return;
+    }
+
+  if (m->char_offset || m->byte_offset)
+    {
+      m->charpos += m->char_offset;
+      m->bytepos += m->byte_offset;
+      if (m->left)
+	{
+	  m->left->char_offset += m->char_offset;
+	  m->left->byte_offset += m->byte_offset;
+	}
+      if (m->right)
+	{
+	  m->right->char_offset += m->char_offset;
+	  m->right->byte_offset += m->byte_offset;
+	}
+      m->char_offset = m->byte_offset = 0;
+    }
+
+  if (!m->parent || m->parent->otick == otick)
+    m->otick = otick;
+}
+
+static void
+marker_validate_1 (uintmax_t otick, struct Lisp_Marker *m)
+{
+  if (m->otick != otick)
+    {
+      if (m->parent)
+	marker_validate_1 (otick, m->parent);
+      marker_inherit_offset (otick, m);
+    }
+}
+
+/* Bring the positions of marker M, which must point somewhere, up to
+   date.  */
+
+void
+marker_tree_validate (struct Lisp_Marker *m)
+{
+  marker_validate_1 (BUF_MARKER_OTICK (m->buffer), m);
+}
+
+/* Return the first marker of the subtree rooted at M, which must not
+   be NULL, with its positions up to date if those of M are.  */
+
+static struct Lisp_Marker *
+marker_subtree_min (uintmax_t otick, struct Lisp_Marker *m)
+{
+  marker_inherit_offset (otick, m);
+  while (m->left)
+    {
+      m = m->left;
+      marker_inherit_offset (otick, m);
+    }
+  return m;
+}
+
+/* Return the marker following marker M, whose positions must be up to
+   date, in the tree of markers, with its positions up to date, or
+   NULL if M is the last one.  */
+
+struct Lisp_Marker *
+marker_tree_next (struct Lisp_Marker *m)
+{
+  uintmax_t otick = BUF_MARKER_OTICK (m->buffer);
+
+  if (m->right)
+    return marker_subtree_min (otick, m->right);
+  while (m->parent && m == m->parent->right)
+    m = m->parent;
+  m = m->parent;
+  if (m)
+    marker_validate_1 (otick, m);
+  return m;
+}
+
+/* Return the first marker of buffer B after char position POS, with
+   its positions up to date, or NULL if there is none.  */
+
+struct Lisp_Marker *
+marker_tree_first_after (struct buffer *b, ptrdiff_t pos)
+{
+  uintmax_t otick = BUF_MARKER_OTICK (b);
+  struct Lisp_Marker *m = BUF_MARKER_TREE (b), *found = NULL;
+
+  while (m)
+    {
+      marker_inherit_offset (otick, m);
+      if (m->charpos > pos)
+	{
+	  found = m;
+	  m = m->left;
+	}
+      else
+	m = m->right;
+    }
+  return found;
+}
+
+/* Bring the positions of all the markers of buffer B up to date, and
+   clear their offsets, so that their CHARPOS and BYTEPOS can be used
+   directly until the next change of the text.  */
+
+void
+marker_tree_validate_all (struct buffer *b)
+{
+  if (BUF_MARKER_TREE (b))
+    for (struct Lisp_Marker *m
+	   = marker_subtree_min (BUF_MARKER_OTICK (b), BUF_MARKER_TREE (b));
+	 m; m = marker_tree_next (m))
+      continue;
+}
+
+/* Remove all the markers of buffer B from its tree of markers, with
+   their positions up to date.  They are still in its chain.  */
+
+void
+marker_tree_clear (struct buffer *b)
+{
+  marker_tree_validate_all (b);
+  for (struct Lisp_Marker *m = BUF_MARKERS (b); m; m = m->next)
+    {
+      m->parent = m->left = m->right = NULL;
+      m->red = false;
+    }
+  BUF_MARKER_TREE (b) = NULL;
+}
+
+/* Perform the familiar left rotation on marker M of buffer text T.  */
+
+static void
+marker_rotate_left (struct buffer_text *t, struct Lisp_Marker *m)
+{
+  struct Lisp_Marker *right = m->right;
+
+  marker_inherit_offset (t->marker_otick, m);
+  marker_inherit_offset (t->marker_otick, right);
+
+  m->right = right->left;
+  if (right->left)
+    right->left->parent = m;
+
+  right->parent = m->parent;
+  if (!m->parent)
+    t->marker_tree = right;
+  else if (m == m->parent->left)
+    m->parent->left = right;
+  else
+    m->parent->right = right;
+
+  right->left = m;
+  m->parent = right;
+}
+
+/* Perform the familiar right rotation on marker M of buffer text T.  */
+
+static void
+marker_rotate_right (struct buffer_text *t, struct Lisp_Marker *m)
+{
+  struct Lisp_Marker *left = m->left;
+
+  marker_inherit_offset (t->marker_otick, m);
+  marker_inherit_offset (t->marker_otick, left);
+
+  m->left = left->right;
+  if (left->right)
+    left->right->parent = m;
+
+  left->parent = m->parent;
+  if (!m->parent)
+    t->marker_tree = left;
+  else if (m == m->parent->right)
+    m->parent->right = left;
+  else
+    m->parent->left = left;
+
+  left->right = m;
+  m->parent = left;
+}
+
+static bool
+marker_red_p (struct Lisp_Marker *m)
+{
+  return m && m->red;
+}
+
+/* Repair the tree of buffer text T after the insertion of the red
+   marker M, which may have a red parent.  */
+
+static void
+marker_insert_fix (struct buffer_text *t, struct Lisp_Marker *m)
+{
+  while (marker_red_p (m->parent))
+    {
+      struct Lisp_Marker *parent = m->parent;
+      struct Lisp_Marker *grandparent = parent->parent;
+
+      if (parent == grandparent->left)
+	{
+	  struct Lisp_Marker *uncle = grandparent->right;
+	  if (marker_red_p (uncle))
+	    {
+	      parent->red = uncle->red = false;
+	      grandparent->red = true;
+	      m = grandparent;
+	    }
+	  else
+	    {
+	      if (m == parent->right)
+		{
+		  m = parent;
+		  marker_rotate_left (t, m);
+		}
+	      m->parent->red = false;
+	      m->parent->parent->red = true;
+	      marker_rotate_right (t, m->parent->parent);
+	    }
+	}
+      else
+	{
+	  struct Lisp_Marker *uncle = grandparent->left;
+	  if (marker_red_p (uncle))
+	    {
+	      parent->red = uncle->red = false;
+	      grandparent->red = true;
+	      m = grandparent;
+	    }
+	  else
+	    {
+	      if (m == parent->left)
+		{
+		  m = parent;
+		  marker_rotate_right (t, m);
+		}
+	      m->parent->red = false;
+	      m->parent->parent->red = true;
+	      marker_rotate_left (t, m->parent->parent);
+	    }
+	}
+    }
+  t->marker_tree->red = false;
+}
+
+/* Insert marker M, which points somewhere, into the tree of markers
+   of its buffer.  Its positions must be up to date.  */
+
+void
+marker_tree_insert (struct Lisp_Marker *m)
+{
+  struct buffer_text *t = m->buffer->text;
+  uintmax_t otick = t->marker_otick;
+  struct Lisp_Marker *parent = NULL, *child = t->marker_tree;
+
+  while (child)
+    {
+      marker_inherit_offset (otick, child);
+      parent = child;
+      child = m->charpos < child->charpos ? child->left : child->right;
+    }
+
+  m->parent = parent;
+  m->left = m->right = NULL;
+  m->char_offset = m->byte_offset = 0;
+  m->otick = otick;
+  m->red = true;
+  if (!parent)
+    t->marker_tree = m;
+  else if (m->charpos < parent->charpos)
+    parent->left = m;
+  else
+    parent->right = m;
+  marker_insert_fix (t, m);
+}
+
+/* Replace DEST with SOURCE as a child of the parent of DEST in buffer
+   text T.  */
+
+static void
+marker_replace_child (struct buffer_text *t, struct Lisp_Marker *source,
+		      struct Lisp_Marker *dest)
+{
+  if (!dest->parent)
+    t->marker_tree = source;
+  else if (dest == dest->parent->left)
+    dest->parent->left = source;
+  else
+    dest->parent->right = source;
+  if (source)
+    source->parent = dest->parent;
+}
+
+/* Repair the tree of buffer text T after the removal of a black
+   marker, which left M, a child of PARENT, short of one black
+   ancestor.  */
+
+static void
+marker_remove_fix (struct buffer_text *t, struct Lisp_Marker *m,
+		   struct Lisp_Marker *parent)
+{
+  while (parent && !marker_red_p (m))
+    {
+      if (m == parent->left)
+	{
+	  struct Lisp_Marker *other = parent->right;
+	  if (other->red)
+	    {
+	      other->red = false;
+	      parent->red = true;
+	      marker_rotate_left (t, parent);
+	      other = parent->right;
+	    }
+	  if (!marker_red_p (other->left) && !marker_red_p (other->right))
+	    {
+	      other->red = true;
+	      m = parent;
+	      parent = m->parent;
+	    }
+	  else
+	    {
+	      if (!marker_red_p (other->right))
+		{
+		  other->left->red = false;
+		  other->red = true;
+		  marker_rotate_right (t, other);
+		  other = parent->right;
+		}
+	      other->red = parent->red;
+	      parent->red = false;
+	      other->right->red = false;
+	      marker_rotate_left (t, parent);
+	      m = t->marker_tree;
+	      parent = NULL;
+	    }
+	}
+      else
+	{
+	  struct Lisp_Marker *other = parent->left;
+	  if (other->red)
+	    {
+	      other->red = false;
+	      parent->red = true;
+	      marker_rotate_right (t, parent);
+	      other = parent->left;
+	    }
+	  if (!marker_red_p (other->right) && !marker_red_p (other->left))
+	    {
+	      other->red = true;
+	      m = parent;
+	      parent = m->parent;
+	    }
+	  else
+	    {
+	      if (!marker_red_p (other->left))
+		{
+		  other->right->red = false;
+		  other->red = true;
+		  marker_rotate_left (t, other);
+		  other = parent->left;
+		}
+	      other->red = parent->red;
+	      parent->red = false;
+	      other->left->red = false;
+	      marker_rotate_right (t, parent);
+	      m = t->marker_tree;
+	      parent = NULL;
+	    }
+	}
+    }
+  if (m)
+    m->red = false;
+}
+
+/* Remove marker M, which points somewhere, from the tree of markers
+   of its buffer, with its positions up to date.  */
+
+void
+marker_tree_remove (struct Lisp_Marker *m)
+{
+  struct buffer_text *t = m->buffer->text;
+  uintmax_t otick = t->marker_otick;
+
+  /* SPLICE is the marker to take out of its place in the tree: M
+     itself if it has at most one child, and otherwise its successor,
+     which then takes the place of M.  Validating M first means that
+     all the markers involved in rebalancing the tree have their
+     positions up to date.  */
+  marker_validate_1 (otick, m);
+  struct Lisp_Marker *splice
+    = !m->left || !m->right ? m : marker_subtree_min (otick, m->right);
+  struct Lisp_Marker *subtree = splice->left ? splice->left : splice->right;
+  struct Lisp_Marker *subtree_parent
+    = splice->parent != m ? splice->parent : splice;
+  bool removed_black = !splice->red;
+
+  marker_replace_child (t, subtree, splice);
+  if (splice != m)
+    {
+      marker_replace_child (t, splice, m);
+      splice->left = m->left;
+      if (splice->left)
+	splice->left->parent = splice;
+      splice->right = m->right;
+      if (splice->right)
+	splice->right->parent = splice;
+      splice->red = m->red;
+    }
+
+  if (removed_black)
+    marker_remove_fix (t, subtree, subtree_parent);
+
+  m->parent = m->left = m->right = NULL;
+  m->red = false;
+}
+
+/* Move marker M, which points somewhere, to CHARPOS and BYTEPOS in
+   its buffer.  */
+
+void
+marker_tree_move (struct Lisp_Marker *m, ptrdiff_t charpos,
+		  ptrdiff_t bytepos)
+{
+  marker_tree_validate (m);
+
+  /* M stays where it is in the tree if it doesn't move past another
+     marker, which is the common case.  */
+  if (charpos != m->charpos)
+    {
+      struct Lisp_Marker *next = marker_tree_next (m);
+      struct Lisp_Marker *prev = NULL;
+
+      if (m->left)
+	{
+	  prev = m->left;
+	  marker_inherit_offset (BUF_MARKER_OTICK (m->buffer), prev);
+	  while (prev->right)
+	    {
+	      prev = prev->right;
+	      marker_inherit_offset (BUF_MARKER_OTICK (m->buffer), prev);
+	    }
+	}
+      else
+	{
+	  struct Lisp_Marker *child = m;
+	  prev = m->parent;
+	  while (prev && child == prev->left)
+	    {
+	      child = prev;
+	      prev = prev->parent;
+	    }
+	}
+
+      if ((prev && charpos < prev->charpos)
+	  || (next && next->charpos < charpos))
+	{
+	  marker_tree_remove (m);
+	  m->charpos = charpos;
+	  m->bytepos = bytepos;
+	  marker_tree_insert (m);
+	  return;
+	}
+    }
+
+  m->charpos = charpos;
+  m->bytepos = bytepos;
+}
+
+/* Relocate the markers of buffer B after char position POS, or at or
+   after it if INCLUSIVE, by NCHARS chars and NBYTES bytes.  They must
+   not move past any other marker.  */
+
+void
+marker_tree_shift (struct buffer *b, ptrdiff_t pos, bool inclusive,
+		   ptrdiff_t nchars, ptrdiff_t nbytes)
+{
+  struct Lisp_Marker *m = BUF_MARKER_TREE (b);
+
+  while (m)
+    {
+      marker_inherit_offset (BUF_MARKER_OTICK (b), m);
+      if (inclusive ? m->charpos >= pos : m->charpos > pos)
+	{
+	  /* All the markers to the right of M are to be relocated too,
+	     which we leave for later.  */
+	  m->charpos += nchars;
+	  m->bytepos += nbytes;
+	  if (m->right)
+	    {
+	      m->right->char_offset += nchars;
+	      m->right->byte_offset += nbytes;
+	      BUF_MARKER_OTICK (b)++;
+	    }
+	  m = m->left;
+	}
+      else
+	m = m->right;
+    }
+}
+
+/* Move the markers of buffer B after char position FROM and before
+   END to FROM, whose byte position is FROM_BYTE.  */
+
+void
+marker_tree_collapse (struct buffer *b, ptrdiff_t from, ptrdiff_t from_byte,
+		      ptrdiff_t end)
+{
+  for (struct Lisp_Marker *m = marker_tree_first_after (b, from);
+       m && m->charpos < end; m = marker_tree_next (m))
+    {
+      m->charpos = from;
+      m->bytepos = from_byte;
+    }
+}
+
+/* Relocate the markers of buffer B for the insertion of NCHARS chars
+   and NBYTES bytes at char position FROM, whose byte position is
+   FROM_BYTE.  The markers at FROM advance only if BEFORE_MARKERS, or
+   if their insertion type is t.  */
+
+void
+marker_tree_insert_gap (struct buffer *b, ptrdiff_t from, ptrdiff_t from_byte,
+			ptrdiff_t nchars, ptrdiff_t nbytes,
+			bool before_markers)
+{
+  struct Lisp_Marker *m, *next, *advancing = NULL;
+
+  if (before_markers)
+    {
+      marker_tree_shift (b, from, true, nchars, nbytes);
+      return;
+    }
+
+  /* Take the markers at FROM that advance out of the tree, and put
+     them back once the ones after FROM have been relocated.  Their
+     LEFT links chain them together meanwhile.  */
+  for (m = marker_tree_first_after (b, from - 1);
+       m && m->charpos == from; m = next)
+    {
+      next = marker_tree_next (m);
+      if (m->insertion_type)
+	{
+	  marker_tree_remove (m);
+	  m->left = advancing;
+	  advancing = m;
+	}
+    }
+
+  marker_tree_shift (b, from, false, nchars, nbytes);
+
+  for (m = advancing; m; m = next)
+    {
+      next = m->left;
+      m->charpos = from + nchars;
+      m->bytepos = from_byte + nbytes;
+      marker_tree_insert (m);
+    }
+}
+
+
 /* Converting between character positions and byte positions.  */
 
 /* There are several places in the buffer where we know
    the correspondence: BEG, BEGV, PT, GPT, ZV and Z,
    and everywhere there is a marker.  So we find the one of these places
-   that is closest to the specified position, and scan from there.  */
+   that is closest to the specified position, and scan from there.
+   The closest markers are found by looking down the tree of markers.
+
+   In a buffer with a line index (see line-index.h), the boundaries of
+   its chunks are such places too, and there is one every few
+   kilobytes.  */
 
 /* This macro is a subroutine of buf_charpos_to_bytepos.
    Note that it is desirable that BYTEPOS is not evaluated
@@ -139,37 +734,20 @@ CHECK_MARKER (Lisp_Object x)
   CHECK_TYPE (MARKERP (x), Qmarkerp, x);
 }
 
-/* When converting bytes from/to chars, we look through the list of
-   markers to try and find a good starting point (since markers keep
-   track of both bytepos and charpos at the same time).
-   But if there are many markers, it can take too much time to find a "good"
-   marker from which to start.  Worse yet: if it takes a long time and we end
-   up finding a nearby markers, we won't add a new marker to cache this
-   result, so next time around we'll have to go through this same long list
-   to (re)find this best marker.  So the further down the list of
-   markers we go, the less demanding we are w.r.t what is a good marker.
-
-   The previous code used INITIAL=50 and INCREMENT=0 and this lead to
-   really poor performance when there are many markers.
-   I haven't tried to tweak INITIAL, but experiments on my trusty Thinkpad
-   T61 using various artificial test cases seem to suggest that INCREMENT=50
-   might be "the best compromise": it significantly improved the
-   worst case and it was rarely slower and never by much.
-
-   The asymptotic behavior is still poor, tho, so in largish buffers with many
-   overlays (e.g. 300KB and 30K overlays), it can still be a bottleneck.  */
-#define BYTECHAR_DISTANCE_INITIAL 50
-#define BYTECHAR_DISTANCE_INCREMENT 50
+/* If the closest known places are less than this many chars apart,
+   scan the intervening chars directly rather than looking for closer
+   places in the line index.  */
+#define BYTECHAR_DISTANCE 50
 
 /* Return the byte position corresponding to CHARPOS in B.  */
 
 ptrdiff_t
 buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
 {
-  struct Lisp_Marker *tail;
+  struct Lisp_Marker *m;
+  struct line_index *li = NULL;
   ptrdiff_t best_above, best_above_byte;
   ptrdiff_t best_below, best_below_byte;
-  ptrdiff_t distance = BYTECHAR_DISTANCE_INITIAL;
 
   eassert (BUF_BEG (b) <= charpos && charpos <= BUF_Z (b));
 
@@ -202,15 +780,26 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
   if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
     CONSIDER (cached_charpos, cached_bytepos);
 
-  for (tail = BUF_MARKERS (b);
-       /* If we are down to a range of DISTANCE chars,
-          don't bother checking any other markers;
-          scan the intervening chars directly now.  */
-       tail && !(best_above - charpos < distance
-		 || charpos - best_below < distance);
-       tail = tail->next,
-       distance += BYTECHAR_DISTANCE_INCREMENT)
-    CONSIDER (tail->charpos, tail->bytepos);
+  if (BYTECHAR_DISTANCE <= best_above - best_below
+      && (li = settled_line_index (b)))
+    {
+      ptrdiff_t below, below_byte, above, above_byte;
+
+      line_index_chunk_bounds (b, li, charpos, false,
+			       &below, &below_byte, &above, &above_byte);
+      CONSIDER (below, below_byte);
+      CONSIDER (above, above_byte);
+    }
+
+  /* Fset_buffer_multibyte empties the chain of markers while their
+     positions are being recomputed.  */
+  if (BUF_MARKERS (b))
+    for (m = BUF_MARKER_TREE (b); m;
+	 m = charpos < m->charpos ? m->left : m->right)
+      {
+	marker_inherit_offset (BUF_MARKER_OTICK (b), m);
+	CONSIDER (m->charpos, m->bytepos);
+      }
 
   /* We get here if we did not exactly hit one of the known places.
      We have one known above and one known below.
@@ -230,7 +819,7 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
       /* If this position is quite far from the nearest known position,
 	 cache the correspondence by creating a marker here.
 	 It will last until the next GC.  */
-      if (record)
+      if (record && !li)
 	build_marker (b, best_below, best_below_byte);
 
       byte_char_debug_check (b, best_below, best_below_byte);
@@ -255,7 +844,7 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
       /* If this position is quite far from the nearest known position,
 	 cache the correspondence by creating a marker here.
 	 It will last until the next GC.  */
-      if (record)
+      if (record && !li)
 	build_marker (b, best_above, best_above_byte);
 
       byte_char_debug_check (b, best_above, best_above_byte);
@@ -319,10 +908,10 @@ #define CONSIDER(BYTEPOS, CHARPOS)					\
 ptrdiff_t
 buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 {
-  struct Lisp_Marker *tail;
+  struct Lisp_Marker *m;
+  struct line_index *li = NULL;
   ptrdiff_t best_above, best_above_byte;
   ptrdiff_t best_below, best_below_byte;
-  ptrdiff_t distance = BYTECHAR_DISTANCE_INITIAL;
 
   eassert (BUF_BEG_BYTE (b) <= bytepos && bytepos <= BUF_Z_BYTE (b));
 
@@ -350,15 +939,24 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
   if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
     CONSIDER (cached_bytepos, cached_charpos);
 
-  for (tail = BUF_MARKERS (b);
-       /* If we are down to a range of DISTANCE bytes,
-          don't bother checking any other markers;
-          scan the intervening chars directly now.  */
-       tail && !(best_above_byte - bytepos < distance
-		 || bytepos - best_below_byte < distance);
-       tail = tail->next,
-       distance += BYTECHAR_DISTANCE_INCREMENT)
-    CONSIDER (tail->bytepos, tail->charpos);
+  if (BYTECHAR_DISTANCE <= best_above_byte - best_below_byte
+      && (li = settled_line_index (b)))
+    {
+      ptrdiff_t below, below_byte, above, above_byte;
+
+      line_index_chunk_bounds (b, li, bytepos, true,
+			       &below, &below_byte, &above, &above_byte);
+      CONSIDER (below_byte, below);
+      CONSIDER (above_byte, above);
+    }
+
+  if (BUF_MARKERS (b))
+    for (m = BUF_MARKER_TREE (b); m;
+	 m = bytepos < m->bytepos ? m->left : m->right)
+      {
+	marker_inherit_offset (BUF_MARKER_OTICK (b), m);
+	CONSIDER (m->bytepos, m->charpos);
+      }
 
   /* We get here if we did not exactly hit one of the known places.
      We have one known above and one known below.
@@ -379,7 +977,7 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 	 It will last until the next GC.
 	 But don't do it if BUF_MARKERS is nil;
 	 that is a signal from Fset_buffer_multibyte.  */
-      if (record && BUF_MARKERS (b))
+      if (record && BUF_MARKERS (b) && !li)
 	build_marker (b, best_below, best_below_byte);
 
       byte_char_debug_check (b, best_below, best_below_byte);
@@ -406,7 +1004,7 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 	 It will last until the next GC.
 	 But don't do it if BUF_MARKERS is nil;
 	 that is a signal from Fset_buffer_multibyte.  */
-      if (record && BUF_MARKERS (b))
+      if (record && BUF_MARKERS (b) && !li)
 	build_marker (b, best_above, best_above_byte);
 
       byte_char_debug_check (b, best_above, best_above_byte);
@@ -450,7 +1048,7 @@ DEFUN ("marker-position", Fmarker_position, Smarker_position, 1, 1, 0,
 {
   CHECK_MARKER (marker);
   if (XMARKER (marker)->buffer)
-    return make_fixnum (XMARKER (marker)->charpos);
+    return make_fixnum (marker_charpos (XMARKER (marker)));
 
   return Qnil;
 }
@@ -464,7 +1062,7 @@ DEFUN ("marker-last-position", Fmarker_last_position, Smarker_last_position, 1,
 {
   CHECK_MARKER (marker);
 
-  return make_fixnum (XMARKER (marker)->charpos);
+  return make_fixnum (marker_charpos (XMARKER (marker)));
 }
 
 /* Change M so it points to B at CHARPOS and BYTEPOS.  */
@@ -480,16 +1078,18 @@ attach_marker (struct Lisp_Marker *m, struct buffer *b,
   else
     eassert (charpos <= bytepos);
 
-  m->charpos = charpos;
-  m->bytepos = bytepos;
-
   if (m->buffer != b)
     {
       unchain_marker (m);
       m->buffer = b;
       m->next = BUF_MARKERS (b);
       BUF_MARKERS (b) = m;
+      m->charpos = charpos;
+      m->bytepos = bytepos;
+      marker_tree_insert (m);
     }
+  else
+    marker_tree_move (m, charpos, bytepos);
 }
 
 /* If BUFFER is nil, return current buffer pointer.  Next, check
@@ -527,10 +1127,8 @@ set_marker_internal (Lisp_Object marker, Lisp_Object position,
      an existing marker, and MARKER is already in the same buffer.  */
   else if (MARKERP (position) && b == XMARKER (position)->buffer
 	   && b == m->buffer)
-    {
-      m->bytepos = XMARKER (position)->bytepos;
-      m->charpos = XMARKER (position)->charpos;
-    }
+    marker_tree_move (m, marker_charpos (XMARKER (position)),
+		      marker_bytepos (XMARKER (position)));
 
   else
     {
@@ -554,8 +1152,8 @@ set_marker_internal (Lisp_Object marker, Lisp_Object position,
 	}
       else if (MARKERP (position))
 	{
-	  charpos = XMARKER (position)->charpos;
-	  bytepos = XMARKER (position)->bytepos;
+	  charpos = marker_charpos (XMARKER (position));
+	  bytepos = marker_bytepos (XMARKER (position));
 	}
       else
 	wrong_type_argument (Qinteger_or_marker_p, position);
@@ -692,6 +1290,7 @@ unchain_marker (register struct Lisp_Marker *marker)
       /* No dead buffers here.  */
       eassert (BUFFER_LIVE_P (b));
 
+      marker_tree_remove (marker);
       marker->buffer = NULL;
       prev = &BUF_MARKERS (b);
 
@@ -729,9 +1328,10 @@ marker_position (Lisp_Object marker)
   if (!buf)
     error ("Marker does not point anywhere");
 
-  eassert (BUF_BEG (buf) <= m->charpos && m->charpos <= BUF_Z (buf));
+  ptrdiff_t charpos = marker_charpos (m);
+  eassert (BUF_BEG (buf) <= charpos && charpos <= BUF_Z (buf));
 
-  return m->charpos;
+  return charpos;
 }
 
 /* Return the byte position of marker MARKER, as a C integer.  */
@@ -745,9 +1345,10 @@ marker_byte_position (Lisp_Object marker)
   if (!buf)
     error ("Marker does not point anywhere");
 
-  eassert (BUF_BEG_BYTE (buf) <= m->bytepos && m->bytepos <= BUF_Z_BYTE (buf));
+  ptrdiff_t bytepos = marker_bytepos (m);
+  eassert (BUF_BEG_BYTE (buf) <= bytepos && bytepos <= BUF_Z_BYTE (buf));
 
-  return m->bytepos;
+  return bytepos;
 }
 
 DEFUN ("copy-marker", Fcopy_marker, Scopy_marker, 0, 2, 0,
@@ -2105,7 +2105,7 @@ dump_string (struct dump_context *ctx, const struct Lisp_String *string)
 static dump_off
 dump_marker (struct dump_context *ctx, const struct Lisp_Marker *marker)
 {
-#if CHECK_STRUCTS && !defined (HASH_Lisp_Marker_642DBAF866)
+#if CHECK_STRUCTS && !defined (HASH_Lisp_Marker_90864409FD)
 # error "Lisp_Marker changed. See CHECK_STRUCTS comment in config.h."
 #endif
 
@@ -2119,6 +2119,16 @@ dump_marker (struct dump_context *ctx, const struct Lisp_Marker *marker)
 			    Lisp_Vectorlike, WEIGHT_NORMAL);
       dump_field_lv_rawptr (ctx, out, marker, &marker->next,
 			    Lisp_Vectorlike, WEIGHT_STRONG);
+      dump_field_lv_rawptr (ctx, out, marker, &marker->parent,
+			    Lisp_Vectorlike, WEIGHT_NORMAL);
+      dump_field_lv_rawptr (ctx, out, marker, &marker->left,
+			    Lisp_Vectorlike, WEIGHT_NORMAL);
+      dump_field_lv_rawptr (ctx, out, marker, &marker->right,
+			    Lisp_Vectorlike, WEIGHT_NORMAL);
+      DUMP_FIELD_COPY (out, marker, red);
+      DUMP_FIELD_COPY (out, marker, char_offset);
+      DUMP_FIELD_COPY (out, marker, byte_offset);
+      DUMP_FIELD_COPY (out, marker, otick);
       DUMP_FIELD_COPY (out, marker, charpos);
       DUMP_FIELD_COPY (out, marker, bytepos);
     }
@@ -2128,7 +2138,7 @@ dump_marker (struct dump_context *ctx, const struct Lisp_Marker *marker)
 static dump_off
 dump_interval_node (struct dump_context *ctx, struct itree_node *node)
 {
-#if CHECK_STRUCTS && !defined (HASH_itree_node_50DE304F13)
+#if CHECK_STRUCTS && !defined (HASH_itree_node_7687861A59)
 # error "itree_node changed. See CHECK_STRUCTS comment in config.h."
 #endif
   struct itree_node out;
@@ -2143,6 +2153,7 @@ dump_interval_node (struct dump_context *ctx, struct itree_node *node)
   DUMP_FIELD_COPY (&out, node, end);
   DUMP_FIELD_COPY (&out, node, limit);
   DUMP_FIELD_COPY (&out, node, offset);
+  DUMP_FIELD_COPY (&out, node, clamp);
   DUMP_FIELD_COPY (&out, node, otick);
   dump_field_lv (ctx, &out, node, &node->data, WEIGHT_STRONG);
   DUMP_FIELD_COPY (&out, node, red);
@@ -2465,7 +2476,7 @@ dump_symbol (struct dump_context *ctx,
              Lisp_Object object,
              dump_off offset)
 {
-#if CHECK_STRUCTS && !defined HASH_Lisp_Symbol_61B174C9F4
+#if CHECK_STRUCTS && !defined HASH_Lisp_Symbol_E707CF199E
 # error "Lisp_Symbol changed. See CHECK_STRUCTS comment in config.h."
 #endif
 #if CHECK_STRUCTS && !defined (HASH_symbol_redirect_EA72E4BFF5)
@@ -2811,7 +2822,7 @@ dump_obarray (struct dump_context *ctx, Lisp_Object object)
 static dump_off
 dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
 {
-#if CHECK_STRUCTS && !defined HASH_buffer_B02F648B82
+#if CHECK_STRUCTS && !defined HASH_buffer_749E1CFC41
 # error "buffer changed. See CHECK_STRUCTS comment in config.h."
 #endif
   struct buffer munged_buffer = *in_buffer;
@@ -2879,6 +2890,9 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
         dump_field_fixup_later (ctx, out, buffer, &buffer->own_text.intervals);
       dump_field_lv_rawptr (ctx, out, buffer, &buffer->own_text.markers,
                             Lisp_Vectorlike, WEIGHT_NORMAL);
+      dump_field_lv_rawptr (ctx, out, buffer, &buffer->own_text.marker_tree,
+                            Lisp_Vectorlike, WEIGHT_NORMAL);
+      DUMP_FIELD_COPY (out, buffer, own_text.marker_otick);
       DUMP_FIELD_COPY (out, buffer, own_text.inhibit_shrinking);
       DUMP_FIELD_COPY (out, buffer, own_text.redisplay);
     }
@@ -2920,6 +2934,8 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
   out->newline_cache = NULL;
   out->width_run_cache = NULL;
   out->bidi_paragraph_cache = NULL;
+  out->line_index = NULL;
+  out->syntax_ppss_cache = NULL;
 
   DUMP_FIELD_COPY (out, buffer, prevent_redisplay_optimizations_p);
   DUMP_FIELD_COPY (out, buffer, clip_changed);
@@ -3065,7 +3081,7 @@ dump_vectorlike (struct dump_context *ctx,
                  Lisp_Object lv,
                  dump_off offset)
 {
-#if CHECK_STRUCTS && !defined HASH_pvec_type_99104541E2
+#if CHECK_STRUCTS && !defined HASH_pvec_type_427193CE8C
 # error "pvec_type changed. See CHECK_STRUCTS comment in config.h."
 #endif
   const struct Lisp_Vector *v = XVECTOR (lv);
@@ -3135,6 +3151,8 @@ dump_vectorlike (struct dump_context *ctx,
     case PVEC_USER_PTR:
     case PVEC_MUTEX:
     case PVEC_CONDVAR:
+    case PVEC_CHANNEL:
+    case PVEC_ASYNC_FUTURE:
     case PVEC_SQLITE:
     case PVEC_MODULE_FUNCTION:
     case PVEC_SYMBOL_WITH_POS:
@@ -5310,6 +5328,38 @@ pdumper_clear_marks_impl (void)
   dump_bitset_clear (&dump_private.mark_bits);
 }
 
+/* Call FN on every object in the dump that the last GC found live,
+   except floats, which point to nothing.  */
+void
+pdumper_visit_live_objects_impl (void (*fn) (Lisp_Object))
+{
+  if (!dump_loaded_p ())
+    return;
+  const struct dump_table_locator *table = &dump_private.header.object_starts;
+  const struct dump_reloc *relocs = dump_ptr (dump_public.start,
+					      table->offset);
+  for (dump_off i = 0; i < table->nr_entries; i++)
+    {
+      dump_off offset = dump_reloc_get_offset (relocs[i]);
+      if (offset >= dump_private.header.discardable_start
+	  || !dump_bitset_bit_set_p (&dump_private.last_mark_bits,
+				     offset / DUMP_ALIGNMENT))
+	continue;
+      void *obj = dump_ptr (dump_public.start, offset);
+      switch ((enum Lisp_Type) relocs[i].type)
+	{
+	case Lisp_Symbol:
+	  fn (make_lisp_symbol (obj));
+	  break;
+	case Lisp_Float:
+	  break;
+	default:
+	  fn (make_lisp_ptr (obj, (enum Lisp_Type) relocs[i].type));
+	  break;
+	}
+    }
+}
+
 static ssize_t
 dump_read_all (int fd, void *buf, size_t bytes_to_read)
 {
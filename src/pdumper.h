@@ -270,6 +270,20 @@ pdumper_clear_marks (void)
 #endif
 }
 
+extern void pdumper_visit_live_objects_impl (void (*) (Lisp_Object));
+
+/* Call FN on each object in the dump, other than floats, that was live
+   after the last GC.  */
+INLINE void
+pdumper_visit_live_objects (void (*fn) (Lisp_Object))
+{
+#ifdef HAVE_PDUMPER
+  pdumper_visit_live_objects_impl (fn);
+#else
+  (void) fn;
+#endif
+}
+
 /* Record the Emacs startup directory, relative to which the pdump
    file was loaded.  */
 extern void pdumper_record_wd (const char *);
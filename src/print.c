@@ -1966,6 +1966,28 @@ print_vectorlike_unreadable (Lisp_Object obj, Lisp_Object printcharfun,
       printchar ('>', printcharfun);
       return;
 
+    case PVEC_CHANNEL:
+      print_c_string ("#<channel ", printcharfun);
+      if (STRINGP (XCHANNEL (obj)->name))
+	print_string (XCHANNEL (obj)->name, printcharfun);
+      else
+	{
+	  void *p = XCHANNEL (obj);
+	  int len = sprintf (buf, "%p", p);
+	  strout (buf, len, len, printcharfun);
+	}
+      printchar ('>', printcharfun);
+      return;
+
+    case PVEC_ASYNC_FUTURE:
+      {
+	int len = sprintf (buf, "#<async-future %"pI"d%s>",
+			   XASYNC_FUTURE (obj)->id,
+			   XASYNC_FUTURE (obj)->done ? " done" : "");
+	strout (buf, len, len, printcharfun);
+      }
+      return;
+
     case PVEC_MODULE_FUNCTION:
 #ifdef HAVE_MODULES
       {
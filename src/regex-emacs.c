@@ -187,12 +187,13 @@ #define BYTEWIDTH 8 /* In bits.  */
 typedef const unsigned char re_char;
 
 static void re_compile_fastmap (struct re_pattern_buffer *);
+static void re_compute_must (struct re_pattern_buffer *);
 static ptrdiff_t re_match_2_internal (struct re_pattern_buffer *bufp,
 				     re_char *string1, ptrdiff_t size1,
 				     re_char *string2, ptrdiff_t size2,
 				     ptrdiff_t pos,
 				     struct re_registers *regs,
-				     ptrdiff_t stop);
+				     ptrdiff_t stop, ptrdiff_t fail_limit);
 
 /* These are the command codes that appear in compiled regular
    expressions.  Some opcodes are followed by argument bytes.  A
@@ -1791,6 +1792,9 @@ regex_compile (re_char *pattern, ptrdiff_t size,
   /* Initialize the pattern buffer.  */
   bufp->fastmap_accurate = false;
   bufp->used_syntax = false;
+  re_free_dfa (bufp);
+  bufp->dfa_impossible = false;
+  bufp->must_len = 0;
 
   /* Set 'used' to zero, so that if we return an error, the pattern
      printer (for debugging) will think there's no pattern.  We reset it
@@ -2687,6 +2691,7 @@ regex_compile (re_char *pattern, ptrdiff_t size,
 
   /* Success; set the length of the buffer.  */
   bufp->used = b - bufp->buffer;
+  re_compute_must (bufp);
 
 #ifdef REGEX_EMACS_DEBUG
   if (regex_emacs_debug > 0)
@@ -3333,7 +3338,273 @@ re_compile_fastmap (struct re_pattern_buffer *bufp)
   bufp->can_be_null = analyze_first (bufp, bufp->buffer,
 			             bufp->buffer + bufp->used, fastmap);
 } /* re_compile_fastmap */
+
+/* Return the end of the instruction at P of a compiled pattern.  */
+
+static re_char *
+skip_insn (re_char *p)
+{
+  re_char *end = skip_one_char (p);
+  if (end)
+    return end;
+
+  switch (*p)
+    {
+    case start_memory: case stop_memory: case duplicate:
+      return p + 2;
+
+    case jump: case on_failure_jump: case on_failure_keep_string_jump:
+    case on_failure_jump_loop: case on_failure_jump_nastyloop:
+    case on_failure_jump_smart:
+      return p + 3;
+
+    case succeed_n: case jump_n: case set_number_at:
+      return p + 5;
+
+    default:
+      return p + 1;
+    }
+}
+
+/* Set the 'must', 'must_len' and 'must_prefix' fields of BUFP, whose
+   pattern was just compiled.
+
+   Follow the instructions that every match executes, from the start
+   of the pattern: skip the assertions, which match no text, and skip
+   the optional parts of the pattern and all but the last alternative
+   of an alternation, by following their jumps to the instruction
+   after them.  The longest 'exactn' met on the way is a string that
+   every match contains.  Stop at the instructions whose shape is not
+   known well enough to skip them, such as counted repetitions.  */
+
+static void
+re_compute_must (struct re_pattern_buffer *bufp)
+{
+  re_char *p = bufp->buffer, *pend = p + bufp->used;
+  /* Whether no instruction that may match some text was met yet.  */
+  bool prefix = true;
+
+  bufp->must_len = 0;
+  bufp->must_prefix = false;
+
+  while (p < pend)
+    switch (*p)
+      {
+      case exactn:
+	if (p[1] > bufp->must_len)
+	  {
+	    bufp->must = p + 2 - bufp->buffer;
+	    bufp->must_len = p[1];
+	    bufp->must_prefix = prefix;
+	  }
+	FALLTHROUGH;
+      case anychar: case charset: case charset_not:
+      case syntaxspec: case notsyntaxspec:
+      case categoryspec: case notcategoryspec:
+	prefix = false;
+	p = skip_one_char (p);
+	break;
+
+      case no_op: case start_memory: case stop_memory:
+      case begline: case endline: case begbuf: case endbuf:
+      case wordbeg: case wordend: case wordbound: case notwordbound:
+      case symbeg: case symend: case at_dot:
+	p = skip_insn (p);
+	break;
+
+      case jump:
+	{
+	  /* Every match goes on at the target, even if it may come
+	     back to the code jumped over later, as in the loop 'jump
+	     L; loop: <BODY>; L: on_failure_jump loop' of '*?'.  */
+	  re_char *target = extract_address (p + 1);
+	  if (target <= p)
+	    return;
+	  prefix = false;
+	  p = target;
+	}
+	break;
+
+      case on_failure_jump: case on_failure_jump_loop:
+      case on_failure_jump_nastyloop: case on_failure_jump_smart:
+	{
+	  re_char *target = extract_address (p + 1), *q, *last = NULL;
+
+	  prefix = false;
+	  if (target <= p)
+	    {
+	      /* The end of a non-greedy loop, which every match leaves
+		 by the next instruction.  */
+	      p += 3;
+	      break;
+	    }
+
+	  /* Either an optional part, as in 'on_failure_jump L; <BODY>;
+	     L:', or an alternation, as in 'on_failure_jump L; <A>; jump
+	     M; L: <B>; M:', whose alternative B is also skipped.  */
+	  for (q = p + 3; q < target; q = skip_insn (q))
+	    last = q;
+	  if (q != target)
+	    return;
+	  if (last && *last == jump && extract_address (last + 1) >= target)
+	    p = extract_address (last + 1);
+	  else
+	    p = target;
+	}
+	break;
+
+      default:
+	return;
+      }
+}
 
+/* The state of 're_prefix_literals' while it follows the paths of a
+   pattern.  */
+struct prefix_walk
+{
+  re_char *pend;
+  struct re_literals *lits;
+  /* The number of instructions that may still be looked at.  */
+  int budget;
+  /* False once a path was found that no string can start.  */
+  bool ok;
+};
+
+/* Add the LEN bytes at STR to the strings of W, unless they are there
+   already.  */
+
+static void
+prefix_walk_add (struct prefix_walk *w, re_char *str, int len)
+{
+  struct re_literals *lits = w->lits;
+
+  if (len == 0)
+    {
+      /* This path may match text that starts with anything.  */
+      w->ok = false;
+      return;
+    }
+  for (int i = 0; i < lits->n; i++)
+    if (lits->len[i] == len && memcmp (lits->str[i], str, len) == 0)
+      return;
+  if (lits->n == RE_LITERALS_MAX)
+    {
+      w->ok = false;
+      return;
+    }
+  lits->len[lits->n] = len;
+  memcpy (lits->str[lits->n++], str, len);
+}
+
+/* Follow the paths of the pattern of W from P, by which a match may
+   go on after the LEN bytes at STR, and add to W the string that
+   starts the text each of them matches.  */
+
+static void
+prefix_walk (struct prefix_walk *w, re_char *p, unsigned char *str, int len)
+{
+  while (w->ok)
+    {
+      if (--w->budget < 0)
+	{
+	  w->ok = false;
+	  return;
+	}
+      if (p >= w->pend)
+	break;
+      switch (*p)
+	{
+	case exactn:
+	  for (int i = 0; i < p[1]; i++)
+	    {
+	      if (len == RE_LITERAL_MAX)
+		{
+		  prefix_walk_add (w, str, len);
+		  return;
+		}
+	      str[len++] = p[2 + i];
+	    }
+	  p += 2 + p[1];
+	  break;
+
+	case charset:
+	  {
+	    /* A set of a few ASCII characters, as in 'ba[rz]', gives a
+	       string for each of them.  */
+	    int size = CHARSET_BITMAP_SIZE (p), n = 0;
+	    if (CHARSET_RANGE_TABLE_EXISTS_P (p) || len == RE_LITERAL_MAX)
+	      goto stop;
+	    for (int c = 0; c < size * BYTEWIDTH; c++)
+	      if (p[2 + c / BYTEWIDTH] & (1 << (c % BYTEWIDTH)))
+		{
+		  if (c >= 0x80 || ++n > 4)
+		    goto stop;
+		}
+	    re_char *next = skip_one_char (p);
+	    for (int c = 0; c < size * BYTEWIDTH; c++)
+	      if (p[2 + c / BYTEWIDTH] & (1 << (c % BYTEWIDTH)))
+		{
+		  str[len] = c;
+		  prefix_walk (w, next, str, len + 1);
+		}
+	    return;
+	  }
+
+	case no_op: case start_memory: case stop_memory:
+	case begline: case endline: case begbuf: case endbuf:
+	case wordbeg: case wordend: case wordbound: case notwordbound:
+	case symbeg: case symend: case at_dot:
+	  /* These match no text.  */
+	  p = skip_insn (p);
+	  break;
+
+	case jump:
+	  {
+	    re_char *target = extract_address (p + 1);
+	    /* The text matched so far may be followed by another round
+	       of a loop; it still starts the match.  */
+	    if (target <= p)
+	      goto stop;
+	    p = target;
+	  }
+	  break;
+
+	case on_failure_jump: case on_failure_keep_string_jump:
+	case on_failure_jump_loop: case on_failure_jump_nastyloop:
+	case on_failure_jump_smart:
+	  {
+	    re_char *target = extract_address (p + 1);
+	    if (target <= p)
+	      goto stop;
+	    /* A match goes on either after this instruction or at its
+	       target, so follow both.  */
+	    unsigned char copy[RE_LITERAL_MAX];
+	    memcpy (copy, str, len);
+	    prefix_walk (w, p + 3, copy, len);
+	    p = target;
+	  }
+	  break;
+
+	default:
+	  goto stop;
+	}
+    }
+ stop:
+  prefix_walk_add (w, str, len);
+}
+
+bool
+re_prefix_literals (struct re_pattern_buffer *bufp,
+		    struct re_literals *literals)
+{
+  struct prefix_walk w = { bufp->buffer + bufp->used, literals, 4096, true };
+  unsigned char str[RE_LITERAL_MAX];
+
+  literals->n = 0;
+  prefix_walk (&w, bufp->buffer, str, 0);
+  return w.ok;
+}
+
 /* Set REGS to hold NUM_REGS registers, storing them in STARTS and
    ENDS.  Subsequent matches using PATTERN_BUFFER and REGS will use
    this memory for recording register information.  STARTS and ENDS
@@ -3366,6 +3637,769 @@ re_set_registers (struct re_pattern_buffer *bufp, struct re_registers *regs,
     }
 }
 
+/* Running patterns on a lazy DFA.
+
+   re_match_2_internal is a backtracking matcher: when a pattern can
+   match the text in many ways, it tries them one after the other, and
+   can take a time exponential in the length of the text to find that
+   none of them does.  Most patterns, however, only match characters,
+   test whether they are at the beginning or the end of a line or of
+   the text, and branch.  Such a pattern matches the text at a given
+   position if and only if the nondeterministic automaton (NFA) made of
+   its compiled code accepts it there, and that can be decided in time
+   linear in the length of the text by a deterministic automaton (DFA)
+   whose states are sets of states of the NFA.  The states of the DFA
+   and their transitions are only made as the text reaches them, and
+   kept with the compiled pattern for later searches.
+
+   The DFA only tells whether there is a match, and running it costs
+   about as much as matching the text without much backtracking, so
+   it only comes into play once re_match_2_internal failed more than
+   internal--regexp-dfa-fail-limit times at one position.  From then
+   on, re_search_2 and re_match_2 use the DFA of the pattern to give up
+   at once when there is no match, and to skip the positions where none
+   starts, but they still call re_match_2_internal where one does, so
+   that the match and its subexpressions are found as before.  */
+
+/* The operations of the nodes of the NFA.  */
+enum re_nfa_op
+{
+  /* Match a character, and go to the next node.  */
+  NFA_CHAR, NFA_ANYCHAR, NFA_CHARSET,
+  /* Accept.  */
+  NFA_MATCH,
+  /* Go to the next node, and for NFA_SPLIT to the alternative node
+     too, without matching anything.  */
+  NFA_EPSILON, NFA_SPLIT,
+  /* Go to the next node if the assertion holds.  */
+  NFA_BEGLINE, NFA_ENDLINE, NFA_BEGBUF, NFA_ENDBUF
+};
+
+struct re_nfa_node
+{
+  enum re_nfa_op op;
+  /* The next node, and the alternative one of NFA_SPLIT.  */
+  int next, alt;
+  /* For NFA_CHAR, the character to match, as re_match_2_internal
+     compares it with the text.  For NFA_CHARSET, the offset of the
+     charset in the compiled pattern.  */
+  int arg;
+};
+
+/* What assertions know about a position in the text.  */
+enum
+{
+  DFA_BEGLINE = 1, DFA_BEGBUF = 2, DFA_ENDLINE = 4, DFA_ENDBUF = 8
+};
+
+struct re_dfa_state
+{
+  /* The nodes of the NFA the state stands for, as an index into the
+     kernels of its cache, and their number.  */
+  ptrdiff_t kernel;
+  int nkernel;
+  /* DFA_BEGLINE and DFA_BEGBUF, if they hold at the position of the
+     state and the NFA tests them.  */
+  int flags;
+  /* The next state in the same bucket of the hash table.  */
+  int hash_next;
+  /* The transitions on each character less than 256: twice the index
+     of the next state, plus 1 if the NFA accepts just before that
+     character, or -1 if not known yet.  */
+  int trans[256];
+};
+
+/* The states of a DFA.  There are two DFAs per pattern, one to find
+   matches starting at a given position, and one to find matches
+   starting anywhere after it.  */
+struct re_dfa_cache
+{
+  bool anchored;
+  struct re_dfa_state *states;
+  int nstates;
+  ptrdiff_t states_alloc;
+  int *kernels;
+  ptrdiff_t nkernels, kernels_alloc;
+  /* The hash table of the states, and the number of times the cache
+     was emptied for lack of room during the current run.  */
+  int *table;
+  int flushes;
+};
+
+/* A cache holds at most this many states.  When it is full, it is
+   emptied, and a run gives up on the DFA if that happens more than
+   DFA_MAX_FLUSHES times.  */
+enum { DFA_MAX_STATES = 128, DFA_TABLE_SIZE = 2 * DFA_MAX_STATES };
+enum { DFA_MAX_FLUSHES = 8 };
+
+/* Patterns whose compiled code is larger than this many bytes are not
+   run on a DFA.  */
+enum { DFA_MAX_PATTERN = 4096 };
+
+/* What re_match_2_internal returns when it fails more often than it
+   was allowed to.  */
+enum { DFA_GAVE_UP = -3 };
+
+struct re_dfa
+{
+  /* The nodes of the NFA, starting with node 0.  */
+  struct re_nfa_node *nodes;
+  int nnodes;
+  /* The value of target_multibyte the NFA was made for.  */
+  bool target_multibyte;
+  /* The DFA_BEGLINE and DFA_BEGBUF flags the NFA tests.  */
+  int assertions;
+  /* True if some charsets of the NFA depend on the syntax and case
+     tables of the current buffer, and the tables the states of the
+     caches were made with.  */
+  bool uses_tables;
+  Lisp_Object syntax_table, downcase_table, upcase_table;
+  struct re_dfa_cache anchored, unanchored;
+  /* Scratch space for making states.  */
+  int *stack, *closure, *set;
+  unsigned int *mark;
+  unsigned int generation;
+};
+
+static bool execute_charset (re_char **, int, int, bool, Lisp_Object);
+
+/* Return the end of the instruction at Q, of a compiled pattern
+   whose characters are multibyte if MULTIBYTE, or NULL if a DFA
+   cannot run it.  Set *NCHARS to the number of characters it
+   matches, or 0 if it is not an exactn.  */
+
+static re_char *
+re_dfa_insn_end (re_char *q, bool multibyte, int *nchars)
+{
+  *nchars = 0;
+  switch (*q)
+    {
+    case exactn:
+      {
+	re_char *r = q + 2, *end = r + q[1];
+	for (; r < end; r += multibyte ? BYTES_BY_CHAR_HEAD (*r) : 1)
+	  ++*nchars;
+	return end;
+      }
+
+    case charset: case charset_not:
+      return skip_one_char (q);
+
+    case anychar: case no_op: case succeed:
+    case begline: case endline: case begbuf: case endbuf:
+      return q + 1;
+
+    case start_memory: case stop_memory:
+      return q + 2;
+
+    case jump: case on_failure_jump: case on_failure_keep_string_jump:
+    case on_failure_jump_loop: case on_failure_jump_nastyloop:
+    case on_failure_jump_smart:
+      return q + 3;
+
+    default:
+      /* Backreferences need backtracking, counted repetitions modify
+	 the compiled code as they run, and the other assertions depend
+	 on the syntax of the text around them.  */
+      return NULL;
+    }
+}
+
+/* Return the NFA node that the jump at Q in the compiled code of BUFP
+   goes to, using NODE_AT to find the node of each instruction, or -1
+   if there is none.  */
+
+static int
+re_dfa_jump_target (struct re_pattern_buffer *bufp, re_char *q,
+		    int const *node_at)
+{
+  ptrdiff_t target = q + 3 + extract_number (q + 1) - bufp->buffer;
+  if (! (0 <= target && target <= bufp->used))
+    return -1;
+  /* After on_failure_jump_smart turned itself into an
+     on_failure_keep_string_jump, the loop jumps back to just after
+     it, and relies on backtracking to leave the loop.  */
+  if (target >= 3 && node_at[target - 3] >= 0
+      && bufp->buffer[target - 3] == on_failure_keep_string_jump)
+    target -= 3;
+  return node_at[target];
+}
+
+/* Return a new DFA for the compiled pattern of BUFP, or NULL if it
+   cannot run on one, or would not gain from it.  */
+
+static struct re_dfa *
+re_dfa_make (struct re_pattern_buffer *bufp)
+{
+  re_char *p = bufp->buffer, *pend = p + bufp->used, *q, *end;
+  bool multibyte = RE_MULTIBYTE_P (bufp);
+  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  bool branches = false, uses_tables = false;
+  int nnodes = 0, nchars, assertions = 0;
+
+  if (bufp->used > DFA_MAX_PATTERN)
+    return NULL;
+
+  /* Check the instructions, and number their nodes: one per
+     character for exactn, and one for each other instruction.  */
+  int *node_at = xnmalloc (bufp->used + 1, sizeof *node_at);
+  for (ptrdiff_t i = 0; i <= bufp->used; i++)
+    node_at[i] = -1;
+  for (q = p; q < pend; q = end)
+    {
+      end = re_dfa_insn_end (q, multibyte, &nchars);
+      if (!end)
+	{
+	  xfree (node_at);
+	  return NULL;
+	}
+      node_at[q - p] = nnodes;
+      nnodes += max (nchars, 1);
+      switch (*q)
+	{
+	case charset: case charset_not:
+	  if (CHARSET_RANGE_TABLE_EXISTS_P (q)
+	      && (CHARSET_RANGE_TABLE_BITS (q)
+		  & (BIT_WORD | BIT_SPACE | BIT_PUNCT | BIT_UPPER | BIT_LOWER)))
+	    uses_tables = true;
+	  break;
+	case begline:
+	  assertions |= DFA_BEGLINE;
+	  break;
+	case begbuf:
+	  assertions |= DFA_BEGBUF;
+	  break;
+	case on_failure_jump: case on_failure_keep_string_jump:
+	case on_failure_jump_loop: case on_failure_jump_nastyloop:
+	case on_failure_jump_smart:
+	  branches = true;
+	  break;
+	default:
+	  break;
+	}
+    }
+
+  /* Without branches, backtracking takes linear time anyway.  */
+  if (!branches)
+    {
+      xfree (node_at);
+      return NULL;
+    }
+
+  /* The end of the compiled code accepts, as for POSIX patterns.  */
+  node_at[bufp->used] = nnodes++;
+
+  struct re_nfa_node *nodes = xnmalloc (nnodes, sizeof *nodes);
+  for (q = p; q < pend; q = end)
+    {
+      end = re_dfa_insn_end (q, multibyte, &nchars);
+      struct re_nfa_node *node = &nodes[node_at[q - p]];
+      node->next = node - nodes + 1;
+      switch (*q)
+	{
+	case exactn:
+	  {
+	    re_char *r = q + 2;
+	    node->op = NFA_EPSILON;
+	    for (struct re_nfa_node *n = node; r < end; n++)
+	      {
+		int pat_ch, pat_charlen = 1;
+		if (multibyte)
+		  pat_ch = string_char_and_length (r, &pat_charlen);
+		else
+		  pat_ch = target_multibyte ? RE_CHAR_TO_MULTIBYTE (*r) : *r;
+		if (multibyte && !target_multibyte)
+		  pat_ch = RE_CHAR_TO_UNIBYTE (pat_ch);
+		n->op = NFA_CHAR;
+		n->arg = pat_ch;
+		n->next = n - nodes + 1;
+		r += pat_charlen;
+	      }
+	  }
+	  break;
+
+	case anychar:
+	  node->op = NFA_ANYCHAR;
+	  break;
+
+	case charset: case charset_not:
+	  node->op = NFA_CHARSET;
+	  node->arg = q - p;
+	  break;
+
+	case succeed:
+	  node->op = NFA_MATCH;
+	  break;
+
+	case begline: node->op = NFA_BEGLINE; break;
+	case endline: node->op = NFA_ENDLINE; break;
+	case begbuf: node->op = NFA_BEGBUF; break;
+	case endbuf: node->op = NFA_ENDBUF; break;
+
+	case jump:
+	  node->op = NFA_EPSILON;
+	  node->next = re_dfa_jump_target (bufp, q, node_at);
+	  break;
+
+	case on_failure_jump: case on_failure_keep_string_jump:
+	case on_failure_jump_loop: case on_failure_jump_nastyloop:
+	case on_failure_jump_smart:
+	  node->op = NFA_SPLIT;
+	  node->alt = re_dfa_jump_target (bufp, q, node_at);
+	  if (node->alt < 0)
+	    node->next = -1;
+	  break;
+
+	default:
+	  node->op = NFA_EPSILON;
+	  break;
+	}
+      if (node->next < 0)
+	{
+	  xfree (node_at);
+	  xfree (nodes);
+	  return NULL;
+	}
+    }
+  nodes[nnodes - 1].op = NFA_MATCH;
+  xfree (node_at);
+
+  struct re_dfa *dfa = xzalloc (sizeof *dfa);
+  dfa->nodes = nodes;
+  dfa->nnodes = nnodes;
+  dfa->target_multibyte = target_multibyte;
+  dfa->assertions = assertions;
+  dfa->uses_tables = uses_tables;
+  dfa->syntax_table = dfa->downcase_table = dfa->upcase_table = Qnil;
+  dfa->anchored.anchored = true;
+  dfa->stack = xnmalloc (3 * nnodes + 1, sizeof *dfa->stack);
+  dfa->closure = xnmalloc (nnodes, sizeof *dfa->closure);
+  dfa->set = xnmalloc (nnodes + 1, sizeof *dfa->set);
+  dfa->mark = xzalloc (nnodes * sizeof *dfa->mark);
+  return dfa;
+}
+
+static void
+re_dfa_cache_free (struct re_dfa_cache *cache)
+{
+  xfree (cache->states);
+  xfree (cache->kernels);
+  xfree (cache->table);
+}
+
+/* Free the DFA of the compiled pattern BUFP, if any.  */
+
+void
+re_free_dfa (struct re_pattern_buffer *bufp)
+{
+  struct re_dfa *dfa = bufp->dfa;
+  if (dfa)
+    {
+      re_dfa_cache_free (&dfa->anchored);
+      re_dfa_cache_free (&dfa->unanchored);
+      xfree (dfa->nodes);
+      xfree (dfa->stack);
+      xfree (dfa->closure);
+      xfree (dfa->set);
+      xfree (dfa->mark);
+      xfree (dfa);
+      bufp->dfa = NULL;
+    }
+}
+
+/* Mark the tables the DFA of BUFP was made with, so that other tables
+   cannot take their place.  */
+
+void
+re_mark_dfa (struct re_pattern_buffer *bufp)
+{
+  struct re_dfa *dfa = bufp->dfa;
+  if (dfa)
+    {
+      mark_object (dfa->syntax_table);
+      mark_object (dfa->downcase_table);
+      mark_object (dfa->upcase_table);
+    }
+}
+
+/* Remove all the states of CACHE.  */
+
+static void
+re_dfa_flush (struct re_dfa_cache *cache)
+{
+  cache->nstates = 0;
+  cache->nkernels = 0;
+  if (cache->table)
+    for (int i = 0; i < DFA_TABLE_SIZE; i++)
+      cache->table[i] = -1;
+}
+
+static unsigned int
+re_dfa_hash (int const *set, int n, int flags)
+{
+  unsigned int hash = flags;
+  for (int i = 0; i < n; i++)
+    hash = hash * 31 + set[i];
+  return hash % DFA_TABLE_SIZE;
+}
+
+/* Return the state of CACHE whose kernel is the sorted set of N nodes
+   SET and whose flags are FLAGS, making it if needed, or -1 if CACHE
+   is full.  */
+
+static int
+re_dfa_state (struct re_dfa_cache *cache, int const *set, int n, int flags)
+{
+  if (!cache->table)
+    {
+      cache->table = xnmalloc (DFA_TABLE_SIZE, sizeof *cache->table);
+      re_dfa_flush (cache);
+    }
+
+  unsigned int hash = re_dfa_hash (set, n, flags);
+  for (int s = cache->table[hash]; s >= 0; s = cache->states[s].hash_next)
+    {
+      struct re_dfa_state *state = &cache->states[s];
+      if (state->nkernel == n && state->flags == flags
+	  && !memcmp (cache->kernels + state->kernel, set, n * sizeof *set))
+	return s;
+    }
+
+  if (cache->nstates == DFA_MAX_STATES)
+    return -1;
+  if (cache->nstates == cache->states_alloc)
+    cache->states = xpalloc (cache->states, &cache->states_alloc, 1,
+			     DFA_MAX_STATES, sizeof *cache->states);
+  if (cache->kernels_alloc - cache->nkernels < n)
+    cache->kernels = xpalloc (cache->kernels, &cache->kernels_alloc,
+			      n - (cache->kernels_alloc - cache->nkernels),
+			      -1, sizeof *cache->kernels);
+
+  int s = cache->nstates++;
+  struct re_dfa_state *state = &cache->states[s];
+  state->kernel = cache->nkernels;
+  state->nkernel = n;
+  state->flags = flags;
+  state->hash_next = cache->table[hash];
+  for (int c = 0; c < 256; c++)
+    state->trans[c] = -1;
+  memcpy (cache->kernels + cache->nkernels, set, n * sizeof *set);
+  cache->nkernels += n;
+  cache->table[hash] = s;
+  return s;
+}
+
+/* Start a new generation of the marks of the nodes of DFA.  */
+
+static unsigned int
+re_dfa_new_generation (struct re_dfa *dfa)
+{
+  if (++dfa->generation == 0)
+    {
+      memset (dfa->mark, 0, dfa->nnodes * sizeof *dfa->mark);
+      dfa->generation = 1;
+    }
+  return dfa->generation;
+}
+
+/* Store in the closure of DFA the nodes that consume characters and
+   that the N nodes of KERNEL lead to, at a position where the
+   assertions FLAGS hold.  Return their number, and set *ACCEPT if the
+   NFA accepts there.  */
+
+static int
+re_dfa_closure (struct re_dfa *dfa, int const *kernel, int n, int flags,
+		bool *accept)
+{
+  unsigned int generation = re_dfa_new_generation (dfa);
+  int *stack = dfa->stack, sp = 0, nclosure = 0;
+
+  /* Each node is expanded once, and pushes at most two others, so
+     the stack holds at most N + 2 * dfa->nnodes nodes.  */
+  for (int i = n; 0 < i; )
+    stack[sp++] = kernel[--i];
+  *accept = false;
+
+  while (0 < sp)
+    {
+      int i = stack[--sp];
+      if (dfa->mark[i] == generation)
+	continue;
+      dfa->mark[i] = generation;
+      struct re_nfa_node *node = &dfa->nodes[i];
+      bool holds;
+      switch (node->op)
+	{
+	case NFA_CHAR: case NFA_ANYCHAR: case NFA_CHARSET:
+	  dfa->closure[nclosure++] = i;
+	  continue;
+	case NFA_MATCH:
+	  *accept = true;
+	  continue;
+	case NFA_SPLIT:
+	  stack[sp++] = node->alt;
+	  FALLTHROUGH;
+	case NFA_EPSILON:
+	  holds = true;
+	  break;
+	case NFA_BEGLINE: holds = flags & DFA_BEGLINE; break;
+	case NFA_ENDLINE: holds = flags & DFA_ENDLINE; break;
+	case NFA_BEGBUF: holds = flags & DFA_BEGBUF; break;
+	case NFA_ENDBUF: holds = flags & DFA_ENDBUF; break;
+	default:
+	  emacs_abort ();
+	}
+      if (holds)
+	stack[sp++] = node->next;
+    }
+  return nclosure;
+}
+
+/* Return true if NODE of the DFA of BUFP matches the character C of
+   the text, as re_match_2_internal would.  */
+
+static bool
+re_dfa_node_matches (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+		     struct re_nfa_node *node, int c)
+{
+  Lisp_Object translate = bufp->translate;
+  bool target_multibyte = dfa->target_multibyte;
+  int corig = c;
+
+  switch (node->op)
+    {
+    case NFA_CHAR:
+      if (!target_multibyte)
+	{
+	  c = RE_CHAR_TO_MULTIBYTE (corig);
+	  if (CHAR_BYTE8_P (c))
+	    return corig == node->arg;
+	  c = RE_CHAR_TO_UNIBYTE (TRANSLATE (c));
+	  if (c < 0)
+	    c = corig;
+	  return c == node->arg;
+	}
+      return TRANSLATE (c) == node->arg;
+
+    case NFA_ANYCHAR:
+      return TRANSLATE (c) != '\n';
+
+    case NFA_CHARSET:
+      {
+	bool unibyte_char = false;
+	if (target_multibyte)
+	  {
+	    c = TRANSLATE (c);
+	    int c1 = RE_CHAR_TO_UNIBYTE (c);
+	    if (c1 >= 0)
+	      {
+		unibyte_char = true;
+		c = c1;
+	      }
+	  }
+	else
+	  {
+	    int c1 = RE_CHAR_TO_MULTIBYTE (c);
+	    if (! CHAR_BYTE8_P (c1))
+	      {
+		c1 = RE_CHAR_TO_UNIBYTE (TRANSLATE (c1));
+		if (c1 >= 0)
+		  {
+		    unibyte_char = true;
+		    c = c1;
+		  }
+	      }
+	    else
+	      unibyte_char = true;
+	  }
+	re_char *p = bufp->buffer + node->arg;
+	return execute_charset (&p, c, corig, unibyte_char, translate);
+      }
+
+    default:
+      emacs_abort ();
+    }
+}
+
+/* Return the transition of state S of CACHE, of the DFA of BUFP, on
+   the character C, as the trans member of a state stores it, or -1 if
+   the DFA gives up.  */
+
+static int
+re_dfa_step (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+	     struct re_dfa_cache *cache, int s, int c)
+{
+  struct re_dfa_state *state = &cache->states[s];
+  bool accept;
+  int nclosure
+    = re_dfa_closure (dfa, cache->kernels + state->kernel, state->nkernel,
+		      state->flags | (c == '\n' ? DFA_ENDLINE : 0), &accept);
+
+  /* The kernel of the next state: the nodes after those that match C,
+     in increasing order and without duplicates.  */
+  unsigned int generation = re_dfa_new_generation (dfa);
+  int n = 0;
+  for (int i = 0; i < nclosure; i++)
+    {
+      struct re_nfa_node *node = &dfa->nodes[dfa->closure[i]];
+      if (dfa->mark[node->next] != generation
+	  && re_dfa_node_matches (bufp, dfa, node, c))
+	{
+	  dfa->mark[node->next] = generation;
+	  dfa->set[n++] = node->next;
+	}
+    }
+  if (!cache->anchored && dfa->mark[0] != generation)
+    dfa->set[n++] = 0;
+  for (int i = 1; i < n; i++)
+    for (int j = i; 0 < j && dfa->set[j - 1] > dfa->set[j]; j--)
+      {
+	int tem = dfa->set[j];
+	dfa->set[j] = dfa->set[j - 1];
+	dfa->set[j - 1] = tem;
+      }
+
+  int flags = (c == '\n' ? DFA_BEGLINE : 0) & dfa->assertions;
+  int next = re_dfa_state (cache, dfa->set, n, flags);
+  if (next < 0)
+    {
+      if (DFA_MAX_FLUSHES < ++cache->flushes)
+	return -1;
+      re_dfa_flush (cache);
+      return 2 * re_dfa_state (cache, dfa->set, n, flags) + accept;
+    }
+
+  int trans = 2 * next + accept;
+  if (c < 256)
+    cache->states[s].trans[c] = trans;
+  return trans;
+}
+
+/* Return the DFA of BUFP, making it if needed, or NULL if BUFP
+   cannot run on one.  */
+
+static struct re_dfa *
+re_dfa_get (struct re_pattern_buffer *bufp)
+{
+  if (bufp->dfa_impossible)
+    return NULL;
+  if (bufp->dfa && bufp->dfa->target_multibyte != RE_TARGET_MULTIBYTE_P (bufp))
+    re_free_dfa (bufp);
+  if (!bufp->dfa)
+    {
+      bufp->dfa = re_dfa_make (bufp);
+      if (!bufp->dfa)
+	{
+	  bufp->dfa_impossible = true;
+	  return NULL;
+	}
+    }
+
+  struct re_dfa *dfa = bufp->dfa;
+  /* The syntax and case tables are those of the current buffer.  */
+  if (dfa->uses_tables
+      && !(EQ (dfa->syntax_table, BVAR (current_buffer, syntax_table))
+	   && EQ (dfa->downcase_table, BVAR (current_buffer, downcase_table))
+	   && EQ (dfa->upcase_table, BVAR (current_buffer, upcase_table))))
+    {
+      re_dfa_flush (&dfa->anchored);
+      re_dfa_flush (&dfa->unanchored);
+      dfa->syntax_table = BVAR (current_buffer, syntax_table);
+      dfa->downcase_table = BVAR (current_buffer, downcase_table);
+      dfa->upcase_table = BVAR (current_buffer, upcase_table);
+    }
+  return dfa;
+}
+
+/* Run the DFA of BUFP on the virtual concatenation of STRING1 and
+   STRING2, of sizes SIZE1 and SIZE2, from POS up to STOP.  If
+   ANCHORED, find whether a match of BUFP starts at POS, and otherwise
+   whether one starts anywhere from POS on.  Return 1 if there is a
+   match, 0 if there is none, and -1 if the DFA cannot tell.  */
+
+static int
+re_dfa_run (struct re_pattern_buffer *bufp, bool anchored,
+	    re_char *string1, ptrdiff_t size1,
+	    re_char *string2, ptrdiff_t size2,
+	    ptrdiff_t pos, ptrdiff_t stop)
+{
+  struct re_dfa *dfa = re_dfa_get (bufp);
+  if (!dfa)
+    return -1;
+  struct re_dfa_cache *cache = anchored ? &dfa->anchored : &dfa->unanchored;
+  bool target_multibyte = dfa->target_multibyte;
+  cache->flushes = 0;
+
+  int flags = 0;
+  if (pos == 0)
+    flags = DFA_BEGLINE | DFA_BEGBUF;
+  else if ((pos <= size1 ? string1[pos - 1] : string2[pos - 1 - size1])
+	   == '\n')
+    flags = DFA_BEGLINE;
+  int start = 0;
+  int s = re_dfa_state (cache, &start, 1, flags & dfa->assertions);
+  if (s < 0)
+    {
+      re_dfa_flush (cache);
+      s = re_dfa_state (cache, &start, 1, flags & dfa->assertions);
+    }
+
+  /* Go through the text in STRING1, then in STRING2.  */
+  for (int part = 0; part < 2; part++)
+    {
+      re_char *d, *dend;
+      if (part == 0)
+	{
+	  if (size1 <= pos)
+	    continue;
+	  d = string1 + pos;
+	  dend = string1 + min (stop, size1);
+	}
+      else
+	{
+	  if (stop <= size1)
+	    break;
+	  d = string2 + max (pos - size1, 0);
+	  dend = string2 + stop - size1;
+	}
+
+      while (d < dend)
+	{
+	  int c, len = 1;
+	  if (*d < 0x80 || !target_multibyte)
+	    c = *d;
+	  else
+	    c = string_char_and_length (d, &len);
+	  d += len;
+
+	  int trans = c < 256 ? cache->states[s].trans[c] : -1;
+	  if (trans < 0)
+	    {
+	      trans = re_dfa_step (bufp, dfa, cache, s, c);
+	      if (trans < 0)
+		return -1;
+	    }
+	  if (trans & 1)
+	    return 1;
+	  s = trans >> 1;
+	  if (cache->states[s].nkernel == 0)
+	    return 0;
+	}
+    }
+
+  /* Whether a match ends at STOP depends on what follows.  */
+  if (stop == size1 + size2)
+    flags = DFA_ENDLINE | DFA_ENDBUF;
+  else
+    flags = ((stop < size1 ? string1[stop] : string2[stop - size1]) == '\n'
+	     ? DFA_ENDLINE : 0);
+  struct re_dfa_state *state = &cache->states[s];
+  bool accept;
+  re_dfa_closure (dfa, cache->kernels + state->kernel, state->nkernel,
+		  state->flags | flags, &accept);
+  return accept;
+}
+
 /* Searching routines.  */
 
 /* Like re_search_2, below, but only one string is specified, and
@@ -3461,6 +4495,17 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 
   RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, startpos);
 
+  /* Whether the DFA of the pattern should tell where matches start,
+     because it was found to backtrack a lot.  */
+  bool use_dfa = bufp->dfa || regexp_dfa_fail_limit <= 0;
+
+  /* In a forward search, give up at once if no match starts anywhere
+     from STARTPOS on.  */
+  if (use_dfa && range > 0 && endpos <= stop
+      && re_dfa_run (bufp, false, string1, size1, string2, size2,
+		     startpos, stop) == 0)
+    return -1;
+
   /* Loop through the string, looking for a place to start matching.  */
   for (;;)
     {
@@ -3576,8 +4621,29 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	  && !bufp->can_be_null)
 	return -1;
 
+      /* Don't backtrack where the DFA knows that no match starts.  */
+      if (use_dfa
+	  && re_dfa_run (bufp, true, string1, size1, string2, size2,
+			 startpos, stop) == 0)
+	goto advance;
+
       val = re_match_2_internal (bufp, string1, size1, string2, size2,
-				 startpos, regs, stop);
+				 startpos, regs, stop,
+				 use_dfa ? 0 : regexp_dfa_fail_limit);
+
+      if (val == DFA_GAVE_UP)
+	{
+	  use_dfa = true;
+	  if (range > 0 && endpos <= stop
+	      && re_dfa_run (bufp, false, string1, size1, string2, size2,
+			     startpos, stop) == 0)
+	    return -1;
+	  if (re_dfa_run (bufp, true, string1, size1, string2, size2,
+			  startpos, stop) == 0)
+	    goto advance;
+	  val = re_match_2_internal (bufp, string1, size1, string2, size2,
+				     startpos, regs, stop, 0);
+	}
 
       if (val >= 0)
 	return startpos;
@@ -4053,9 +5119,24 @@ re_match_2 (struct re_pattern_buffer *bufp,
 
   RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, pos);
 
+  bool use_dfa = bufp->dfa || regexp_dfa_fail_limit <= 0;
+  if (use_dfa
+      && re_dfa_run (bufp, true, (re_char *) string1, size1,
+		     (re_char *) string2, size2, pos, stop) == 0)
+    return -1;
+
   result = re_match_2_internal (bufp, (re_char *) string1, size1,
-				(re_char *) string2, size2,
-				pos, regs, stop);
+				(re_char *) string2, size2, pos, regs, stop,
+				use_dfa ? 0 : regexp_dfa_fail_limit);
+  if (result == DFA_GAVE_UP)
+    {
+      if (re_dfa_run (bufp, true, (re_char *) string1, size1,
+		      (re_char *) string2, size2, pos, stop) == 0)
+	return -1;
+      result = re_match_2_internal (bufp, (re_char *) string1, size1,
+				    (re_char *) string2, size2,
+				    pos, regs, stop, 0);
+    }
   return result;
 }
 
@@ -4067,12 +5148,14 @@ unwind_re_match (void *ptr)
 }
 
 /* This is a separate function so that we can force an alloca cleanup
-   afterwards.  */
+   afterwards.  If FAIL_LIMIT is positive, give up and return
+   DFA_GAVE_UP after failing that many times.  */
 static ptrdiff_t
 re_match_2_internal (struct re_pattern_buffer *bufp,
 		     re_char *string1, ptrdiff_t size1,
 		     re_char *string2, ptrdiff_t size2,
-		     ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop)
+		     ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop,
+		     ptrdiff_t fail_limit)
 {
   eassume (0 <= size1);
   eassume (0 <= size2);
@@ -5236,6 +6319,12 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
       maybe_quit ();
       if (!FAIL_STACK_EMPTY ())
 	{
+	  if (fail_limit > 0 && --fail_limit == 0)
+	    {
+	      retval = DFA_GAVE_UP;
+	      goto endof_re_match;
+	    }
+
 	  re_char *str, *pat;
 	  /* A restart point is known.  Restore to that state.  */
 	  DEBUG_PRINT ("\nFAIL:\n");
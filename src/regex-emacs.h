@@ -118,6 +118,21 @@ #define EMACS_REGEX_H 1
   /* If true, multi-byte form in the target of match should be
      recognized as a multibyte character.  */
   bool_bf target_multibyte : 1;
+
+  /* If true, the pattern cannot run on a DFA.  */
+  bool_bf dfa_impossible : 1;
+
+  /* If true, every match starts with the string described by 'must'.  */
+  bool_bf must_prefix : 1;
+
+  /* The offset in 'buffer' of the longest string of characters that
+     every match contains, as it is stored there, and its length in
+     bytes, or 0 if the compiler found no such string.  */
+  ptrdiff_t must, must_len;
+
+  /* The lazy DFA that tells where the pattern matches, or NULL if it
+     was not made yet.  */
+  struct re_dfa *dfa;
 };
 
 /* Declarations for routines.  */
@@ -178,6 +193,32 @@ #define EMACS_REGEX_H 1
 			      ptrdiff_t num_regs,
 			      ptrdiff_t *starts, ptrdiff_t *ends);
 
+/* The most strings, and the most bytes of each, that
+   're_prefix_literals' returns.  */
+enum { RE_LITERALS_MAX = 64, RE_LITERAL_MAX = 16 };
+
+/* A set of strings one of which starts every match of a pattern.  */
+struct re_literals
+{
+  /* The number of strings, and the length in bytes of each.  */
+  int n;
+  unsigned char len[RE_LITERALS_MAX];
+  /* The bytes of each string, as stored in the compiled pattern.  */
+  unsigned char str[RE_LITERALS_MAX][RE_LITERAL_MAX];
+};
+
+/* Set *LITERALS to strings one of which starts every match of the
+   pattern compiled in BUFFER, and return true; or return false if no
+   such strings were found.  */
+extern bool re_prefix_literals (struct re_pattern_buffer *buffer,
+				struct re_literals *literals);
+
+/* Free the DFA of BUFFER, if any.  */
+extern void re_free_dfa (struct re_pattern_buffer *buffer);
+
+/* Mark the Lisp objects the DFA of BUFFER refers to.  */
+extern void re_mark_dfa (struct re_pattern_buffer *buffer);
+
 /* Character classes.  */
 typedef enum { RECC_ERROR = 0,
 	       RECC_ALNUM, RECC_ALPHA, RECC_WORD,
@@ -23,6 +23,9 @@ Copyright (C) 1985-1987, 1993-1994, 1997-1999, 2001-2024 Free Software
 
 #include <stdio.h>
 #include <stdlib.h>
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
 
 #include "lisp.h"
 #include "character.h"
@@ -30,20 +33,29 @@ Copyright (C) 1985-1987, 1993-1994, 1997-1999, 2001-2024 Free Software
 #include "syntax.h"
 #include "charset.h"
 #include "region-cache.h"
+#include "line-index.h"
 #include "blockinput.h"
+#include "systime.h"
 #include "intervals.h"
 #include "pdumper.h"
 #include "composite.h"
 
 #include "regex-emacs.h"
 
-#define REGEXP_CACHE_SIZE 20
+/* The cache of compiled regexps holds at most regexp-cache-size
+   of them, or this many if that is smaller.  */
+enum { REGEXP_CACHE_MIN_SIZE = 20 };
 
 /* If the regexp is non-nil, then the buffer contains the compiled form
    of that regexp, suitable for searching.  */
 struct regexp_cache
 {
-  struct regexp_cache *next;
+  /* The entries used more and less recently than this one.  */
+  struct regexp_cache *prev, *next;
+  /* The next entry in the same bucket of the hash table.  */
+  struct regexp_cache *hash_next;
+  /* The hash of the key of the regexp, see regexp_cache_hash.  */
+  EMACS_UINT hash;
   Lisp_Object regexp, f_whitespace_regexp;
   /* Syntax table for which the regexp applies.  We need this because
      of character classes.  If this is t, then the compiled pattern is valid
@@ -55,13 +67,30 @@ #define REGEXP_CACHE_SIZE 20
   bool posix;
   /* True means we're inside a buffer match.  */
   bool busy;
+  /* True if LITERALS was prepared, for text of the multibyteness
+     LITERALS_MULTIBYTE ignoring case with LITERALS_INVERSE.  */
+  bool literals_ready, literals_multibyte;
+  Lisp_Object literals_inverse;
+  /* The strings one of which starts every match, prepared for looking
+     for them in text, or NULL if they are not looked for.  */
+  struct literal_set *literals;
 };
 
-/* The instances of that struct.  */
-static struct regexp_cache searchbufs[REGEXP_CACHE_SIZE];
+/* The most and the least recently used entries of the cache.  */
+static struct regexp_cache *searchbuf_head, *searchbuf_tail;
+
+/* The number of entries in the cache.  */
+static ptrdiff_t searchbuf_count;
+
+/* A hash table of the entries of the cache, indexed by the hash of
+   their key.  Its size is a power of two.  */
+static struct regexp_cache **searchbuf_table;
+static ptrdiff_t searchbuf_table_size;
 
-/* The head of the linked list; points to the most recently used buffer.  */
-static struct regexp_cache *searchbuf_head;
+/* Statistics on the use of the cache.  */
+static intmax_t regexp_cache_hits, regexp_cache_misses;
+static intmax_t regexp_cache_evictions;
+static struct timespec regexp_cache_compile_time;
 
 static void set_search_regs (ptrdiff_t, ptrdiff_t);
 static void save_search_regs (void);
@@ -71,6 +100,8 @@ #define REGEXP_CACHE_SIZE 20
 static EMACS_INT boyer_moore (EMACS_INT, unsigned char *, ptrdiff_t,
                               Lisp_Object, Lisp_Object, ptrdiff_t,
                               ptrdiff_t, int);
+static int literal_fold_mask (int, Lisp_Object, Lisp_Object);
+static void literal_set_free (struct literal_set *);
 
 Lisp_Object re_match_object;
 
@@ -109,6 +140,9 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
 
   eassert (!cp->busy);
   cp->regexp = Qnil;
+  literal_set_free (cp->literals);
+  cp->literals = NULL;
+  cp->literals_ready = false;
   cp->buf.translate = translate;
   cp->posix = posix;
   cp->buf.multibyte = STRING_MULTIBYTE (pattern);
@@ -121,8 +155,12 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
   whitespace_regexp = STRINGP (Vsearch_spaces_regexp) ?
     SSDATA (Vsearch_spaces_regexp) : NULL;
 
+  struct timespec start = current_timespec ();
   val = (char *) re_compile_pattern (SSDATA (pattern), SBYTES (pattern),
 				     posix, whitespace_regexp, &cp->buf);
+  regexp_cache_compile_time
+    = timespec_add (regexp_cache_compile_time,
+		    timespec_sub (current_timespec (), start));
 
   /* If the compiled pattern hard codes some of the contents of the
      syntax-table, it can only be reused with *this* syntax table.  */
@@ -151,6 +189,22 @@ shrink_regexp_cache (void)
       }
 }
 
+/* Mark the Lisp objects referenced by the regexp cache.  */
+
+void
+mark_regexp_cache (void)
+{
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
+    {
+      mark_object (cp->regexp);
+      mark_object (cp->f_whitespace_regexp);
+      mark_object (cp->syntax_table);
+      mark_object (cp->buf.translate);
+      mark_object (cp->literals_inverse);
+      re_mark_dfa (&cp->buf);
+    }
+}
+
 /* Clear the regexp cache w.r.t. a particular syntax table,
    because it was changed.
    There is no danger of memory leak here because re_compile_pattern
@@ -159,14 +213,160 @@ shrink_regexp_cache (void)
 void
 clear_regexp_cache (void)
 {
-  int i;
-
-  for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
     /* It's tempting to compare with the syntax-table we've actually changed,
        but it's not sufficient because char-table inheritance means that
        modifying one syntax-table can change others at the same time.  */
-    if (!searchbufs[i].busy && !BASE_EQ (searchbufs[i].syntax_table, Qt))
-      searchbufs[i].regexp = Qnil;
+    if (!cp->busy && !BASE_EQ (cp->syntax_table, Qt))
+      cp->regexp = Qnil;
+}
+
+/* Return the hash of the key under which PATTERN, compiled with
+   TRANSLATE and POSIX as for compile_pattern, is kept in the cache.
+   The other things a compiled pattern depends on are checked when
+   looking for it, but do not take part in its hash.  */
+
+static EMACS_UINT
+regexp_cache_hash (Lisp_Object pattern, Lisp_Object translate, bool posix)
+{
+  EMACS_UINT hash = hash_string (SSDATA (pattern), SBYTES (pattern));
+  hash = sxhash_combine (hash, XHASH (translate));
+  return sxhash_combine (hash, (STRING_MULTIBYTE (pattern) << 1) | posix);
+}
+
+static struct regexp_cache **
+regexp_cache_bucket (EMACS_UINT hash)
+{
+  return &searchbuf_table[hash & (searchbuf_table_size - 1)];
+}
+
+/* Remove CP from the hash table of the cache.  */
+
+static void
+regexp_cache_unhash (struct regexp_cache *cp)
+{
+  struct regexp_cache **p = regexp_cache_bucket (cp->hash);
+  while (*p != cp)
+    p = &(*p)->hash_next;
+  *p = cp->hash_next;
+}
+
+/* Add CP to the hash table of the cache under HASH.  */
+
+static void
+regexp_cache_rehash (struct regexp_cache *cp, EMACS_UINT hash)
+{
+  struct regexp_cache **p = regexp_cache_bucket (hash);
+  cp->hash = hash;
+  cp->hash_next = *p;
+  *p = cp;
+}
+
+/* Remove CP from the list of entries ordered by use.  */
+
+static void
+regexp_cache_unlink (struct regexp_cache *cp)
+{
+  if (cp->prev)
+    cp->prev->next = cp->next;
+  else
+    searchbuf_head = cp->next;
+  if (cp->next)
+    cp->next->prev = cp->prev;
+  else
+    searchbuf_tail = cp->prev;
+}
+
+/* Put CP at the front of the list of entries ordered by use, as the
+   most recently used.  */
+
+static void
+regexp_cache_push (struct regexp_cache *cp)
+{
+  cp->prev = NULL;
+  cp->next = searchbuf_head;
+  if (searchbuf_head)
+    searchbuf_head->prev = cp;
+  else
+    searchbuf_tail = cp;
+  searchbuf_head = cp;
+}
+
+/* Return the maximum number of entries of the cache.  */
+
+static ptrdiff_t
+regexp_cache_max_size (void)
+{
+  return clip_to_bounds (REGEXP_CACHE_MIN_SIZE, regexp_cache_size,
+			 PTRDIFF_MAX / 2 / sizeof *searchbuf_table);
+}
+
+/* Make the hash table of the cache large enough for SIZE entries.  */
+
+static void
+regexp_cache_resize_table (ptrdiff_t size)
+{
+  ptrdiff_t table_size = searchbuf_table_size;
+  while (table_size < size)
+    table_size *= 2;
+  if (table_size == searchbuf_table_size)
+    return;
+  xfree (searchbuf_table);
+  searchbuf_table = xzalloc (table_size * sizeof *searchbuf_table);
+  searchbuf_table_size = table_size;
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
+    regexp_cache_rehash (cp, cp->hash);
+}
+
+/* Return a new, empty entry of the cache.  */
+
+static struct regexp_cache *
+regexp_cache_new (void)
+{
+  struct regexp_cache *cp = xzalloc (sizeof *cp);
+  cp->buf.allocated = 100;
+  cp->buf.buffer = xmalloc (100);
+  cp->buf.fastmap = cp->fastmap;
+  cp->buf.translate = Qnil;
+  cp->regexp = Qnil;
+  cp->f_whitespace_regexp = Qnil;
+  cp->syntax_table = Qnil;
+  cp->literals_inverse = Qnil;
+  searchbuf_count++;
+  regexp_cache_push (cp);
+  regexp_cache_rehash (cp, 0);
+  return cp;
+}
+
+/* Remove CP from the cache and free it.  */
+
+static void
+regexp_cache_free (struct regexp_cache *cp)
+{
+  eassert (!cp->busy);
+  regexp_cache_unlink (cp);
+  regexp_cache_unhash (cp);
+  searchbuf_count--;
+  re_free_dfa (&cp->buf);
+  literal_set_free (cp->literals);
+  xfree (cp->buf.buffer);
+  xfree (cp);
+}
+
+/* Free the least recently used entries of the cache that are not
+   busy, until it has at most SIZE entries.  */
+
+static void
+regexp_cache_trim (ptrdiff_t size)
+{
+  struct regexp_cache *cp = searchbuf_tail;
+  while (searchbuf_count > size && cp)
+    {
+      struct regexp_cache *prev = cp->prev;
+      if (!cp->busy)
+	regexp_cache_free (cp);
+      cp = prev;
+    }
 }
 
 static void
@@ -199,54 +399,60 @@ freeze_pattern (struct regexp_cache *searchbuf)
 compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 		 Lisp_Object translate, bool posix, bool multibyte)
 {
-  struct regexp_cache *cp, **cpp, **lru_nonbusy;
-
-  for (cpp = &searchbuf_head, lru_nonbusy = NULL; ; cpp = &cp->next)
+  struct regexp_cache *cp;
+  EMACS_UINT hash = regexp_cache_hash (pattern, translate, posix);
+  ptrdiff_t size = regexp_cache_max_size ();
+
+  regexp_cache_resize_table (size);
+  if (searchbuf_count > size)
+    regexp_cache_trim (size);
+
+  for (cp = *regexp_cache_bucket (hash); cp; cp = cp->hash_next)
+    /* Entries may be set to nil by compile_pattern_1 if the pattern
+       isn't valid, or by clear_regexp_cache.  Don't apply string
+       accessors in those cases.  */
+    if (cp->hash == hash
+	&& !NILP (cp->regexp)
+	&& SCHARS (cp->regexp) == SCHARS (pattern)
+	&& !cp->busy
+	&& STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
+	&& !NILP (Fstring_equal (cp->regexp, pattern))
+	&& BASE_EQ (cp->buf.translate, translate)
+	&& cp->posix == posix
+	&& (BASE_EQ (cp->syntax_table, Qt)
+	    || BASE_EQ (cp->syntax_table,
+			BVAR (current_buffer, syntax_table)))
+	&& !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
+	&& cp->buf.charset_unibyte == charset_unibyte)
+      break;
+
+  if (cp)
+    regexp_cache_hits++;
+  else
     {
-      cp = *cpp;
-      if (!cp->busy)
-        lru_nonbusy = cpp;
-      /* Entries are initialized to nil, and may be set to nil by
-	 compile_pattern_1 if the pattern isn't valid.  Don't apply
-	 string accessors in those cases.  However, compile_pattern_1
-	 is only applied to the cache entry we pick here to reuse.  So
-	 nil should never appear before a non-nil entry.  */
-      if (NILP (cp->regexp))
-	goto compile_it;
-      if (SCHARS (cp->regexp) == SCHARS (pattern)
-          && !cp->busy
-	  && STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
-	  && !NILP (Fstring_equal (cp->regexp, pattern))
-	  && BASE_EQ (cp->buf.translate, translate)
-	  && cp->posix == posix
-	  && (BASE_EQ (cp->syntax_table, Qt)
-	      || BASE_EQ (cp->syntax_table,
-			  BVAR (current_buffer, syntax_table)))
-	  && !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
-	  && cp->buf.charset_unibyte == charset_unibyte)
-	break;
-
-      /* If we're at the end of the cache, compile into the last
-	 (least recently used) non-busy cell in the cache.  */
-      if (cp->next == 0)
+      regexp_cache_misses++;
+      if (searchbuf_count < size)
+	cp = regexp_cache_new ();
+      else
 	{
-          if (!lru_nonbusy)
-            error ("Too much matching reentrancy");
-          cpp = lru_nonbusy;
-          cp = *cpp;
-	compile_it:
-          eassert (!cp->busy);
-	  compile_pattern_1 (cp, pattern, translate, posix);
-	  break;
+	  /* Compile into the least recently used non-busy entry.  */
+	  for (cp = searchbuf_tail; cp && cp->busy; cp = cp->prev)
+	    ;
+	  if (!cp)
+	    error ("Too much matching reentrancy");
+	  if (!NILP (cp->regexp))
+	    regexp_cache_evictions++;
 	}
+      regexp_cache_unhash (cp);
+      regexp_cache_rehash (cp, hash);
+      compile_pattern_1 (cp, pattern, translate, posix);
     }
 
-  /* When we get here, cp (aka *cpp) contains the compiled pattern,
-     either because we found it in the cache or because we just compiled it.
+  /* When we get here, cp contains the compiled pattern, either
+     because we found it in the cache or because we just compiled it.
      Move it to the front of the queue to mark it as most recently used.  */
-  *cpp = cp->next;
-  cp->next = searchbuf_head;
-  searchbuf_head = cp;
+  regexp_cache_unlink (cp);
+  regexp_cache_push (cp);
 
   /* Advise the searching functions about the space we have allocated
      for register data.  */
@@ -645,6 +851,63 @@ newline_cache_on_off (struct buffer *buf)
     }
 }
 
+
+/* Counting newlines in bulk.
+
+   When the COUNTth newline is far away, it is much cheaper to count
+   the newlines in a block of text at once and skip the whole block
+   than to stop at each newline with memchr.  The block scanners in
+   find_newline and display_count_lines below use this to get over
+   long stretches of short lines quickly.  */
+
+/* Count the newlines in the NBYTES bytes starting at P.  */
+
+ptrdiff_t
+count_newlines (unsigned char const *p, ptrdiff_t nbytes)
+{
+  ptrdiff_t n = 0;
+  unsigned char const *lim = p + nbytes;
+
+#ifdef __SSE2__
+  /* Compare 16 bytes at a time, accumulating the matches in per-byte
+     counters, which are folded into N before they can overflow.  */
+  __m128i const newline = _mm_set1_epi8 ('\n');
+  __m128i const zero = _mm_setzero_si128 ();
+  while (lim - p >= 16)
+    {
+      __m128i acc = zero;
+      int i;
+      for (i = 0; i < 255 && lim - p >= 16; i++, p += 16)
+	{
+	  __m128i chunk = _mm_loadu_si128 ((__m128i const *) p);
+	  acc = _mm_sub_epi8 (acc, _mm_cmpeq_epi8 (chunk, newline));
+	}
+      __m128i sums = _mm_sad_epu8 (acc, zero);
+      n += _mm_cvtsi128_si32 (sums) + _mm_extract_epi16 (sums, 4);
+    }
+#else
+  /* Look at a word at a time.  After the XOR, a byte of X is zero
+     exactly where the text has a newline; the high bit of each byte
+     of Y is set for the bytes of X that are nonzero.  */
+  enum { WORDSIZE = sizeof (size_t) };
+  size_t const ones = SIZE_MAX / UCHAR_MAX;
+  size_t const low7 = ones * 0x7f;
+  while (lim - p >= WORDSIZE)
+    {
+      size_t x;
+      memcpy (&x, p, WORDSIZE);
+      x ^= ones * '\n';
+      size_t y = ((x & low7) + low7) | x;
+      n += stdc_count_ones (~y & ~low7);
+      p += WORDSIZE;
+    }
+#endif
+
+  for (; p < lim; p++)
+    n += *p == '\n';
+  return n;
+}
+
 
 /* Search for COUNT newlines between START/START_BYTE and END/END_BYTE.
 
@@ -678,6 +941,7 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 {
   struct region_cache *newline_cache;
   struct buffer *cache_buffer;
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
 
   if (!end)
     {
@@ -698,6 +962,45 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
   if (counted)
     *counted = count;
 
+  /* If the newline we are looking for is likely to be far away, ask
+     the line index where it is.  */
+  if ((LINE_INDEX_MIN_LINES <= count || count <= - LINE_INDEX_MIN_LINES)
+      && LINE_INDEX_MIN_SPAN <= eabs (end - start))
+    {
+      struct line_index *line_index = buffer_line_index (current_buffer);
+
+      if (line_index)
+	{
+	  ptrdiff_t lines, pos, pos_byte;
+
+	  if (start_byte == -1)
+	    start_byte = CHAR_TO_BYTE (start);
+	  lines = line_index_newlines_before (current_buffer, line_index,
+					      start_byte);
+	  if (count > 0
+	      ? (line_index_after_newline (current_buffer, line_index,
+					   lines + count, &pos, &pos_byte)
+		 && pos_byte <= end_byte)
+	      : (line_index_after_newline (current_buffer, line_index,
+					   lines + count + 1, &pos, &pos_byte)
+		 && end_byte < pos_byte))
+	    {
+	      if (bytepos)
+		*bytepos = pos_byte;
+	      return pos;
+	    }
+
+	  /* There are fewer than COUNT newlines before END.  */
+	  if (counted)
+	    *counted = (line_index_newlines_before (current_buffer,
+						    line_index, end_byte)
+			- lines);
+	  if (bytepos)
+	    *bytepos = end_byte;
+	  return end;
+	}
+    }
+
   if (count > 0)
     while (start != end)
       {
@@ -796,6 +1099,43 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	  ptrdiff_t base = start_byte - lim_byte;
 	  ptrdiff_t cursor, next;
 
+	  /* While the COUNTth newline is not within the next block,
+	     count the newlines in the whole block and skip it.  Tell
+	     the cache about any block that has none.  */
+	  while (NEWLINE_SCAN_BLOCK <= - base)
+	    {
+	      ptrdiff_t n = count_newlines (lim_addr + base,
+					    NEWLINE_SCAN_BLOCK);
+	      if (count <= n)
+		break;
+	      if (newline_cache && n == 0)
+		{
+		  ptrdiff_t from = base, to = base + NEWLINE_SCAN_BLOCK;
+		  /* Don't let the block boundaries split a character.  */
+		  if (multibyte)
+		    {
+		      while (!CHAR_HEAD_P (lim_addr[from]))
+			from--;
+		      while (to < 0 && !CHAR_HEAD_P (lim_addr[to]))
+			to--;
+		    }
+		  know_region_cache (cache_buffer, newline_cache,
+				     BYTE_TO_CHAR (lim_byte + from),
+				     BYTE_TO_CHAR (lim_byte + to));
+		  /* know_region_cache can relocate buffer text.  */
+		  lim_addr = BYTE_POS_ADDR (ceiling_byte) + 1;
+		}
+	      count -= n;
+	      base += NEWLINE_SCAN_BLOCK;
+	      if (allow_quit)
+		maybe_quit ();
+	    }
+	  /* The dumb loop below converts BASE to a character position
+	     when using the cache, so it must not split a character.  */
+	  if (multibyte)
+	    while (base < 0 && !CHAR_HEAD_P (lim_addr[base]))
+	      base--;
+
 	  for (cursor = base; cursor < 0; cursor = next)
 	    {
               /* The dumb loop.  */
@@ -905,6 +1245,41 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	  ptrdiff_t base = start_byte - ceiling_byte;
 	  ptrdiff_t cursor, prev;
 
+	  /* Skip whole blocks as in the forward case.  */
+	  while (NEWLINE_SCAN_BLOCK <= base)
+	    {
+	      ptrdiff_t n = count_newlines (ceiling_addr + base
+					    - NEWLINE_SCAN_BLOCK,
+					    NEWLINE_SCAN_BLOCK);
+	      if (- count <= n)
+		break;
+	      if (newline_cache && n == 0)
+		{
+		  ptrdiff_t from = base - NEWLINE_SCAN_BLOCK, to = base;
+		  if (multibyte)
+		    {
+		      while (!CHAR_HEAD_P (ceiling_addr[from]))
+			from--;
+		      while (to < start_byte - ceiling_byte
+			     && !CHAR_HEAD_P (ceiling_addr[to]))
+			to--;
+		    }
+		  know_region_cache (cache_buffer, newline_cache,
+				     BYTE_TO_CHAR (ceiling_byte + from),
+				     BYTE_TO_CHAR (ceiling_byte + to));
+		  /* know_region_cache can relocate buffer text.  */
+		  ceiling_addr = BYTE_POS_ADDR (ceiling_byte);
+		}
+	      count += n;
+	      base -= NEWLINE_SCAN_BLOCK;
+	      if (allow_quit)
+		maybe_quit ();
+	    }
+	  if (multibyte)
+	    while (base < start_byte - ceiling_byte
+		   && !CHAR_HEAD_P (ceiling_addr[base]))
+	      base++;
+
 	  for (cursor = base; 0 < cursor; cursor = prev)
             {
 	      unsigned char *nl = memrchr (ceiling_addr, '\n', cursor);
@@ -1156,6 +1531,165 @@ while (0)
    (i.e. Vinhibit_changing_match_data is non-nil).  */
 static struct re_registers search_regs_1;
 
+/* Only this many bytes of the string that every match of a regexp
+   contains are looked for before running the regexp.  */
+enum { MUST_STRING_MAX = 64 };
+
+/* The string that every match of a regexp contains, as found by the
+   regexp compiler, prepared for looking for it in the current buffer.
+   Looking for it is much faster than running the regexp, which need
+   run only where it is found.  */
+struct must_string
+{
+  /* Its bytes, and their number, or 0 if it is not looked for.  */
+  unsigned char const *pat;
+  int len;
+  /* True if every match starts with it.  */
+  bool prefix;
+  /* The mask of the bits to ignore when comparing each of its bytes
+     with text, as returned by literal_fold_mask.  */
+  unsigned char fold[MUST_STRING_MAX];
+};
+
+static ptrdiff_t must_string_find (struct must_string const *, ptrdiff_t,
+				   ptrdiff_t, bool);
+static ptrdiff_t literal_set_forward (struct literal_set const *,
+				      ptrdiff_t, ptrdiff_t);
+static ptrdiff_t literal_set_backward (struct literal_set const *,
+				       ptrdiff_t, ptrdiff_t, ptrdiff_t);
+static struct literal_set *literal_set_new (struct re_pattern_buffer *,
+					    Lisp_Object, Lisp_Object);
+
+/* Prepare *MUST for the compiled regexp BUFP, translated by TRT whose
+   inverse is INVERSE_TRT, to look for it in the current buffer.  */
+
+static void
+must_string_init (struct must_string *must, struct re_pattern_buffer *bufp,
+		  Lisp_Object trt, Lisp_Object inverse_trt)
+{
+  /* The bytes of non-ASCII characters differ between the pattern and
+     the text unless both are multibyte or both are unibyte.  */
+  bool ascii_only = bufp->multibyte != bufp->target_multibyte;
+  int len = min (bufp->must_len, MUST_STRING_MAX);
+  int i;
+
+  must->pat = bufp->buffer + bufp->must;
+  /* Look for as many of the bytes as can be compared with text one by
+     one, since every match contains them too.  */
+  for (i = 0; i < len; i++)
+    {
+      int fold = literal_fold_mask (must->pat[i], trt, inverse_trt);
+      if (fold < 0 || (ascii_only && !ASCII_CHAR_P (must->pat[i])))
+	break;
+      must->fold[i] = fold;
+    }
+  must->len = i;
+  /* Running the regexp at each occurrence of a single byte is no faster
+     than letting re_search_2 look for them with its fastmap.  */
+  must->prefix = bufp->must_prefix && i > 1;
+}
+
+/* Return the strings one of which starts every match of the regexp
+   in the cache entry CP, translated by TRT whose inverse is
+   INVERSE_TRT, prepared for looking for them in the current buffer;
+   or return NULL if they are not worth looking for.  */
+
+static struct literal_set *
+regexp_cache_literals (struct regexp_cache *cp, Lisp_Object trt,
+		       Lisp_Object inverse_trt)
+{
+  if (!cp->literals_ready
+      || !BASE_EQ (cp->literals_inverse, inverse_trt)
+      || cp->literals_multibyte != cp->buf.target_multibyte)
+    {
+      literal_set_free (cp->literals);
+      cp->literals = NULL;
+      cp->literals_ready = false;
+      cp->literals = literal_set_new (&cp->buf, trt, inverse_trt);
+      cp->literals_inverse = inverse_trt;
+      cp->literals_multibyte = cp->buf.target_multibyte;
+      cp->literals_ready = true;
+    }
+  return cp->literals;
+}
+
+/* Search for the compiled regexp BUFP as re_search_2 does, in the
+   accessible portion of the current buffer, made of the strings P1 and
+   P2 of sizes S1 and S2, for a match between the byte positions
+   POS_BYTE and LIM_BYTE, starting as close as possible to POS_BYTE.
+   Look for the string MUST prepared for BUFP first, and run the
+   regexp only where it may match given where MUST is.  Likewise, if
+   LITERALS is non-null, run it only where one of them starts.  */
+
+static ptrdiff_t
+search_buffer_re_1 (struct re_pattern_buffer *bufp,
+                    struct must_string const *must,
+                    struct literal_set const *literals,
+                    unsigned char *p1, ptrdiff_t s1,
+                    unsigned char *p2, ptrdiff_t s2,
+                    ptrdiff_t pos_byte, ptrdiff_t lim_byte,
+                    struct re_registers *regs)
+{
+  bool forward = pos_byte <= lim_byte;
+  ptrdiff_t stop = max (pos_byte, lim_byte) - BEGV_BYTE;
+
+  if (must->len > 0)
+    {
+      ptrdiff_t at = must_string_find (must, pos_byte, lim_byte, forward);
+
+      if (must->prefix)
+        {
+          /* Every match starts with MUST, so run the regexp only
+             where it is.  */
+          for (; at >= 0;
+               at = (forward
+                     ? must_string_find (must, at + 1, lim_byte, true)
+                     : must_string_find (must, at - 1 + must->len,
+                                         lim_byte, false)))
+            {
+              re_match_object = Qnil;
+              ptrdiff_t val = re_search_2 (bufp, (char *) p1, s1,
+                                           (char *) p2, s2,
+                                           at - BEGV_BYTE, 0, regs, stop);
+              if (val != -1)
+                return val;
+            }
+          return -1;
+        }
+
+      if (at < 0)
+        return -1;
+    }
+
+  if (literals)
+    {
+      /* Every match starts with one of LITERALS.  */
+      for (ptrdiff_t at = (forward
+                           ? literal_set_forward (literals, pos_byte,
+                                                  lim_byte)
+                           : literal_set_backward (literals, pos_byte,
+                                                   lim_byte, pos_byte));
+           at >= 0;
+           at = (forward
+                 ? literal_set_forward (literals, at + 1, lim_byte)
+                 : literal_set_backward (literals, at - 1, lim_byte,
+                                         pos_byte)))
+        {
+          re_match_object = Qnil;
+          ptrdiff_t val = re_search_2 (bufp, (char *) p1, s1,
+                                       (char *) p2, s2,
+                                       at - BEGV_BYTE, 0, regs, stop);
+          if (val != -1)
+            return val;
+        }
+      return -1;
+    }
+
+  re_match_object = Qnil;
+  return re_search_2 (bufp, (char *) p1, s1, (char *) p2, s2,
+                      pos_byte - BEGV_BYTE, lim_byte - pos_byte, regs, stop);
+}
+
 static EMACS_INT
 search_buffer_re (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
                   ptrdiff_t lim, ptrdiff_t lim_byte, EMACS_INT n,
@@ -1173,6 +1707,10 @@ search_buffer_re (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
                      trt, posix,
                      !NILP (BVAR (current_buffer, enable_multibyte_characters)));
   struct re_pattern_buffer *bufp = &cache_entry->buf;
+  struct must_string must;
+  must_string_init (&must, bufp, trt, inverse_trt);
+  struct literal_set *literals
+    = regexp_cache_literals (cache_entry, trt, inverse_trt);
 
   maybe_quit ();		/* Do a pending quit right away,
 				   to avoid paradoxical behavior */
@@ -1203,12 +1741,10 @@ search_buffer_re (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
     {
       ptrdiff_t val;
 
-      re_match_object = Qnil;
-      val = re_search_2 (bufp, (char *) p1, s1, (char *) p2, s2,
-                         pos_byte - BEGV_BYTE, lim_byte - pos_byte,
-                         preserve_match_data ? &search_regs : &search_regs_1,
-                         /* Don't allow match past current point */
-                         pos_byte - BEGV_BYTE);
+      val = search_buffer_re_1 (bufp, &must, literals, p1, s1, p2, s2,
+                                pos_byte, lim_byte,
+                                preserve_match_data
+                                ? &search_regs : &search_regs_1);
       if (val == -2)
         {
           unbind_to (count, Qnil);
@@ -1250,11 +1786,10 @@ search_buffer_re (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
     {
       ptrdiff_t val;
 
-      re_match_object = Qnil;
-      val = re_search_2 (bufp, (char *) p1, s1, (char *) p2, s2,
-                         pos_byte - BEGV_BYTE, lim_byte - pos_byte,
-                         preserve_match_data ? &search_regs : &search_regs_1,
-                         lim_byte - BEGV_BYTE);
+      val = search_buffer_re_1 (bufp, &must, literals, p1, s1, p2, s2,
+                                pos_byte, lim_byte,
+                                preserve_match_data
+                                ? &search_regs : &search_regs_1);
       if (val == -2)
         {
           unbind_to (count, Qnil);
@@ -1743,6 +2278,507 @@ simple_search (EMACS_INT n, unsigned char *pat,
     return n;
 }
 
+/* Return the mask to use when comparing text with the byte C of a
+   pattern translated by TRT, whose inverse is INVERSE_TRT.  This is 0
+   if only the character C matches it, or 0x20 if only C and C ^ 0x20
+   match it, as for ASCII letters when ignoring case.  Return -1 if it
+   is neither, as for a non-ASCII byte when TRT is non-nil.  */
+
+static int
+literal_fold_mask (int c, Lisp_Object trt, Lisp_Object inverse_trt)
+{
+  int inverse, other;
+
+  if (NILP (trt))
+    return 0;
+  if (!ASCII_CHAR_P (c))
+    return -1;
+  TRANSLATE (other, inverse_trt, c);
+  if (other == c)
+    return 0;
+  TRANSLATE (inverse, inverse_trt, other);
+  return inverse == c && other == (c ^ 0x20) ? 0x20 : -1;
+}
+
+#ifdef __SSE2__
+
+/* Scanning for literal matches a block at a time.
+
+   Boyer-Moore looks at one byte of text per step, and strides over
+   the text by at most the length of the pattern, so it is slow for
+   short patterns.  Instead, boyer_moore below can look for the bytes
+   of the text that match the first and the last byte of the pattern,
+   at the right distance from each other, 16 positions at a time, and
+   only check the positions where both match.  Comparing a byte of
+   text with a byte of the pattern ignores the bits of the text in a
+   mask, so that this also works when searching ASCII letters while
+   ignoring their case.  */
+
+struct literal_ends
+{
+  /* The first and last bytes of the pattern, and the masks of the
+     bits to ignore when comparing them with text.  */
+  unsigned char first, first_fold, last, last_fold;
+};
+
+/* Set *ENDS for the pattern PAT of LEN_BYTE bytes, translated by TRT
+   whose inverse is INVERSE_TRT, and return true, if the pattern can be
+   looked for a block at a time; otherwise, return false.  */
+
+static bool
+literal_ends_init (struct literal_ends *ends, unsigned char const *pat,
+		   ptrdiff_t len_byte, Lisp_Object trt,
+		   Lisp_Object inverse_trt)
+{
+  int first_fold = literal_fold_mask (pat[0], trt, inverse_trt);
+  int last_fold = literal_fold_mask (pat[len_byte - 1], trt, inverse_trt);
+
+  /* Long patterns are fast enough with Boyer-Moore alone.  */
+  if (first_fold < 0 || last_fold < 0 || len_byte > 64)
+    return false;
+  ends->first = pat[0] | first_fold;
+  ends->first_fold = first_fold;
+  ends->last = pat[len_byte - 1] | last_fold;
+  ends->last_fold = last_fold;
+  return true;
+}
+
+/* Return the first position P between FROM and LIM inclusive such
+   that P may be the last byte of a match of a pattern whose ENDS are
+   given, and whose first byte is SPAN bytes before, or NULL if there
+   is none.  */
+
+static unsigned char *
+literal_scan_forward (unsigned char *from, unsigned char *lim,
+		      ptrdiff_t span, struct literal_ends const *ends)
+{
+  unsigned char *p = from;
+  __m128i const first = _mm_set1_epi8 (ends->first);
+  __m128i const first_fold = _mm_set1_epi8 (ends->first_fold);
+  __m128i const last = _mm_set1_epi8 (ends->last);
+  __m128i const last_fold = _mm_set1_epi8 (ends->last_fold);
+
+  for (; lim - p >= 15; p += 16)
+    {
+      __m128i l = _mm_loadu_si128 ((__m128i const *) p);
+      __m128i f = _mm_loadu_si128 ((__m128i const *) (p - span));
+      l = _mm_cmpeq_epi8 (_mm_or_si128 (l, last_fold), last);
+      f = _mm_cmpeq_epi8 (_mm_or_si128 (f, first_fold), first);
+      unsigned int mask = _mm_movemask_epi8 (_mm_and_si128 (l, f));
+      if (mask)
+	return p + stdc_trailing_zeros (mask);
+    }
+  for (; p <= lim; p++)
+    if ((*p | ends->last_fold) == ends->last
+	&& (p[-span] | ends->first_fold) == ends->first)
+      return p;
+  return NULL;
+}
+
+/* Return the last position P between LIM and FROM inclusive such that
+   P may be the first byte of a match of a pattern whose ENDS are
+   given, and whose last byte is SPAN bytes after, or NULL if there is
+   none.  */
+
+static unsigned char *
+literal_scan_backward (unsigned char *from, unsigned char *lim,
+		       ptrdiff_t span, struct literal_ends const *ends)
+{
+  unsigned char *p = from;
+  __m128i const first = _mm_set1_epi8 (ends->first);
+  __m128i const first_fold = _mm_set1_epi8 (ends->first_fold);
+  __m128i const last = _mm_set1_epi8 (ends->last);
+  __m128i const last_fold = _mm_set1_epi8 (ends->last_fold);
+
+  for (; p - lim >= 15; p -= 16)
+    {
+      __m128i f = _mm_loadu_si128 ((__m128i const *) (p - 15));
+      __m128i l = _mm_loadu_si128 ((__m128i const *) (p - 15 + span));
+      f = _mm_cmpeq_epi8 (_mm_or_si128 (f, first_fold), first);
+      l = _mm_cmpeq_epi8 (_mm_or_si128 (l, last_fold), last);
+      unsigned int mask = _mm_movemask_epi8 (_mm_and_si128 (l, f));
+      if (mask)
+	return p - 15 + (31 - stdc_leading_zeros (mask));
+    }
+  for (; p >= lim; p--)
+    if ((*p | ends->first_fold) == ends->first
+	&& (p[span] | ends->last_fold) == ends->last)
+      return p;
+  return NULL;
+}
+
+#endif	/* __SSE2__ */
+
+/* Return true if the string MUST is in the current buffer at the byte
+   position POS_BYTE.  */
+
+static bool
+must_string_at (struct must_string const *must, ptrdiff_t pos_byte)
+{
+  for (int i = 0; i < must->len; i++)
+    if ((FETCH_BYTE (pos_byte + i) | must->fold[i])
+	!= (must->pat[i] | must->fold[i]))
+      return false;
+  return true;
+}
+
+/* Like literal_scan_forward if FORWARD, or literal_scan_backward
+   otherwise, for the first and last bytes of the string MUST.  */
+
+static unsigned char *
+must_string_scan (unsigned char *from, unsigned char *lim,
+		  struct must_string const *must, bool forward)
+{
+  int span = must->len - 1;
+  unsigned char first = must->pat[0] | must->fold[0];
+  unsigned char last = must->pat[span] | must->fold[span];
+
+#ifdef __SSE2__
+  struct literal_ends ends = { first, must->fold[0], last, must->fold[span] };
+  return (forward
+	  ? literal_scan_forward (from, lim, span, &ends)
+	  : literal_scan_backward (from, lim, span, &ends));
+#else
+  if (forward)
+    {
+      for (; from <= lim; from++)
+	if ((*from | must->fold[span]) == last
+	    && (from[-span] | must->fold[0]) == first)
+	  return from;
+    }
+  else
+    {
+      for (; from >= lim; from--)
+	if ((*from | must->fold[0]) == first
+	    && (from[span] | must->fold[span]) == last)
+	  return from;
+    }
+  return NULL;
+#endif
+}
+
+/* If FORWARD, return the byte position of the first occurrence of the
+   string MUST in the current buffer that lies between the byte
+   positions FROM and LIM; otherwise, return that of the last one that
+   lies between LIM and FROM.  Return -1 if there is none.  */
+
+static ptrdiff_t
+must_string_find (struct must_string const *must, ptrdiff_t from,
+		  ptrdiff_t lim, bool forward)
+{
+  int span = must->len - 1;
+  ptrdiff_t pos = forward ? from : from - must->len;
+
+  while (forward ? pos + span < lim : pos >= lim)
+    {
+      unsigned char *base, *cursor, *limit;
+      ptrdiff_t end;
+
+      if (pos < GPT_BYTE && GPT_BYTE <= pos + span)
+	{
+	  /* An occurrence there would straddle the gap.  */
+	  if (must_string_at (must, pos))
+	    return pos;
+	  pos += forward ? 1 : -1;
+	  continue;
+	}
+
+      /* Scan the positions up to the gap or to LIM at once; BASE is
+	 the address of the byte the scan starts at, the last byte of
+	 an occurrence at POS if FORWARD, and its first otherwise.  */
+      if (forward)
+	{
+	  end = min (BUFFER_CEILING_OF (pos + span), lim - 1) - span;
+	  base = BYTE_POS_ADDR (pos + span);
+	  limit = base + (end - pos);
+	}
+      else
+	{
+	  end = max (BUFFER_FLOOR_OF (pos), lim);
+	  base = BYTE_POS_ADDR (pos);
+	  limit = base - (pos - end);
+	}
+      for (cursor = base;
+	   (cursor = must_string_scan (cursor, limit, must, forward));
+	   cursor += forward ? 1 : -1)
+	{
+	  ptrdiff_t at = pos + (cursor - base);
+	  if (must_string_at (must, at))
+	    return at;
+	}
+      pos = end + (forward ? 1 : -1);
+    }
+  return -1;
+}
+
+/* Looking for several strings at once.
+
+   When every match of a regexp starts with one of a few strings, as
+   for "\\(?:foo\\|ba[rz]\\)+", search_buffer_re_1 runs the regexp only
+   where one of them starts, which it finds with an Aho-Corasick
+   automaton that reads each byte of text once.  The automaton reads
+   classes of bytes rather than bytes, so that its table stays small:
+   each byte the strings contain has a class of its own, except that
+   the two cases of an ASCII letter share one when case is ignored,
+   and all other bytes share class 0.  */
+
+/* An Aho-Corasick automaton for a set of strings.  Its states are the
+   prefixes of the strings, state 0 being the empty one.  */
+struct literal_dfa
+{
+  /* The state after reading each class of byte in each state, at
+     STATE * NCLASSES + CLASS.  */
+  unsigned short *delta;
+  /* For each state, the length of the longest string that ends there,
+     or 0 if none does.  */
+  unsigned char *out;
+};
+
+struct literal_set
+{
+  /* The number of classes of bytes, and the class of each byte.  */
+  int nclasses;
+  unsigned short class[256];
+  /* The length of the longest string.  */
+  int maxlen;
+  /* The automata for the strings, and for the strings reversed.  */
+  struct literal_dfa forward, backward;
+};
+
+/* Fill in DFA to look for the N strings of LENS bytes at STRS, each
+   reversed if REVERSED, whose bytes are classed as in SET.  */
+
+static void
+literal_dfa_init (struct literal_dfa *dfa, struct literal_set const *set,
+		  int n, unsigned char const *lens,
+		  unsigned char (*strs)[RE_LITERAL_MAX], bool reversed)
+{
+  int ncl = set->nclasses, nstates = 1;
+
+  for (int i = 0; i < n; i++)
+    nstates += lens[i];
+  unsigned short *delta = xzalloc (nstates * ncl * sizeof *delta);
+  unsigned char *out = xzalloc (nstates);
+  unsigned short *fail = xnmalloc (nstates, sizeof *fail);
+  unsigned short *queue = xnmalloc (nstates, sizeof *queue);
+
+  /* Build the trie of the strings, where 0 means no transition since
+     no state goes back to state 0.  */
+  nstates = 1;
+  for (int i = 0; i < n; i++)
+    {
+      int s = 0;
+      for (int j = 0; j < lens[i]; j++)
+	{
+	  int c = set->class[strs[i][reversed ? lens[i] - 1 - j : j]];
+	  if (!delta[s * ncl + c])
+	    delta[s * ncl + c] = nstates++;
+	  s = delta[s * ncl + c];
+	}
+      out[s] = lens[i];
+    }
+
+  /* Visit the states breadth first, making the transitions missing
+     from each state those of its failure state, the longest proper
+     suffix of it that is a state.  */
+  int head = 0, tail = 0;
+  for (int c = 0; c < ncl; c++)
+    if (delta[c])
+      {
+	fail[delta[c]] = 0;
+	queue[tail++] = delta[c];
+      }
+  while (head < tail)
+    {
+      int r = queue[head++];
+      out[r] = max (out[r], out[fail[r]]);
+      for (int c = 0; c < ncl; c++)
+	{
+	  int s = delta[r * ncl + c];
+	  if (s)
+	    {
+	      fail[s] = delta[fail[r] * ncl + c];
+	      queue[tail++] = s;
+	    }
+	  else
+	    delta[r * ncl + c] = delta[fail[r] * ncl + c];
+	}
+    }
+
+  xfree (fail);
+  xfree (queue);
+  dfa->delta = delta;
+  dfa->out = out;
+}
+
+/* Return the strings one of which starts every match of the compiled
+   regexp BUFP, translated by TRT whose inverse is INVERSE_TRT,
+   prepared for looking for them in the current buffer.  Return NULL
+   if there are no such strings, or if they are not worth looking
+   for.  */
+
+static struct literal_set *
+literal_set_new (struct re_pattern_buffer *bufp, Lisp_Object trt,
+		 Lisp_Object inverse_trt)
+{
+  struct re_literals lits;
+  /* The bytes of non-ASCII characters differ between the pattern and
+     the text unless both are multibyte or both are unibyte.  */
+  bool ascii_only = bufp->multibyte != bufp->target_multibyte;
+  bool fold[256] = { false }, used[256] = { false };
+  int maxlen = 0;
+
+  if (!re_prefix_literals (bufp, &lits))
+    return NULL;
+  for (int i = 0; i < lits.n; i++)
+    {
+      /* Look for the bytes of each string that can be compared with
+	 text one by one, as must_string_init does.  */
+      int len;
+      for (len = 0; len < lits.len[i]; len++)
+	{
+	  int c = lits.str[i][len];
+	  int mask = literal_fold_mask (c, trt, inverse_trt);
+	  if (mask < 0 || (ascii_only && !ASCII_CHAR_P (c)))
+	    break;
+	  if (mask)
+	    fold[c] = fold[c ^ mask] = true;
+	}
+      /* Running the regexp wherever a single byte is found is no
+	 faster than letting re_search_2 use its fastmap.  */
+      if (len < 2)
+	return NULL;
+      lits.len[i] = len;
+      maxlen = max (maxlen, len);
+    }
+
+  struct literal_set *set = xmalloc (sizeof *set);
+  int id[256];
+  set->nclasses = 1;
+  for (int i = 0; i < lits.n; i++)
+    for (int j = 0; j < lits.len[i]; j++)
+      {
+	int c = lits.str[i][j];
+	used[fold[c] ? c | 0x20 : c] = true;
+      }
+  for (int c = 0; c < 256; c++)
+    id[c] = used[c] ? set->nclasses++ : 0;
+  for (int c = 0; c < 256; c++)
+    set->class[c] = id[fold[c] ? c | 0x20 : c];
+  set->maxlen = maxlen;
+  literal_dfa_init (&set->forward, set, lits.n, lits.len, lits.str, false);
+  literal_dfa_init (&set->backward, set, lits.n, lits.len, lits.str, true);
+  return set;
+}
+
+static void
+literal_set_free (struct literal_set *set)
+{
+  if (set)
+    {
+      xfree (set->forward.delta);
+      xfree (set->forward.out);
+      xfree (set->backward.delta);
+      xfree (set->backward.out);
+      xfree (set);
+    }
+}
+
+/* Return the first byte position at or after FROM in the current
+   buffer at which one of the strings of SET starts and ends by LIM, or
+   -1 if there is none.  */
+
+static ptrdiff_t
+literal_set_forward (struct literal_set const *set, ptrdiff_t from,
+		     ptrdiff_t lim)
+{
+  unsigned short const *delta = set->forward.delta;
+  unsigned char const *out = set->forward.out;
+  unsigned short const *class = set->class;
+  int ncl = set->nclasses, state = 0;
+  ptrdiff_t best = -1, stop = lim, pos = from;
+
+  /* The automaton finds the strings in the order they end, so once one
+     is found, look on for those that start before it.  */
+  while (pos < stop)
+    {
+      ptrdiff_t end = min (BUFFER_CEILING_OF (pos) + 1, stop);
+      unsigned char const *base = BYTE_POS_ADDR (pos);
+      unsigned char const *p = base, *pend = base + (end - pos);
+
+      while (p < pend)
+	{
+	  if (state == 0)
+	    {
+	      /* Skip the bytes that start no string.  */
+	      while (delta[class[*p]] == 0)
+		if (++p == pend)
+		  goto next;
+	    }
+	  state = delta[state * ncl + class[*p++]];
+	  if (out[state])
+	    {
+	      ptrdiff_t at = pos + (p - base) - out[state];
+	      if (best < 0 || at < best)
+		{
+		  best = at;
+		  /* A string that starts before BEST ends before
+		     this.  */
+		  stop = min (lim, best + set->maxlen - 1);
+		  pend = min (pend, base + (stop - pos));
+		}
+	    }
+	}
+    next:
+      pos += p - base;
+    }
+  return best;
+}
+
+/* Return the last byte position between LIM and FROM in the current
+   buffer at which one of the strings of SET starts and ends by END, or
+   -1 if there is none.  */
+
+static ptrdiff_t
+literal_set_backward (struct literal_set const *set, ptrdiff_t from,
+		      ptrdiff_t lim, ptrdiff_t end)
+{
+  unsigned short const *delta = set->backward.delta;
+  unsigned char const *out = set->backward.out;
+  unsigned short const *class = set->class;
+  int ncl = set->nclasses, state = 0;
+  ptrdiff_t pos = min (from + set->maxlen, end);
+
+  if (from < lim)
+    return -1;
+
+  /* Read the bytes before POS backward; the strings found start at the
+     byte read last.  */
+  while (pos > lim)
+    {
+      ptrdiff_t floor = max (BUFFER_FLOOR_OF (pos - 1), lim);
+      unsigned char const *base = BYTE_POS_ADDR (floor);
+      ptrdiff_t i = pos - floor;
+
+      while (i > 0)
+	{
+	  if (state == 0)
+	    {
+	      while (delta[class[base[i - 1]]] == 0)
+		if (--i == 0)
+		  goto next;
+	    }
+	  i--;
+	  state = delta[state * ncl + class[base[i]]];
+	  if (out[state] && floor + i <= from)
+	    return floor + i;
+	}
+    next:
+      pos = floor;
+    }
+  return -1;
+}
+
 /* Do Boyer-Moore search N times for the string BASE_PAT,
    whose length is LEN_BYTE,
    from buffer position POS_BYTE until LIM_BYTE.
@@ -1785,6 +2821,14 @@ boyer_moore (EMACS_INT n, unsigned char *base_pat,
   int translate_prev_byte2 = 0;
   int translate_prev_byte3 = 0;
 
+#ifdef __SSE2__
+  struct literal_ends ends = {0};
+  bool block_scan = literal_ends_init (&ends, base_pat, len_byte,
+				       trt, inverse_trt);
+#else
+  bool const block_scan = false;
+#endif
+
   /* The general approach is that we are going to maintain that we know
      the first (closest to the present position, in whatever direction
      we're searching) character that could possibly be the last
@@ -1965,6 +3009,27 @@ boyer_moore (EMACS_INT n, unsigned char *base_pat,
 	  /* In this loop, pos + cursor - p2 is the surrogate for pos.  */
 	  while (1)		/* use one cursor setting as long as i can */
 	    {
+#ifdef __SSE2__
+	      if (block_scan)
+		{
+		  /* Go straight to the next place where both ends of
+		     the pattern match.  */
+		  unsigned char *next
+		    = (direction > 0
+		       ? literal_scan_forward (cursor, p_limit, len_byte - 1,
+					       &ends)
+		       : literal_scan_backward (cursor, p_limit, len_byte - 1,
+						&ends));
+		  if (next)
+		    {
+		      cursor = next;
+		      goto hit;
+		    }
+		  if ((p_limit - cursor) * direction >= 0)
+		    cursor = p_limit + direction;
+		}
+	      else
+#endif
 	      if (direction > 0) /* worth duplicating */
 		{
 		  while (cursor <= p_limit)
@@ -3430,19 +4495,45 @@ DEFUN ("re--describe-compiled", Fre__describe_compiled, Sre__describe_compiled,
     }
 }
 
+DEFUN ("regexp-cache-statistics", Fregexp_cache_statistics,
+       Sregexp_cache_statistics, 0, 1, 0,
+       doc: /* Return statistics about the cache of compiled regexps.
+The value is a property list with these properties:
+
+ `:size'          the number of compiled regexps in the cache;
+ `:hits'          the number of times a regexp was found in the cache;
+ `:misses'        the number of times a regexp had to be compiled;
+ `:evictions'     the number of compiled regexps dropped from the cache
+                  to make room for others;
+ `:compile-time'  the time in seconds spent compiling regexps.
+
+The counts are cumulative since Emacs started, or since the last call
+to this function with a non-nil argument RESET, which resets them to
+zero after returning them.  See also `regexp-cache-size'.  */)
+  (Lisp_Object reset)
+{
+  Lisp_Object stats
+    = list (QCsize, make_int (searchbuf_count),
+	    QChits, make_int (regexp_cache_hits),
+	    QCmisses, make_int (regexp_cache_misses),
+	    QCevictions, make_int (regexp_cache_evictions),
+	    QCcompile_time,
+	    make_float (timespectod (regexp_cache_compile_time)));
+  if (!NILP (reset))
+    {
+      regexp_cache_hits = regexp_cache_misses = 0;
+      regexp_cache_evictions = 0;
+      regexp_cache_compile_time = make_timespec (0, 0);
+    }
+  return stats;
+}
+
 
 static void syms_of_search_for_pdumper (void);
 
 void
 syms_of_search (void)
 {
-  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    {
-      staticpro (&searchbufs[i].regexp);
-      staticpro (&searchbufs[i].f_whitespace_regexp);
-      staticpro (&searchbufs[i].syntax_table);
-    }
-
   /* Error condition used for failing searches.  */
   DEFSYM (Qsearch_failed, "search-failed");
 
@@ -3481,6 +4572,31 @@ syms_of_search (void)
 numbering of existing capture groups in unexpected ways.  */);
   Vsearch_spaces_regexp = Qnil;
 
+  DEFVAR_INT ("regexp-cache-size", regexp_cache_size,
+    doc: /* Maximum number of compiled regexps to keep for reuse.
+Searching for a regexp first compiles it, unless it was compiled
+recently enough to still be in the cache, which keeps the most
+recently used compiled regexps.  Modes that search for many different
+regexps again and again, for instance to fontify or to propertize
+buffers, may search faster with a larger value.  Values smaller than
+20 are treated as 20.  See `regexp-cache-statistics' to see how well
+the cache is doing.  */);
+  regexp_cache_size = 100;
+
+  DEFVAR_INT ("internal--regexp-dfa-fail-limit", regexp_dfa_fail_limit,
+    doc: /* Number of failures after which a regexp match uses a DFA.
+When the matcher fails this many times while trying to match a regexp
+at one position, it decides where the regexp matches with a
+deterministic automaton from then on, if the regexp can run on one.
+If zero, regexps that can run on a deterministic automaton always do.
+This variable is meant for debugging and testing.  */);
+  regexp_dfa_fail_limit = 1000;
+
+  DEFSYM (QChits, ":hits");
+  DEFSYM (QCmisses, ":misses");
+  DEFSYM (QCevictions, ":evictions");
+  DEFSYM (QCcompile_time, ":compile-time");
+
   DEFSYM (Qinhibit_changing_match_data, "inhibit-changing-match-data");
   DEFVAR_LISP ("inhibit-changing-match-data", Vinhibit_changing_match_data,
       doc: /* Internal use only.
@@ -3509,6 +4625,7 @@ syms_of_search (void)
   defsubr (&Sregexp_quote);
   defsubr (&Snewline_cache_check);
   defsubr (&Sre__describe_compiled);
+  defsubr (&Sregexp_cache_statistics);
 
   pdumper_do_now_and_after_load (syms_of_search_for_pdumper);
 }
@@ -3516,16 +4633,8 @@ syms_of_search (void)
 static void
 syms_of_search_for_pdumper (void)
 {
-  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    {
-      searchbufs[i].buf.allocated = 100;
-      searchbufs[i].buf.buffer = xmalloc (100);
-      searchbufs[i].buf.fastmap = searchbufs[i].fastmap;
-      searchbufs[i].regexp = Qnil;
-      searchbufs[i].f_whitespace_regexp = Qnil;
-      searchbufs[i].busy = false;
-      searchbufs[i].syntax_table = Qnil;
-      searchbufs[i].next = (i == REGEXP_CACHE_SIZE-1 ? 0 : &searchbufs[i+1]);
-    }
-  searchbuf_head = &searchbufs[0];
+  searchbuf_head = searchbuf_tail = NULL;
+  searchbuf_count = 0;
+  searchbuf_table_size = 16;
+  searchbuf_table = xzalloc (searchbuf_table_size * sizeof *searchbuf_table);
 }
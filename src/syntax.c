@@ -19,6 +19,10 @@
 
 #include <config.h>
 
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
 #include "lisp.h"
 #include "dispextern.h"
 #include "character.h"
@@ -1642,6 +1646,125 @@ DEFUN ("skip-syntax-backward", Fskip_syntax_backward, Sskip_syntax_backward, 1,
   return skip_syntaxes (0, syntax, lim);
 }
 
+#ifdef __SSE2__
+
+/* Skipping ASCII characters a block at a time.
+
+   skip_chars looks at one character of text per step.  Once it has
+   skipped a few characters, it sets up the ASCII characters it skips
+   as a few ranges of bytes, against which it can compare 16 bytes of
+   text at a time, and then skips runs of ASCII characters with the
+   functions below.  Non-ASCII bytes are in none of the ranges, so
+   skip_chars handles them one character at a time as before.  */
+
+/* skip_chars first skips this many characters one at a time.  */
+enum { SKIP_ASCII_MIN = 16 };
+
+/* The ranges of ASCII characters skipped.  */
+enum { SKIP_ASCII_RANGES_MAX = 8 };
+enum { SKIP_ASCII_UNSET = -2 };
+struct skip_ascii
+{
+  /* The number of ranges, or -1 if there are too many, or
+     SKIP_ASCII_UNSET if they were not set up yet.  */
+  int n;
+  /* For each range, its first byte minus 1 and its last byte, in each
+     of 16 bytes.  */
+  __m128i below[SKIP_ASCII_RANGES_MAX], last[SKIP_ASCII_RANGES_MAX];
+};
+
+/* Return true if *SKIP can be used to skip ASCII characters, after
+   setting it up if it was not yet.  The ASCII characters skip_chars
+   skips are those in the NCLASSES CLASSES if not NEGATE, and
+   otherwise those whose element of FASTMAP is nonzero.  */
+
+static bool
+skip_ascii_ready (struct skip_ascii *skip, char const *fastmap,
+		  int nclasses, unsigned char const *classes, bool negate)
+{
+  if (skip->n != SKIP_ASCII_UNSET)
+    return skip->n >= 0;
+
+  int n = 0;
+  for (int c = 0; c < 0200; )
+    {
+      int first;
+
+      while (c < 0200 && ! (nclasses && in_classes (c, nclasses, classes)
+			    ? !negate : fastmap[c]))
+	c++;
+      if (c == 0200)
+	break;
+      first = c;
+      while (c < 0200 && (nclasses && in_classes (c, nclasses, classes)
+			  ? !negate : fastmap[c]))
+	c++;
+      if (n == SKIP_ASCII_RANGES_MAX)
+	{
+	  n = -1;
+	  break;
+	}
+      skip->below[n] = _mm_set1_epi8 (first - 1);
+      skip->last[n] = _mm_set1_epi8 (c - 1);
+      n++;
+    }
+  skip->n = n;
+  return n >= 0;
+}
+
+/* Return a mask of the bytes of BLOCK that are in a range of SKIP.
+   These bytes are ASCII, since they compare as signed.  */
+
+static unsigned int
+skip_ascii_mask (__m128i block, struct skip_ascii const *skip)
+{
+  __m128i in = _mm_setzero_si128 ();
+  for (int i = 0; i < skip->n; i++)
+    in = _mm_or_si128 (in,
+		       _mm_andnot_si128 (_mm_cmpgt_epi8 (block, skip->last[i]),
+					 _mm_cmpgt_epi8 (block,
+							 skip->below[i])));
+  return _mm_movemask_epi8 (in);
+}
+
+/* Return the address of the first byte between P and STOP that may
+   not be skipped according to SKIP, or an address less than 16 bytes
+   before STOP if there is none.  */
+
+static unsigned char *
+skip_ascii_forward (unsigned char *p, unsigned char *stop,
+		    struct skip_ascii const *skip)
+{
+  for (; stop - p >= 16; p += 16)
+    {
+      __m128i block = _mm_loadu_si128 ((__m128i const *) p);
+      unsigned int out = ~skip_ascii_mask (block, skip) & 0xffff;
+      if (out)
+	return p + stdc_trailing_zeros (out);
+    }
+  return p;
+}
+
+/* Return the address just after the last byte between STOP and P
+   (exclusive) that may not be skipped according to SKIP, or an
+   address less than 16 bytes after STOP if there is none.  */
+
+static unsigned char *
+skip_ascii_backward (unsigned char *p, unsigned char *stop,
+		     struct skip_ascii const *skip)
+{
+  for (; p - stop >= 16; p -= 16)
+    {
+      __m128i block = _mm_loadu_si128 ((__m128i const *) (p - 16));
+      unsigned int out = ~skip_ascii_mask (block, skip) & 0xffff;
+      if (out)
+	return p - 16 + (32 - stdc_leading_zeros (out));
+    }
+  return p;
+}
+
+#endif	/* __SSE2__ */
+
 static Lisp_Object
 skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim)
 {
@@ -1922,6 +2045,10 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim)
     ptrdiff_t pos = PT;
     ptrdiff_t pos_byte = PT_BYTE;
     unsigned char *p = PT_ADDR, *endp, *stop;
+#ifdef __SSE2__
+    struct skip_ascii skip;
+    skip.n = SKIP_ASCII_UNSET;
+#endif
 
     if (forwardp)
       {
@@ -1954,6 +2081,17 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim)
 		  p = GAP_END_ADDR;
 		  stop = endp;
 		}
+#ifdef __SSE2__
+	      if (*p < 0200 && pos - start_point >= SKIP_ASCII_MIN
+		  && skip_ascii_ready (&skip, fastmap, nclasses, classes,
+				       negate))
+		{
+		  unsigned char *q = skip_ascii_forward (p, stop, &skip);
+		  pos += q - p, pos_byte += q - p, p = q;
+		  if (p >= stop)
+		    continue;
+		}
+#endif
 	      c = string_char_and_length (p, &nbytes);
 	      if (nclasses && in_classes (c, nclasses, classes))
 		{
@@ -1996,6 +2134,17 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim)
 		  stop = endp;
 		}
 
+#ifdef __SSE2__
+	      if (*p < 0200 && pos - start_point >= SKIP_ASCII_MIN
+		  && skip_ascii_ready (&skip, fastmap, nclasses, classes,
+				       negate))
+		{
+		  unsigned char *q = skip_ascii_forward (p, stop, &skip);
+		  pos += q - p, pos_byte += q - p, p = q;
+		  if (p >= stop)
+		    continue;
+		}
+#endif
 	      if (nclasses && in_classes (*p, nclasses, classes))
 		{
 		  if (negate)
@@ -2023,6 +2172,17 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim)
 		  p = GPT_ADDR;
 		  stop = endp;
 		}
+#ifdef __SSE2__
+	      if (p[-1] < 0200 && start_point - pos >= SKIP_ASCII_MIN
+		  && skip_ascii_ready (&skip, fastmap, nclasses, classes,
+				       negate))
+		{
+		  unsigned char *q = skip_ascii_backward (p, stop, &skip);
+		  pos -= p - q, pos_byte -= p - q, p = q;
+		  if (p <= stop)
+		    continue;
+		}
+#endif
 	      unsigned char *prev_p = p;
 	      do
 		p--;
@@ -2064,6 +2224,17 @@ skip_chars (bool forwardp, Lisp_Object string, Lisp_Object lim)
 		  stop = endp;
 		}
 
+#ifdef __SSE2__
+	      if (p[-1] < 0200 && start_point - pos >= SKIP_ASCII_MIN
+		  && skip_ascii_ready (&skip, fastmap, nclasses, classes,
+				       negate))
+		{
+		  unsigned char *q = skip_ascii_backward (p, stop, &skip);
+		  pos -= p - q, pos_byte -= p - q, p = q;
+		  if (p <= stop)
+		    continue;
+		}
+#endif
 	      if (nclasses && in_classes (p[-1], nclasses, classes))
 		{
 		  if (negate)
@@ -2260,6 +2431,92 @@ in_classes (int c, int nclasses, const unsigned char *classes)
   return false;
 }
 
+/* The syntax codes and flags of the ASCII characters in a syntax
+   table, looked up as they are needed.  forw_comment and scan_lists
+   use them to skip runs of ASCII characters that do not concern them
+   with one array lookup per character, rather than fetching each
+   character and looking it up in the char-table.  */
+
+struct ascii_syntax
+{
+  /* The syntax table, or nil if none yet.  */
+  Lisp_Object table;
+
+  /* The syntax of each ASCII character, or -1 if not looked up yet.  */
+  int syntax[128];
+};
+
+/* Prepare ASCII for the syntax table in gl_state, which must be good
+   for FROM, and return the position at or before STOP up to which the
+   characters from FROM, whose byte position is FROM_BYTE, are
+   contiguous and have their syntax in that table.  Return FROM if they
+   have the syntax of a syntax-table property instead.  */
+
+static ptrdiff_t
+ascii_syntax_run_end (struct ascii_syntax *ascii,
+		      ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t stop)
+{
+  if (gl_state.use_global)
+    return from;
+  if (!EQ (ascii->table, gl_state.current_syntax_table))
+    {
+      ascii->table = gl_state.current_syntax_table;
+      memset (ascii->syntax, -1, sizeof ascii->syntax);
+    }
+  if (parse_sexp_lookup_properties)
+    stop = min (stop, gl_state.e_property);
+  if (from_byte < GPT_BYTE)
+    stop = min (stop, from + (GPT_BYTE - from_byte));
+  return stop;
+}
+
+/* Return the syntax code and flags of the ASCII character C in the
+   syntax table ASCII was last prepared for.  */
+
+static int
+ascii_syntax_ref (struct ascii_syntax *ascii, int c)
+{
+  int syntax = ascii->syntax[c];
+  if (syntax < 0)
+    syntax = ascii->syntax[c] = SYNTAX_WITH_FLAGS (c);
+  return syntax;
+}
+
+/* Skip forward over the ASCII characters from *FROM and *FROM_BYTE,
+   but not past STOP, whose syntax codes are not in the set STOP_CODES
+   of bits (1 << CODE), and, if COMMENT, that do not begin
+   two-character comment delimiters.  If there are any, store the
+   syntax of the last one into *SYNTAX and return true.  */
+
+static bool
+skip_ascii_syntax (struct ascii_syntax *ascii, ptrdiff_t *from,
+		   ptrdiff_t *from_byte, ptrdiff_t stop, int stop_codes,
+		   bool comment, int *syntax)
+{
+  ptrdiff_t pos = *from;
+  ptrdiff_t end = ascii_syntax_run_end (ascii, pos, *from_byte, stop);
+  unsigned char const *p = BYTE_POS_ADDR (*from_byte);
+  int last = *syntax;
+
+  for (; pos < end && ASCII_CHAR_P (*p); pos++, p++)
+    {
+      int s = ascii_syntax_ref (ascii, *p);
+      if ((s & 0xff) >= Smax || stop_codes & (1 << (s & 0xff))
+	  || (comment && (SYNTAX_FLAGS_COMSTART_FIRST (s)
+			  || SYNTAX_FLAGS_COMEND_FIRST (s))))
+	break;
+      last = s;
+      rarely_quit (pos);
+    }
+
+  if (pos == *from)
+    return false;
+  *from_byte += pos - *from;
+  *from = pos;
+  *syntax = last;
+  return true;
+}
+
 /* Jump over a comment, assuming we are at the beginning of one.
    FROM is the current position.
    FROM_BYTE is the bytepos corresponding to FROM.
@@ -2285,6 +2542,9 @@ in_classes (int c, int nclasses, const unsigned char *classes)
    The comment end is the last character of the comment rather than the
    character just after the comment.
 
+   ASCII is where the caller keeps the syntax of ASCII characters
+   between calls.
+
    Global syntax data is assumed to initially be valid for FROM and
    remains valid for forward search starting at the returned position. */
 
@@ -2292,7 +2552,8 @@ in_classes (int c, int nclasses, const unsigned char *classes)
 forw_comment (ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t stop,
 	      EMACS_INT nesting, int style, int prev_syntax,
 	      ptrdiff_t *charpos_ptr, ptrdiff_t *bytepos_ptr,
-	      EMACS_INT *incomment_ptr, int *last_syntax_ptr)
+	      EMACS_INT *incomment_ptr, int *last_syntax_ptr,
+	      struct ascii_syntax *ascii)
 {
   unsigned short int quit_count = 0;
   int c, c1;
@@ -2309,6 +2570,15 @@ forw_comment (ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t stop,
 
   while (1)
     {
+      if (skip_ascii_syntax (ascii, &from, &from_byte, stop,
+			     ((1 << Sendcomment) | (1 << Scomment)
+			      | (1 << Scomment_fence) | (1 << Sescape)
+			      | (1 << Scharquote)),
+			     true, &syntax))
+	{
+	  code = syntax & 0xff;
+	  UPDATE_SYNTAX_TABLE_FORWARD (from);
+	}
       if (from == stop)
 	{
 	  *incomment_ptr = nesting;
@@ -2433,6 +2703,7 @@ DEFUN ("forward-comment", Fforward_comment, Sforward_comment, 1, 1, 0,
   EMACS_INT dummy;
   int dummy2;
   unsigned short int quit_count = 0;
+  struct ascii_syntax ascii = { .table = Qnil };
 
   CHECK_FIXNUM (count);
   count1 = XFIXNUM (count);
@@ -2492,7 +2763,8 @@ DEFUN ("forward-comment", Fforward_comment, Sforward_comment, 1, 1, 0,
 	}
       /* We're at the start of a comment.  */
       found = forw_comment (from, from_byte, stop, comnested, comstyle, 0,
-			    &out_charpos, &out_bytepos, &dummy, &dummy2);
+			    &out_charpos, &out_bytepos, &dummy, &dummy2,
+			    &ascii);
       from = out_charpos; from_byte = out_bytepos;
       if (!found)
 	{
@@ -2633,6 +2905,84 @@ syntax_multibyte (int c, bool multibyte_symbol_p)
   return ASCII_CHAR_P (c) || !multibyte_symbol_p ? SYNTAX (c) : Ssymbol;
 }
 
+/* Skip forward over the ASCII characters from *FROM and *FROM_BYTE,
+   but not past STOP, that scan_lists passes over without looking
+   further: whitespace, punctuation, expression prefixes, parentheses,
+   and, unless SEXPFLAG and at depth zero, words and symbols.  Keep
+   track of the depth in *DEPTH and update *LAST_GOOD as scan_lists
+   does, and signal an error if the depth gets less than MIN_DEPTH.
+   Return true if it gets to zero, after the parenthesis that got it
+   there.  */
+
+static bool
+scan_lists_ascii (struct ascii_syntax *ascii, ptrdiff_t *from,
+		  ptrdiff_t *from_byte, ptrdiff_t stop, bool sexpflag,
+		  EMACS_INT *depth, EMACS_INT min_depth, EMACS_INT *last_good)
+{
+  ptrdiff_t pos = *from;
+  ptrdiff_t end = ascii_syntax_run_end (ascii, pos, *from_byte, stop);
+  unsigned char const *p = BYTE_POS_ADDR (*from_byte);
+  EMACS_INT d = *depth;
+  bool zero = false;
+
+  for (; pos < end && ASCII_CHAR_P (*p); pos++, p++)
+    {
+      int syntax = ascii_syntax_ref (ascii, *p);
+      if (SYNTAX_FLAGS_COMSTART_FIRST (syntax))
+	break;
+      if (d == min_depth)
+	*last_good = pos;
+      rarely_quit (pos);
+      if (SYNTAX_FLAGS_PREFIX (syntax))
+	continue;
+      switch (syntax & 0xff)
+	{
+	case Swhitespace:
+	case Spunct:
+	case Squote:
+	case Sendcomment:
+	  break;
+
+	case Sword:
+	case Ssymbol:
+	  if (!d && sexpflag)
+	    goto done;
+	  break;
+
+	case Sopen:
+	  if (!++d)
+	    {
+	      zero = true;
+	      pos++;
+	      goto done;
+	    }
+	  break;
+
+	case Sclose:
+	  if (!--d)
+	    {
+	      zero = true;
+	      pos++;
+	      goto done;
+	    }
+	  if (d < min_depth)
+	    xsignal3 (Qscan_error,
+		      build_string ("Containing expression ends prematurely"),
+		      make_fixnum (*last_good), make_fixnum (pos + 1));
+	  break;
+
+	default:
+	  goto done;
+	}
+    }
+
+ done:
+  *from_byte += pos - *from;
+  *from = pos;
+  *depth = d;
+  return zero;
+}
+
 static Lisp_Object
 scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 {
@@ -2655,6 +3005,7 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
   int dummy2;
   bool multibyte_symbol_p = sexpflag && multibyte_syntax_as_symbol;
   unsigned short int quit_count = 0;
+  struct ascii_syntax ascii = { .table = Qnil };
 
   if (depth > 0) min_depth = 0;
 
@@ -2673,6 +3024,12 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 	  bool comstart_first, prefix;
 	  int syntax, other_syntax;
 	  UPDATE_SYNTAX_TABLE_FORWARD (from);
+	  if (scan_lists_ascii (&ascii, &from, &from_byte, stop, sexpflag,
+				&depth, min_depth, &last_good))
+	    goto done;
+	  if (from == stop)
+	    break;
+	  UPDATE_SYNTAX_TABLE_FORWARD (from);
 	  c = FETCH_CHAR_AS_MULTIBYTE (from_byte);
 	  syntax = SYNTAX_WITH_FLAGS (c);
 	  code = syntax_multibyte (c, multibyte_symbol_p);
@@ -2752,7 +3109,7 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 	      found = forw_comment (from, from_byte, stop,
 				    comnested, comstyle, 0,
 				    &out_charpos, &out_bytepos, &dummy,
-                                    &dummy2);
+                                    &dummy2, &ascii);
 	      from = out_charpos, from_byte = out_bytepos;
 	      if (!found)
 		{
@@ -2801,6 +3158,15 @@ scan_lists (EMACS_INT from0, EMACS_INT count, EMACS_INT depth, bool sexpflag)
 		  if (from >= stop)
 		    goto lose;
 		  UPDATE_SYNTAX_TABLE_FORWARD (from);
+		  if (skip_ascii_syntax (&ascii, &from, &from_byte, stop,
+					 ((1 << Sstring) | (1 << Sstring_fence)
+					  | (1 << Sescape) | (1 << Scharquote)),
+					 false, &dummy2))
+		    {
+		      if (from >= stop)
+			goto lose;
+		      UPDATE_SYNTAX_TABLE_FORWARD (from);
+		    }
 		  c = FETCH_CHAR_AS_MULTIBYTE (from_byte);
 		  c_code = syntax_multibyte (c, multibyte_symbol_p);
 		  if (code == Sstring
@@ -3179,6 +3545,7 @@ scan_sexps_forward (struct lisp_parse_state *state,
   int temp;
   unsigned short int quit_count = 0;
   ptrdiff_t started_from = from;
+  struct ascii_syntax ascii = { .table = Qnil };
 
   prev_from = from;
   prev_from_byte = from_byte;
@@ -3335,7 +3702,7 @@ #define INC_FROM				\
 				state->incomment, state->comstyle,
 				from == BEGV ? 0 : prev_from_syntax,
 				&out_charpos, &out_bytepos, &state->incomment,
-                                &prev_from_syntax);
+                                &prev_from_syntax, &ascii);
 	  from = out_charpos; from_byte = out_bytepos;
 	  /* Beware!  prev_from and friends (except prev_from_syntax)
 	     are invalid now.  Luckily, the `done' doesn't use them
@@ -3397,6 +3764,19 @@ #define INC_FROM				\
 		enum syntaxcode c_code;
 
 		if (from >= end) goto done;
+		/* Skip the characters that cannot end the string,
+		   updating prev_from and prev_from_syntax as INC_FROM
+		   would.  prev_prev_from_syntax is not needed here.  */
+		if (skip_ascii_syntax (&ascii, &from, &from_byte, end,
+				       ((1 << Sstring) | (1 << Sstring_fence)
+					| (1 << Sescape) | (1 << Scharquote)),
+				       false, &prev_from_syntax))
+		  {
+		    prev_from = from - 1;
+		    prev_from_byte = from_byte - 1;
+		    if (from >= end) goto done;
+		    UPDATE_SYNTAX_TABLE_FORWARD (from);
+		  }
 		c = FETCH_CHAR_AS_MULTIBYTE (from_byte);
 		c_code = SYNTAX (c);
 
@@ -3541,6 +3921,41 @@ internalize_parse_state (Lisp_Object external, struct lisp_parse_state *state)
     }
 }
 
+/* Convert an internal parse state to the list that
+   parse-partial-sexp returns.  */
+static Lisp_Object
+externalize_parse_state (struct lisp_parse_state *state)
+{
+  return
+    Fcons (make_fixnum (state->depth),
+	   Fcons (state->prevlevelstart < 0
+		  ? Qnil : make_fixnum (state->prevlevelstart),
+	     Fcons (state->thislevelstart < 0
+		    ? Qnil : make_fixnum (state->thislevelstart),
+	       Fcons (state->instring >= 0
+		      ? (state->instring == ST_STRING_STYLE
+			 ? Qt : make_fixnum (state->instring)) : Qnil,
+		 Fcons (state->incomment < 0 ? Qt :
+			(state->incomment == 0 ? Qnil :
+			 make_fixnum (state->incomment)),
+		   Fcons (state->quoted ? Qt : Qnil,
+		     Fcons (make_fixnum (state->mindepth),
+		       Fcons ((state->comstyle
+			       ? (state->comstyle == ST_COMMENT_STYLE
+				  ? Qsyntax_table
+				  : make_fixnum (state->comstyle))
+			       : Qnil),
+		         Fcons (((state->incomment
+                                  || (state->instring >= 0))
+                                 ? make_fixnum (state->comstr_start)
+                                 : Qnil),
+			   Fcons (state->levelstarts,
+                             Fcons (state->prev_syntax == Smax
+                                    ? Qnil
+                                    : make_fixnum (state->prev_syntax),
+                                Qnil)))))))))));
+}
+
 DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
        doc: /* Parse Lisp syntax starting at FROM until TO; return status of parse at TO.
 Parsing stops at TO or when certain criteria are met;
@@ -3607,34 +4022,226 @@ DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
 
   SET_PT_BOTH (state.location, state.location_byte);
 
-  return
-    Fcons (make_fixnum (state.depth),
-	   Fcons (state.prevlevelstart < 0
-		  ? Qnil : make_fixnum (state.prevlevelstart),
-	     Fcons (state.thislevelstart < 0
-		    ? Qnil : make_fixnum (state.thislevelstart),
-	       Fcons (state.instring >= 0
-		      ? (state.instring == ST_STRING_STYLE
-			 ? Qt : make_fixnum (state.instring)) : Qnil,
-		 Fcons (state.incomment < 0 ? Qt :
-			(state.incomment == 0 ? Qnil :
-			 make_fixnum (state.incomment)),
-		   Fcons (state.quoted ? Qt : Qnil,
-		     Fcons (make_fixnum (state.mindepth),
-		       Fcons ((state.comstyle
-			       ? (state.comstyle == ST_COMMENT_STYLE
-				  ? Qsyntax_table
-				  : make_fixnum (state.comstyle))
-			       : Qnil),
-		         Fcons (((state.incomment
-                                  || (state.instring >= 0))
-                                 ? make_fixnum (state.comstr_start)
-                                 : Qnil),
-			   Fcons (state.levelstarts,
-                             Fcons (state.prev_syntax == Smax
-                                    ? Qnil
-                                    : make_fixnum (state.prev_syntax),
-                                Qnil)))))))))));
+  return externalize_parse_state (&state);
+}
+
+/* Caching the states of the parse from the beginning of a buffer.
+
+   syntax-ppss needs the state of the parse from the beginning of the
+   buffer to arbitrary positions, which takes scan_sexps_forward a
+   time proportional to the position.  So a buffer can remember the
+   states at every SYNTAX_PPSS_INTERVAL characters from its beginning,
+   from which the state at any position is found by scanning fewer
+   than SYNTAX_PPSS_INTERVAL characters.  The states are computed
+   lazily, up to the positions asked for.  Since the state at a
+   position depends only on the text before it, modifying the text
+   discards only the states after the modification, which the buffer
+   modification primitives do through invalidate_buffer_caches.  */
+
+enum { SYNTAX_PPSS_INTERVAL = 4096 };
+
+struct syntax_ppss_cache
+{
+  /* The syntax table, and the values of the variables, that the
+     states were computed with.  */
+  Lisp_Object syntax_table;
+  bool_bf lookup_properties : 1;
+  bool_bf escaped_comment_ends : 1;
+
+  /* Incremented whenever states are discarded.  */
+  unsigned int generation;
+
+  /* The states at BEG, BEG + SYNTAX_PPSS_INTERVAL, and so on.  */
+  struct lisp_parse_state *states;
+  ptrdiff_t nstates, states_size;
+
+  /* The state last computed, or one whose location is -1.  */
+  struct lisp_parse_state last;
+};
+
+void
+free_syntax_ppss_cache (struct buffer *buf)
+{
+  struct syntax_ppss_cache *cache = buf->syntax_ppss_cache;
+
+  if (cache)
+    {
+      xfree (cache->states);
+      xfree (cache);
+      buf->syntax_ppss_cache = NULL;
+    }
+}
+
+/* Discard the states of the cache of BUF after position START, if
+   BUF has such a cache.  */
+
+void
+invalidate_syntax_ppss_cache (struct buffer *buf, ptrdiff_t start)
+{
+  if (buf->base_buffer)
+    buf = buf->base_buffer;
+  struct syntax_ppss_cache *cache = buf->syntax_ppss_cache;
+
+  if (cache)
+    {
+      ptrdiff_t valid
+	= (max (start, BUF_BEG (buf)) - BUF_BEG (buf)) / SYNTAX_PPSS_INTERVAL;
+      cache->nstates = min (cache->nstates, valid + 1);
+      if (cache->last.location > start)
+	cache->last.location = -1;
+      cache->generation++;
+    }
+}
+
+void
+mark_syntax_ppss_cache (struct buffer *buf)
+{
+  struct syntax_ppss_cache *cache = buf->syntax_ppss_cache;
+
+  if (cache)
+    {
+      mark_object (cache->syntax_table);
+      for (ptrdiff_t i = 0; i < cache->nstates; i++)
+	mark_object (cache->states[i].levelstarts);
+      mark_object (cache->last.levelstarts);
+    }
+}
+
+/* Return the cache of the states of the parse in the current buffer,
+   creating it if needed.  Empty it if it was computed with another
+   syntax than the current one.  */
+
+static struct syntax_ppss_cache *
+syntax_ppss_cache (void)
+{
+  struct buffer *b = (current_buffer->base_buffer
+		      ? current_buffer->base_buffer : current_buffer);
+  struct syntax_ppss_cache *cache = b->syntax_ppss_cache;
+
+  if (!cache)
+    {
+      cache = b->syntax_ppss_cache = xzalloc (sizeof *cache);
+      cache->syntax_table = Qnil;
+      cache->last.levelstarts = Qnil;
+    }
+
+  if (!EQ (cache->syntax_table, BVAR (current_buffer, syntax_table))
+      || cache->lookup_properties != parse_sexp_lookup_properties
+      || cache->escaped_comment_ends != comment_end_can_be_escaped)
+    {
+      cache->syntax_table = BVAR (current_buffer, syntax_table);
+      cache->lookup_properties = parse_sexp_lookup_properties;
+      cache->escaped_comment_ends = comment_end_can_be_escaped;
+      if (!cache->states)
+	cache->states = xpalloc (NULL, &cache->states_size, 1, -1,
+				 sizeof *cache->states);
+      struct lisp_parse_state *state = &cache->states[0];
+      internalize_parse_state (Qnil, state);
+      state->mindepth = 0;
+      state->thislevelstart = state->prevlevelstart = -1;
+      state->location = BEG;
+      state->location_byte = BEG_BYTE;
+      cache->nstates = 1;
+      cache->last.location = -1;
+      cache->generation++;
+    }
+
+  return cache;
+}
+
+/* Store in STATE the state of the parse from BEGV to POS, which must
+   be accessible.  Use and fill the cache of the current buffer unless
+   it is narrowed.  */
+
+static void
+syntax_ppss (ptrdiff_t pos, struct lisp_parse_state *state)
+{
+  if (BEGV != BEG)
+    {
+      internalize_parse_state (Qnil, state);
+      scan_sexps_forward (state, BEGV, BEGV_BYTE, pos,
+			  TYPE_MINIMUM (EMACS_INT), false, 0);
+      return;
+    }
+
+  /* Compute the missing states up to POS.  Scanning can run Lisp code
+     (see parse_sexp_propertize), which can discard states, so only
+     record a new state if none were discarded meanwhile.  */
+  ptrdiff_t i = (pos - BEG) / SYNTAX_PPSS_INTERVAL;
+  struct syntax_ppss_cache *cache;
+  while ((cache = syntax_ppss_cache ())->nstates <= i)
+    {
+      ptrdiff_t n = cache->nstates;
+      unsigned int generation = cache->generation;
+      *state = cache->states[n - 1];
+      scan_sexps_forward (state, state->location, state->location_byte,
+			  state->location + SYNTAX_PPSS_INTERVAL,
+			  TYPE_MINIMUM (EMACS_INT), false, 0);
+      cache = syntax_ppss_cache ();
+      if (cache->generation == generation && cache->nstates == n)
+	{
+	  if (n == cache->states_size)
+	    cache->states = xpalloc (cache->states, &cache->states_size, 1, -1,
+				     sizeof *cache->states);
+	  eassert (state->location == BEG + n * SYNTAX_PPSS_INTERVAL);
+	  cache->states[n] = *state;
+	  cache->nstates = n + 1;
+	}
+    }
+
+  /* Scan from that state, or from the one last computed if it is
+     closer.  */
+  unsigned int generation = cache->generation;
+  *state = cache->states[i];
+  if (cache->last.location >= state->location
+      && cache->last.location <= pos)
+    *state = cache->last;
+  scan_sexps_forward (state, state->location, state->location_byte, pos,
+		      TYPE_MINIMUM (EMACS_INT), false, 0);
+  cache = syntax_ppss_cache ();
+  if (cache->generation == generation)
+    cache->last = *state;
+
+  /* Don't let the caller modify the list remembered as the last.  */
+  state->levelstarts = Fcopy_sequence (state->levelstarts);
+}
+
+DEFUN ("internal--syntax-ppss", Finternal__syntax_ppss,
+       Sinternal__syntax_ppss, 1, 1, 0,
+       doc: /* Return the state of the parse from `point-min' to POS.
+The value is that of `parse-partial-sexp' from `point-min' to POS, except
+that its elements 2 and 6 cannot be relied upon.  Point is moved to POS.
+
+Unless the buffer is narrowed, the value is computed from the states at
+positions a few thousand characters apart, which are remembered until
+the text before them or its `syntax-table' properties are modified, the
+syntax table or the value of
+`parse-sexp-lookup-properties' or `comment-end-can-be-escaped' changes,
+or `internal--syntax-ppss-flush' is called.
+
+This is the primitive behind `syntax-ppss', which see.  */)
+  (Lisp_Object pos)
+{
+  EMACS_INT charpos = fix_position (pos);
+  if (! (BEGV <= charpos && charpos <= ZV))
+    args_out_of_range_3 (pos, make_fixnum (BEGV), make_fixnum (ZV));
+
+  struct lisp_parse_state state;
+  syntax_ppss (charpos, &state);
+  SET_PT_BOTH (state.location, state.location_byte);
+  return externalize_parse_state (&state);
+}
+
+DEFUN ("internal--syntax-ppss-flush", Finternal__syntax_ppss_flush,
+       Sinternal__syntax_ppss_flush, 1, 1, 0,
+       doc: /* Forget the states `internal--syntax-ppss' remembers after BEG.
+This is needed when the syntax of the text after BEG changes without
+the text changing, other than through changes of its `syntax-table'
+properties.  */)
+  (Lisp_Object beg)
+{
+  invalidate_syntax_ppss_cache (current_buffer, fix_position (beg));
+  return Qnil;
 }
 
 void
@@ -3820,4 +4427,6 @@ syms_of_syntax (void)
   defsubr (&Sscan_sexps);
   defsubr (&Sbackward_prefix_chars);
   defsubr (&Sparse_partial_sexp);
+  defsubr (&Sinternal__syntax_ppss);
+  defsubr (&Sinternal__syntax_ppss_flush);
 }
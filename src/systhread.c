@@ -17,9 +17,11 @@ Copyright (C) 2012-2024 Free Software Foundation, Inc.
 along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 
 #include <config.h>
+#include <errno.h>
 #include <setjmp.h>
 #include <stdio.h>
 #include <string.h>
+#include <timespec.h>
 #include "lisp.h"
 
 #ifdef HAVE_NS
@@ -59,6 +61,13 @@ sys_cond_wait (sys_cond_t *c, sys_mutex_t *m)
 {
 }
 
+bool
+sys_cond_timedwait (sys_cond_t *c, sys_mutex_t *m,
+		    struct timespec const *deadline)
+{
+  return false;
+}
+
 void
 sys_cond_signal (sys_cond_t *c)
 {
@@ -167,6 +176,18 @@ sys_cond_wait (sys_cond_t *cond, sys_mutex_t *mutex)
   eassert (error == 0);
 }
 
+/* Like sys_cond_wait, but give up at DEADLINE, a time of the system
+   clock.  Return false if the wait timed out.  */
+
+bool
+sys_cond_timedwait (sys_cond_t *cond, sys_mutex_t *mutex,
+		    struct timespec const *deadline)
+{
+  int error = pthread_cond_timedwait (cond, mutex, deadline);
+  eassert (error == 0 || error == ETIMEDOUT);
+  return error != ETIMEDOUT;
+}
+
 void
 sys_cond_signal (sys_cond_t *cond)
 {
@@ -316,14 +337,14 @@ sys_cond_init (sys_cond_t *cond)
   cond->initialized = true;
 }
 
-void
-sys_cond_wait (sys_cond_t *cond, sys_mutex_t *mutex)
+static bool
+w32_cond_wait (sys_cond_t *cond, sys_mutex_t *mutex, DWORD timeout)
 {
   DWORD wait_result;
   bool last_thread_waiting;
 
   if (!cond->initialized)
-    return;
+    return true;
 
   /* Increment the wait count avoiding race conditions.  */
   EnterCriticalSection ((LPCRITICAL_SECTION)&cond->wait_count_lock);
@@ -333,7 +354,7 @@ sys_cond_wait (sys_cond_t *cond, sys_mutex_t *mutex)
   /* Release the mutex and wait for either the signal or the broadcast
      event.  */
   LeaveCriticalSection ((LPCRITICAL_SECTION)mutex);
-  wait_result = WaitForMultipleObjects (2, cond->events, FALSE, INFINITE);
+  wait_result = WaitForMultipleObjects (2, cond->events, FALSE, timeout);
 
   /* Decrement the wait count and see if we are the last thread
      waiting on the condition variable.  */
@@ -351,6 +372,26 @@ sys_cond_wait (sys_cond_t *cond, sys_mutex_t *mutex)
 
   /* Per the API, re-acquire the mutex.  */
   EnterCriticalSection ((LPCRITICAL_SECTION)mutex);
+
+  return wait_result != WAIT_TIMEOUT;
+}
+
+void
+sys_cond_wait (sys_cond_t *cond, sys_mutex_t *mutex)
+{
+  w32_cond_wait (cond, mutex, INFINITE);
+}
+
+bool
+sys_cond_timedwait (sys_cond_t *cond, sys_mutex_t *mutex,
+		    struct timespec const *deadline)
+{
+  struct timespec delay = timespec_sub (*deadline, current_timespec ());
+  DWORD timeout = 0;
+  if (timespec_sign (delay) > 0)
+    timeout = min (delay.tv_sec * 1000 + delay.tv_nsec / 1000000,
+		   INFINITE - 1);
+  return w32_cond_wait (cond, mutex, timeout);
 }
 
 void
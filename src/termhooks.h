@@ -253,6 +253,10 @@ #define EMACS_TERMHOOKS_H
   , THREAD_EVENT
 #endif
 
+  /* Generated when a job of the worker pool finishes, if its future
+     has a callback.  Member `arg' is a list of the future.  */
+  , ASYNC_EVENT
+
   , CONFIG_CHANGED_EVENT
 
 #ifdef HAVE_NTGUI
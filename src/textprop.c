@@ -72,10 +72,12 @@ text_read_only (Lisp_Object propval)
   xsignal0 (Qtext_read_only);
 }
 
-/* Prepare to modify the text properties of BUFFER from START to END.  */
+/* Prepare to modify the text properties of BUFFER from START to END.
+   SYNTAX means the syntax-table property may change.  */
 
 static void
-modify_text_properties (Lisp_Object buffer, Lisp_Object start, Lisp_Object end)
+modify_text_properties (Lisp_Object buffer, Lisp_Object start, Lisp_Object end,
+			bool syntax)
 {
   ptrdiff_t b = XFIXNUM (start), e = XFIXNUM (end);
   struct buffer *buf = XBUFFER (buffer), *old = current_buffer;
@@ -83,6 +85,8 @@ modify_text_properties (Lisp_Object buffer, Lisp_Object start, Lisp_Object end)
   set_buffer_internal (buf);
 
   prepare_to_modify_buffer_1 (b, e, NULL);
+  if (syntax)
+    invalidate_syntax_ppss_cache (buf, b);
 
   BUF_COMPUTE_UNCHANGED (buf, b - 1, e);
   if (MODIFF <= SAVE_MODIFF)
@@ -1233,7 +1237,8 @@ add_text_properties_1 (Lisp_Object start, Lisp_Object end,
       ptrdiff_t prev_total_length = TOTAL_LENGTH (i);
       ptrdiff_t prev_pos = i->position;
 
-      modify_text_properties (object, start, end);
+      modify_text_properties (object, start, end,
+			      !NILP (plist_member (properties, Qsyntax_table)));
       /* If someone called us recursively as a side effect of
 	 modify_text_properties, and changed the intervals behind our back
 	 (could happen if lock_file, called by prepare_to_modify_buffer,
@@ -1440,7 +1445,7 @@ set_text_properties (Lisp_Object start, Lisp_Object end, Lisp_Object properties,
       ptrdiff_t prev_length = LENGTH (i);
       ptrdiff_t prev_pos = i->position;
 
-      modify_text_properties (object, start, end);
+      modify_text_properties (object, start, end, true);
       /* If someone called us recursively as a side effect of
 	 modify_text_properties, and changed the intervals behind our
 	 back, we cannot continue with I, because its data changed.
@@ -1623,7 +1628,8 @@ DEFUN ("remove-text-properties", Fremove_text_properties,
       ptrdiff_t prev_total_length = TOTAL_LENGTH (i);
       ptrdiff_t prev_pos = i->position;
 
-      modify_text_properties (object, start, end);
+      modify_text_properties (object, start, end,
+			      !NILP (plist_member (properties, Qsyntax_table)));
       /* If someone called us recursively as a side effect of
 	 modify_text_properties, and changed the intervals behind our back
 	 (could happen if lock_file, called by prepare_to_modify_buffer,
@@ -1709,6 +1715,7 @@ DEFUN ("remove-list-of-text-properties", Fremove_list_of_text_properties,
   bool modified = false;
   Lisp_Object properties;
   properties = list_of_properties;
+  bool syntax = !NILP (Fmemq (Qsyntax_table, properties));
 
   if (NILP (object))
     XSETBUFFER (object, current_buffer);
@@ -1772,7 +1779,7 @@ DEFUN ("remove-list-of-text-properties", Fremove_list_of_text_properties,
 	  else if (LENGTH (i) == len)
 	    {
 	      if (!modified && BUFFERP (object))
-		modify_text_properties (object, start, end);
+		modify_text_properties (object, start, end, syntax);
 	      remove_properties (Qnil, properties, i, object);
 	      if (BUFFERP (object))
 		signal_after_change (XFIXNUM (start), XFIXNUM (end) - XFIXNUM (start),
@@ -1785,7 +1792,7 @@ DEFUN ("remove-list-of-text-properties", Fremove_list_of_text_properties,
 	      i = split_interval_left (i, len);
 	      copy_properties (unchanged, i);
 	      if (!modified && BUFFERP (object))
-		modify_text_properties (object, start, end);
+		modify_text_properties (object, start, end, syntax);
 	      remove_properties (Qnil, properties, i, object);
 	      if (BUFFERP (object))
 		signal_after_change (XFIXNUM (start), XFIXNUM (end) - XFIXNUM (start),
@@ -1796,7 +1803,7 @@ DEFUN ("remove-list-of-text-properties", Fremove_list_of_text_properties,
       if (interval_has_some_properties_list (properties, i))
 	{
 	  if (!modified && BUFFERP (object))
-	    modify_text_properties (object, start, end);
+	    modify_text_properties (object, start, end, syntax);
 	  remove_properties (Qnil, properties, i, object);
 	  modified = true;
 	}
@@ -18,7 +18,13 @@ Copyright (C) 2012-2024 Free Software Foundation, Inc.
 
 
 #include <config.h>
+#include <fcntl.h>
 #include <setjmp.h>
+#include <unistd.h>
+
+#include <ignore-value.h>
+#include <nproc.h>
+
 #include "lisp.h"
 #include "character.h"
 #include "buffer.h"
@@ -27,6 +33,7 @@ Copyright (C) 2012-2024 Free Software Foundation, Inc.
 #include "syssignal.h"
 #include "pdumper.h"
 #include "keyboard.h"
+#include "systime.h"
 
 #ifdef HAVE_NS
 #include "nsterm.h"
@@ -161,6 +168,34 @@ acquire_global_lock (struct thread_state *self)
   post_acquire_global_lock (self);
 }
 
+/* Set *DEADLINE to TIMEOUT seconds from now, and return DEADLINE.
+   If TIMEOUT is nil, meaning to wait as long as it takes, return
+   NULL.  */
+static struct timespec *
+wait_deadline (Lisp_Object timeout, struct timespec *deadline)
+{
+  if (NILP (timeout))
+    return NULL;
+  CHECK_NUMBER (timeout);
+  *deadline = timespec_add (current_timespec (),
+			    dtotimespec (XFLOATINT (timeout)));
+  return deadline;
+}
+
+/* Wait for COND like sys_cond_wait with the global lock, but give up
+   at DEADLINE unless it is NULL.  Return false if the wait timed
+   out.  */
+static bool
+wait_global_cond (sys_cond_t *cond, struct timespec const *deadline)
+{
+  if (!deadline)
+    {
+      sys_cond_wait (cond, &global_lock);
+      return true;
+    }
+  return sys_cond_timedwait (cond, &global_lock, deadline);
+}
+
 /* This is called from keyboard.c when it detects that SIGINT was
    delivered to the main thread and interrupted thread_select before
    the main thread could acquire the lock.  We must acquire the lock
@@ -442,10 +477,19 @@ DEFUN ("make-condition-variable",
   return result;
 }
 
+/* Used to communicate arguments to condition_wait_callback.  */
+struct wait_args
+{
+  struct Lisp_CondVar *cvar;
+  struct timespec *deadline;
+  bool notified;
+};
+
 static void
 condition_wait_callback (void *arg)
 {
-  struct Lisp_CondVar *cvar = arg;
+  struct wait_args *wa = arg;
+  struct Lisp_CondVar *cvar = wa->cvar;
   struct Lisp_Mutex *mutex = XMUTEX (cvar->mutex);
   struct thread_state *self = current_thread;
   unsigned int saved_count;
@@ -459,7 +503,7 @@ condition_wait_callback (void *arg)
     {
       self->wait_condvar = &cvar->cond;
       /* This call could switch to another thread.  */
-      sys_cond_wait (&cvar->cond, &global_lock);
+      wa->notified = wait_global_cond (&cvar->cond, wa->deadline);
       self->wait_condvar = NULL;
     }
   self->event_object = Qnil;
@@ -475,7 +519,7 @@ condition_wait_callback (void *arg)
   post_acquire_global_lock (self);
 }
 
-DEFUN ("condition-wait", Fcondition_wait, Scondition_wait, 1, 1, 0,
+DEFUN ("condition-wait", Fcondition_wait, Scondition_wait, 1, 2, 0,
        doc: /* Wait for the condition variable COND to be notified.
 COND is the condition variable to wait on.
 
@@ -485,11 +529,16 @@ DEFUN ("condition-wait", Fcondition_wait, Scondition_wait, 1, 1, 0,
 This releases the mutex and waits for COND to be notified or for
 this thread to be signaled with `thread-signal'.  When
 `condition-wait' returns, COND's mutex will again be locked by
-this thread.  */)
-  (Lisp_Object cond)
+this thread.
+
+If TIMEOUT is non-nil, it is a number of seconds after which to stop
+waiting.  Return nil if the wait timed out, t otherwise.  */)
+  (Lisp_Object cond, Lisp_Object timeout)
 {
   struct Lisp_CondVar *cvar;
   struct Lisp_Mutex *mutex;
+  struct timespec deadline;
+  struct wait_args args;
 
   CHECK_CONDVAR (cond);
   cvar = XCONDVAR (cond);
@@ -498,9 +547,12 @@ DEFUN ("condition-wait", Fcondition_wait, Scondition_wait, 1, 1, 0,
   if (!lisp_mutex_owned_p (&mutex->mutex))
     error ("Condition variable's mutex is not held by current thread");
 
-  flush_stack_call_func (condition_wait_callback, cvar);
+  args.cvar = cvar;
+  args.deadline = wait_deadline (timeout, &deadline);
+  args.notified = true;
+  flush_stack_call_func (condition_wait_callback, &args);
 
-  return Qnil;
+  return args.notified ? Qt : Qnil;
 }
 
 /* Used to communicate arguments to condition_notify_callback.  */
@@ -597,6 +649,174 @@ finalize_one_condvar (struct Lisp_CondVar *condvar)
 
 
 
+DEFUN ("make-channel", Fmake_channel, Smake_channel, 1, 2, 0,
+       doc: /* Make a channel that holds up to CAPACITY values.
+A channel passes values between threads.  `channel-send' adds a value
+to it, waiting while it is full, and `channel-receive' takes out the
+oldest value, waiting while it is empty.  Any number of threads can
+send to and receive from the same channel.
+
+CAPACITY is a positive integer.
+NAME, if given, is the name of this channel.  The name is
+informational only.  */)
+  (Lisp_Object capacity, Lisp_Object name)
+{
+  CHECK_FIXNAT (capacity);
+  if (XFIXNAT (capacity) == 0)
+    args_out_of_range (capacity, Qnil);
+  if (!NILP (name))
+    CHECK_STRING (name);
+
+  struct Lisp_Channel *chan
+    = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Channel, values,
+				    PVEC_CHANNEL);
+  chan->name = name;
+  chan->values = make_nil_vector (XFIXNAT (capacity));
+  sys_cond_init (&chan->not_empty);
+  sys_cond_init (&chan->not_full);
+
+  Lisp_Object result;
+  XSETCHANNEL (result, chan);
+  return result;
+}
+
+/* Used to communicate arguments to channel_wait_callback.  */
+struct channel_wait_args
+{
+  struct Lisp_Channel *chan;
+  bool send;
+  struct timespec *deadline;
+};
+
+static bool
+channel_ready_p (struct Lisp_Channel *chan, bool send)
+{
+  return (chan->closed
+	  || (send ? chan->count < ASIZE (chan->values) : chan->count > 0));
+}
+
+static void
+channel_wait_callback (void *arg)
+{
+  struct channel_wait_args *ca = arg;
+  struct Lisp_Channel *chan = ca->chan;
+  struct thread_state *self = current_thread;
+
+  XSETCHANNEL (self->event_object, chan);
+  self->wait_condvar = ca->send ? &chan->not_full : &chan->not_empty;
+  while (!channel_ready_p (chan, ca->send) && NILP (self->error_symbol)
+	 && wait_global_cond (self->wait_condvar, ca->deadline))
+    continue;
+
+  self->wait_condvar = NULL;
+  self->event_object = Qnil;
+  post_acquire_global_lock (self);
+}
+
+/* Wait until CHAN can be sent to if SEND, or received from otherwise,
+   or until DEADLINE unless it is NULL.  */
+static void
+channel_wait (struct Lisp_Channel *chan, bool send,
+	      struct timespec *deadline)
+{
+  if (!channel_ready_p (chan, send))
+    {
+      struct channel_wait_args args = { chan, send, deadline };
+      flush_stack_call_func (channel_wait_callback, &args);
+    }
+}
+
+DEFUN ("channel-send", Fchannel_send, Schannel_send, 2, 3, 0,
+       doc: /* Send VALUE to CHANNEL.
+If CHANNEL is full, this waits until another thread receives a value
+from it, or until the current thread is signaled with `thread-signal'.
+
+If TIMEOUT is non-nil, it is a number of seconds after which to stop
+waiting.  Return t if VALUE was sent, nil if the wait timed out.
+Signal an error if CHANNEL is closed.  */)
+  (Lisp_Object channel, Lisp_Object value, Lisp_Object timeout)
+{
+  struct timespec deadline;
+
+  CHECK_CHANNEL (channel);
+  struct Lisp_Channel *chan = XCHANNEL (channel);
+
+  channel_wait (chan, true, wait_deadline (timeout, &deadline));
+  if (chan->closed)
+    error ("Channel is closed");
+  ptrdiff_t capacity = ASIZE (chan->values);
+  if (chan->count == capacity)
+    return Qnil;
+
+  ASET (chan->values, (chan->head + chan->count) % capacity, value);
+  chan->count++;
+  sys_cond_broadcast (&chan->not_empty);
+  return Qt;
+}
+
+DEFUN ("channel-receive", Fchannel_receive, Schannel_receive, 1, 3, 0,
+       doc: /* Receive the oldest value sent to CHANNEL.
+If CHANNEL is empty, this waits until another thread sends a value to
+it, or closes it, or until the current thread is signaled with
+`thread-signal'.
+
+If TIMEOUT is non-nil, it is a number of seconds after which to stop
+waiting.  If the wait times out, or CHANNEL is closed and empty,
+return DEFAULT.  */)
+  (Lisp_Object channel, Lisp_Object timeout, Lisp_Object dflt)
+{
+  struct timespec deadline;
+
+  CHECK_CHANNEL (channel);
+  struct Lisp_Channel *chan = XCHANNEL (channel);
+
+  channel_wait (chan, false, wait_deadline (timeout, &deadline));
+  if (chan->count == 0)
+    return dflt;
+
+  Lisp_Object value = AREF (chan->values, chan->head);
+  ASET (chan->values, chan->head, Qnil);
+  chan->head = (chan->head + 1) % ASIZE (chan->values);
+  chan->count--;
+  sys_cond_broadcast (&chan->not_full);
+  return value;
+}
+
+DEFUN ("channel-close", Fchannel_close, Schannel_close, 1, 1, 0,
+       doc: /* Close CHANNEL.
+Sending to a closed channel signals an error.  Receiving from it
+returns the values sent before it was closed, and then the DEFAULT
+argument of `channel-receive'.  Threads waiting on CHANNEL stop
+waiting.  */)
+  (Lisp_Object channel)
+{
+  CHECK_CHANNEL (channel);
+  struct Lisp_Channel *chan = XCHANNEL (channel);
+
+  chan->closed = true;
+  sys_cond_broadcast (&chan->not_empty);
+  sys_cond_broadcast (&chan->not_full);
+  return Qnil;
+}
+
+DEFUN ("channel-name", Fchannel_name, Schannel_name, 1, 1, 0,
+       doc: /* Return the name of CHANNEL.
+If no name was given when CHANNEL was created, return nil.  */)
+  (Lisp_Object channel)
+{
+  CHECK_CHANNEL (channel);
+  return XCHANNEL (channel)->name;
+}
+
+void
+finalize_one_channel (struct Lisp_Channel *chan)
+{
+  sys_cond_destroy (&chan->not_empty);
+  sys_cond_destroy (&chan->not_full);
+}
+
+
+
 struct select_args
 {
   select_func *func;
@@ -657,6 +877,370 @@ thread_select (select_func *func, int max_fds, fd_set *rfds,
   return sa.result;
 }
 
+struct unlocked_args
+{
+  void (*func) (void *);
+  void *arg;
+};
+
+static void
+really_call_without_lock (void *arg)
+{
+  struct unlocked_args *ua = arg;
+  struct thread_state *self = current_thread;
+  sigset_t oldset;
+
+  /* Keep SIGINT blocked throughout, as its handler in the main thread
+     would take the global lock from whichever thread holds it; see
+     maybe_reacquire_global_lock.  */
+  block_interrupt_signal (&oldset);
+  self->not_holding_lock = 1;
+  release_global_lock ();
+
+  ua->func (ua->arg);
+
+  acquire_global_lock (self);
+  self->not_holding_lock = 0;
+  restore_signal_mask (&oldset);
+}
+
+/* Call FUNC with ARG without holding the global lock, so that other
+   Lisp threads run meanwhile.  FUNC must not use any Lisp object or
+   per-thread state, nor memory that Lisp code or a garbage collection
+   could change or free, such as the data of strings and buffers; it
+   must not signal or quit either.  Use this to run long computations
+   on private copies of Lisp data.  */
+
+void
+thread_call_without_lock (void (*func) (void *), void *arg)
+{
+  struct unlocked_args ua = { func, arg };
+  flush_stack_call_func (really_call_without_lock, &ua);
+}
+
+/* The pool of worker threads that run async jobs.  Jobs move from
+   async_queue to async_running to async_done, under async_mutex; the
+   global lock is not needed for that.  A worker that finishes a job
+   writes a byte to async_pipe, whose callback resolves the futures of
+   the done jobs in whichever thread is waiting for input.  */
+
+enum { ASYNC_MAX_WORKERS = 4 };
+
+static sys_mutex_t async_mutex;
+static sys_cond_t async_queue_cond;
+static sys_cond_t async_done_cond;
+static struct async_job *async_queue, *async_queue_tail;
+static struct async_job *async_running;
+static struct async_job *async_done;
+
+/* The futures of jobs that are not yet resolved.  */
+static Lisp_Object async_futures;
+
+static EMACS_INT async_next_id;
+
+#if defined THREADS_ENABLED && !defined WINDOWSNT
+
+static int async_workers, async_idle_workers;
+
+/* The pipe through which workers wake up the main loop, and whether
+   it is open.  It is opened along with the first worker.  */
+static int async_pipe[2];
+static bool async_pipe_open;
+
+static void *
+async_worker (void *arg)
+{
+  sys_thread_set_name ("emacs-async");
+  sys_mutex_lock (&async_mutex);
+
+  while (true)
+    {
+      async_idle_workers++;
+      while (!async_queue)
+	sys_cond_wait (&async_queue_cond, &async_mutex);
+      async_idle_workers--;
+
+      struct async_job *job = async_queue;
+      async_queue = job->next;
+      job->next = async_running;
+      async_running = job;
+      sys_mutex_unlock (&async_mutex);
+
+      job->run (job);
+
+      sys_mutex_lock (&async_mutex);
+      struct async_job **p = &async_running;
+      while (*p != job)
+	p = &(*p)->next;
+      *p = job->next;
+      job->next = async_done;
+      async_done = job;
+      sys_cond_broadcast (&async_done_cond);
+
+      /* If the pipe is full, a wakeup is already pending.  */
+      ignore_value (write (async_pipe[1], "", 1));
+    }
+
+  return NULL;
+}
+
+static void async_callback (int, void *);
+
+/* Start another worker if all of them are busy.  Return false if there
+   is none and none can be started.  Call this with async_mutex
+   held.  */
+
+static bool
+async_start_worker (void)
+{
+  if (async_idle_workers > 0)
+    return true;
+
+  if (!async_pipe_open)
+    {
+      if (emacs_pipe (async_pipe) != 0)
+	return false;
+      fcntl (async_pipe[0], F_SETFL, O_NONBLOCK);
+      fcntl (async_pipe[1], F_SETFL, O_NONBLOCK);
+      add_read_fd (async_pipe[0], async_callback, NULL);
+      async_pipe_open = true;
+    }
+
+  if (async_workers < min (ASYNC_MAX_WORKERS,
+			   num_processors (NPROC_CURRENT_OVERRIDABLE)))
+    {
+      sys_thread_t thr;
+      if (sys_thread_create (&thr, async_worker, NULL))
+	async_workers++;
+    }
+
+  /* Without any worker, the pipe is of no use.  Close it, so that the
+     next attempt starts afresh rather than opening another one.  */
+  if (async_workers == 0)
+    {
+      delete_read_fd (async_pipe[0]);
+      emacs_close (async_pipe[0]);
+      emacs_close (async_pipe[1]);
+      async_pipe_open = false;
+      return false;
+    }
+  return true;
+}
+
+#else
+
+static bool
+async_start_worker (void)
+{
+  return false;
+}
+
+#endif
+
+static Lisp_Object
+async_finish (Lisp_Object job)
+{
+  struct async_job *j = xmint_pointer (job);
+  return j->finish (j);
+}
+
+/* True if the last call of async_finish signaled an error.  */
+static bool async_finish_failed;
+
+static Lisp_Object
+async_finish_error (Lisp_Object error)
+{
+  async_finish_failed = true;
+  return error;
+}
+
+/* Resolve the futures of the done jobs, and for those that have a
+   callback, store an async-event to call it.  */
+
+static void
+async_deliver (void)
+{
+  while (true)
+    {
+      sys_mutex_lock (&async_mutex);
+      struct async_job *job = async_done;
+      sys_mutex_unlock (&async_mutex);
+      if (!job)
+	break;
+
+      Lisp_Object future = Qnil;
+      for (Lisp_Object tail = async_futures; CONSP (tail); tail = XCDR (tail))
+	if (XASYNC_FUTURE (XCAR (tail))->id == job->id)
+	  {
+	    future = XCAR (tail);
+	    break;
+	  }
+      eassert (!NILP (future));
+      struct Lisp_Async_Future *f = XASYNC_FUTURE (future);
+
+      /* This may signal, so do it while JOB is still in async_done.  */
+      Lisp_Object arg = make_mint_ptr (job);
+
+      /* Workers may have pushed jobs in front of JOB meanwhile.  */
+      sys_mutex_lock (&async_mutex);
+      struct async_job **p = &async_done;
+      while (*p != job)
+	p = &(*p)->next;
+      *p = job->next;
+      sys_mutex_unlock (&async_mutex);
+      async_futures = Fdelq (future, async_futures);
+
+      /* The job is gone once this returns, even if it signals; keep
+	 the error in the future then, so that it is still resolved.  */
+      async_finish_failed = false;
+      Lisp_Object result = internal_condition_case_1 (async_finish, arg, Qt,
+						      async_finish_error);
+      if (async_finish_failed)
+	f->error = result;
+      else
+	f->result = result;
+      f->done = true;
+
+      if (!NILP (f->callback))
+	{
+	  struct input_event event;
+	  EVENT_INIT (event);
+	  event.kind = ASYNC_EVENT;
+	  event.frame_or_window = Qnil;
+	  event.arg = list2 (future, f->callback);
+	  kbd_buffer_store_event (&event);
+	}
+    }
+}
+
+#if defined THREADS_ENABLED && !defined WINDOWSNT
+
+static void
+async_callback (int fd, void *data)
+{
+  char buf[64];
+  while (0 < read (fd, buf, sizeof buf))
+    continue;
+  async_deliver ();
+}
+
+#endif
+
+/* Return a new async-future, for the result of a job to be passed to
+   async_submit.  When the future is resolved, call CALLBACK with the
+   result from the command loop, unless CALLBACK is nil.  This may
+   signal an error, so call it before allocating the job.  */
+
+Lisp_Object
+async_make_future (Lisp_Object callback)
+{
+  struct Lisp_Async_Future *f
+    = ALLOCATE_PSEUDOVECTOR (struct Lisp_Async_Future, callback,
+			     PVEC_ASYNC_FUTURE);
+  f->result = Qnil;
+  f->error = Qnil;
+  f->callback = callback;
+  f->id = async_next_id++;
+  f->done = false;
+
+  Lisp_Object future;
+  XSETASYNC_FUTURE (future, f);
+  async_futures = Fcons (future, async_futures);
+  return future;
+}
+
+/* Run JOB in a worker thread, and resolve FUTURE, which
+   async_make_future returned, with its result.  If there is no worker
+   thread, run JOB right away.  JOB belongs to the pool from now on,
+   even if this signals an error.  */
+
+void
+async_submit (struct async_job *job, Lisp_Object future)
+{
+  job->id = XASYNC_FUTURE (future)->id;
+  job->next = NULL;
+
+  sys_mutex_lock (&async_mutex);
+  bool started = async_start_worker ();
+  if (started)
+    {
+      if (async_queue)
+	async_queue_tail->next = job;
+      else
+	async_queue = job;
+      async_queue_tail = job;
+      sys_cond_signal (&async_queue_cond);
+    }
+  sys_mutex_unlock (&async_mutex);
+
+  if (!started)
+    {
+      job->run (job);
+      sys_mutex_lock (&async_mutex);
+      job->next = async_done;
+      async_done = job;
+      sys_mutex_unlock (&async_mutex);
+      async_deliver ();
+    }
+}
+
+/* Return true if the job with ID is queued or running.  */
+
+static bool
+async_pending_p (EMACS_INT id)
+{
+  for (struct async_job *job = async_queue; job; job = job->next)
+    if (job->id == id)
+      return true;
+  for (struct async_job *job = async_running; job; job = job->next)
+    if (job->id == id)
+      return true;
+  return false;
+}
+
+static void
+async_wait_unlocked (void *arg)
+{
+  EMACS_INT id = *(EMACS_INT *) arg;
+  sys_mutex_lock (&async_mutex);
+  while (async_pending_p (id))
+    sys_cond_wait (&async_done_cond, &async_mutex);
+  sys_mutex_unlock (&async_mutex);
+}
+
+DEFUN ("async-done-p", Fasync_done_p, Sasync_done_p, 1, 1, 0,
+       doc: /* Return non-nil if the job of FUTURE has finished.
+FUTURE is a value returned by an async function such as
+`async-secure-hash'.  */)
+  (Lisp_Object future)
+{
+  CHECK_ASYNC_FUTURE (future);
+  async_deliver ();
+  return XASYNC_FUTURE (future)->done ? Qt : Qnil;
+}
+
+DEFUN ("async-wait", Fasync_wait, Sasync_wait, 1, 1, 0,
+       doc: /* Wait for the job of FUTURE to finish, and return its result.
+FUTURE is a value returned by an async function such as
+`async-secure-hash'.  Other threads run while this waits, but the wait
+cannot be interrupted by quitting.  If finishing the job signaled an
+error, signal that error again.  */)
+  (Lisp_Object future)
+{
+  CHECK_ASYNC_FUTURE (future);
+  struct Lisp_Async_Future *f = XASYNC_FUTURE (future);
+  if (!f->done)
+    {
+      EMACS_INT id = f->id;
+      thread_call_without_lock (async_wait_unlocked, &id);
+      async_deliver ();
+    }
+  eassert (f->done);
+  if (!NILP (f->error))
+    xsignal (XCAR (f->error), XCDR (f->error));
+  return f->result;
+}
+
 
 
 static void
@@ -683,6 +1267,13 @@ mark_one_thread (struct thread_state *thread)
       mark_object (tem);
     }
 
+  if (thread->m_coalesced_hooks.buffer)
+    {
+      Lisp_Object tem;
+      XSETBUFFER (tem, thread->m_coalesced_hooks.buffer);
+      mark_object (tem);
+    }
+
   mark_bytecode (&thread->bc);
 
   /* No need to mark Lisp_Object members like m_last_thing_searched,
@@ -1044,33 +1635,47 @@ DEFUN ("thread--blocker", Fthread_blocker, Sthread_blocker, 1, 1, 0,
   return tstate->event_object;
 }
 
+/* Used to communicate arguments to thread_join_callback.  */
+struct join_args
+{
+  struct thread_state *tstate;
+  struct timespec *deadline;
+};
+
 static void
 thread_join_callback (void *arg)
 {
-  struct thread_state *tstate = arg;
+  struct join_args *ja = arg;
+  struct thread_state *tstate = ja->tstate;
   struct thread_state *self = current_thread;
   Lisp_Object thread;
 
   XSETTHREAD (thread, tstate);
   self->event_object = thread;
   self->wait_condvar = &tstate->thread_condvar;
-  while (thread_live_p (tstate) && NILP (self->error_symbol))
-    sys_cond_wait (self->wait_condvar, &global_lock);
+  while (thread_live_p (tstate) && NILP (self->error_symbol)
+	 && wait_global_cond (self->wait_condvar, ja->deadline))
+    continue;
 
   self->wait_condvar = NULL;
   self->event_object = Qnil;
   post_acquire_global_lock (self);
 }
 
-DEFUN ("thread-join", Fthread_join, Sthread_join, 1, 1, 0,
+DEFUN ("thread-join", Fthread_join, Sthread_join, 1, 2, 0,
        doc: /* Wait for THREAD to exit.
 This blocks the current thread until THREAD exits or until the current
 thread is signaled.  It returns the result of the THREAD function.  It
-is an error for a thread to try to join itself.  */)
-  (Lisp_Object thread)
+is an error for a thread to try to join itself.
+
+If TIMEOUT is non-nil, it is a number of seconds after which to stop
+waiting.  If THREAD has not exited by then, return nil; use
+`thread-live-p' to tell that apart from a nil result.  */)
+  (Lisp_Object thread, Lisp_Object timeout)
 {
   struct thread_state *tstate;
   Lisp_Object error_symbol, error_data;
+  struct timespec deadline;
 
   CHECK_THREAD (thread);
   tstate = XTHREAD (thread);
@@ -1082,7 +1687,12 @@ DEFUN ("thread-join", Fthread_join, Sthread_join, 1, 1, 0,
   error_data = tstate->error_data;
 
   if (thread_live_p (tstate))
-    flush_stack_call_func (thread_join_callback, tstate);
+    {
+      struct join_args args = { tstate, wait_deadline (timeout, &deadline) };
+      flush_stack_call_func (thread_join_callback, &args);
+      if (thread_live_p (tstate))
+	return Qnil;
+    }
 
   if (!NILP (error_symbol))
     Fsignal (error_symbol, error_data);
@@ -1172,6 +1782,10 @@ init_threads (void)
 
   main_thread.s.thread_id = sys_thread_self ();
   init_bc_thread (&main_thread.s.bc);
+
+  sys_mutex_init (&async_mutex);
+  sys_cond_init (&async_queue_cond);
+  sys_cond_init (&async_done_cond);
 }
 
 void
@@ -1199,6 +1813,11 @@ syms_of_threads (void)
       defsubr (&Scondition_notify);
       defsubr (&Scondition_mutex);
       defsubr (&Scondition_name);
+      defsubr (&Smake_channel);
+      defsubr (&Schannel_send);
+      defsubr (&Schannel_receive);
+      defsubr (&Schannel_close);
+      defsubr (&Schannel_name);
       defsubr (&Sthread_last_error);
 
       staticpro (&last_thread_error);
@@ -1210,6 +1829,14 @@ syms_of_threads (void)
   DEFSYM (Qthreadp, "threadp");
   DEFSYM (Qmutexp, "mutexp");
   DEFSYM (Qcondition_variable_p, "condition-variable-p");
+  DEFSYM (Qchannelp, "channelp");
+  DEFSYM (Qasync_future_p, "async-future-p");
+
+  defsubr (&Sasync_done_p);
+  defsubr (&Sasync_wait);
+
+  staticpro (&async_futures);
+  async_futures = Qnil;
 
   DEFVAR_LISP ("main-thread", Vmain_thread,
     doc: /* The main thread of Emacs.  */);
@@ -59,6 +59,24 @@ #define THREAD_H
   char *stack_end;
 };
 
+/* The state of the coalescing of change hooks.  See
+   `internal--with-coalesced-change-hooks' in insdel.c.  */
+struct coalesced_hooks_state
+{
+  /* The buffer whose change hooks are coalesced, or NULL.  */
+  struct buffer *buffer;
+
+  /* Whether the change hooks run before a change, and the function
+     undo-auto--undoable-change, have been run since coalescing began.  */
+  bool before_run, undoable;
+
+  /* The number of chars before and after the text changed since
+     coalescing began, and the number of chars inserted (negative for a
+     deletion), as in combine_after_change_list.  BEG is PTRDIFF_MAX if
+     nothing has changed.  */
+  ptrdiff_t beg, end, change;
+};
+
 struct thread_state
 {
   union vectorlike_header header;
@@ -210,6 +228,18 @@ #define getcjmp (current_thread->m_getcjmp)
      It must do so ASAP.  */
   int not_holding_lock;
 
+  /* Chains of free conses and floats that only this thread allocates
+     from, so that it need not take them from the shared free lists
+     one at a time.  See "Allocation buffers" in alloc.c.  */
+  struct Lisp_Cons *cons_buffer;
+  struct Lisp_Float *float_buffer;
+
+  /* Which buffer's change hooks this thread is coalescing, if any.
+     Each thread has its own, so that the changes other threads make
+     meanwhile do not count as its own.  */
+  struct coalesced_hooks_state m_coalesced_hooks;
+#define coalesced_hooks (current_thread->m_coalesced_hooks)
+
   /* Threads are kept on a linked list.  */
   struct thread_state *next_thread;
 
@@ -316,12 +346,98 @@ XCONDVAR (Lisp_Object a)
   return XUNTAG (a, Lisp_Vectorlike, struct Lisp_CondVar);
 }
 
+/* A channel.  */
+struct Lisp_Channel
+{
+  union vectorlike_header header;
+
+  /* The name of the channel, or nil.  */
+  Lisp_Object name;
+
+  /* A vector of the values sent and not yet received.  They are the
+     COUNT elements starting at HEAD, wrapping around at the end.  */
+  Lisp_Object values;
+
+  ptrdiff_t head, count;
+
+  /* True if the channel is closed.  */
+  bool closed;
+
+  /* Broadcast when a value is sent or the channel is closed.  */
+  sys_cond_t not_empty;
+
+  /* Broadcast when a value is received or the channel is closed.  */
+  sys_cond_t not_full;
+} GCALIGNED_STRUCT;
+
+INLINE bool
+CHANNELP (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_CHANNEL);
+}
+
+INLINE void
+CHECK_CHANNEL (Lisp_Object x)
+{
+  CHECK_TYPE (CHANNELP (x), Qchannelp, x);
+}
+
+INLINE struct Lisp_Channel *
+XCHANNEL (Lisp_Object a)
+{
+  eassert (CHANNELP (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Channel);
+}
+
+/* A future, for the result of an async job.  */
+struct Lisp_Async_Future
+{
+  union vectorlike_header header;
+
+  /* The result of the job, once it is done.  */
+  Lisp_Object result;
+
+  /* The error that finishing the job signaled, as (ERROR-SYMBOL
+     . DATA), or nil.  */
+  Lisp_Object error;
+
+  /* The function to call with the result from the command loop, or
+     nil.  */
+  Lisp_Object callback;
+
+  /* The ID of the job, which identifies the future to thread.c.  */
+  EMACS_INT id;
+
+  /* True once the job is done.  */
+  bool done;
+} GCALIGNED_STRUCT;
+
+INLINE bool
+ASYNC_FUTUREP (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_ASYNC_FUTURE);
+}
+
+INLINE void
+CHECK_ASYNC_FUTURE (Lisp_Object x)
+{
+  CHECK_TYPE (ASYNC_FUTUREP (x), Qasync_future_p, x);
+}
+
+INLINE struct Lisp_Async_Future *
+XASYNC_FUTURE (Lisp_Object a)
+{
+  eassert (ASYNC_FUTUREP (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Async_Future);
+}
+
 extern struct thread_state *current_thread;
 extern struct thread_state *all_threads;
 
 extern void finalize_one_thread (struct thread_state *state);
 extern void finalize_one_mutex (struct Lisp_Mutex *);
 extern void finalize_one_condvar (struct Lisp_CondVar *);
+extern void finalize_one_channel (struct Lisp_Channel *);
 extern void maybe_reacquire_global_lock (void);
 
 extern void init_threads (void);
@@ -338,6 +454,30 @@ XCONDVAR (Lisp_Object a)
 
 bool thread_check_current_buffer (struct buffer *);
 
+void thread_call_without_lock (void (*) (void *), void *);
+
+/* A job for the pool of worker threads.  Embed it at the start of a
+   structure holding the job's input and output.  */
+struct async_job
+{
+  /* Do the work.  This is called in a worker thread without the global
+     lock, with the restrictions of thread_call_without_lock.  */
+  void (*run) (struct async_job *);
+
+  /* Return the result of the job as a Lisp object, and free the job.
+     This is called with the global lock held once RUN has returned.
+     If it signals an error, it must still have freed the job, and
+     the future of the job then holds the error.  */
+  Lisp_Object (*finish) (struct async_job *);
+
+  /* The rest is private to thread.c.  */
+  EMACS_INT id;
+  struct async_job *next;
+};
+
+Lisp_Object async_make_future (Lisp_Object);
+void async_submit (struct async_job *, Lisp_Object);
+
 INLINE_HEADER_END
 
 #endif /* THREAD_H */
@@ -1770,7 +1770,7 @@ window_point (struct window *w)
 {
   return (w == XWINDOW (selected_window)
           ? BUF_PT (XBUFFER (w->contents))
-          : XMARKER (w->pointm)->charpos);
+          : marker_charpos (XMARKER (w->pointm)));
 }
 
 DEFUN ("window-point", Fwindow_point, Swindow_point, 0, 1, 0,
@@ -3282,7 +3282,7 @@ window_pixel_to_total (Lisp_Object frame, Lisp_Object horizontal)
 static Lisp_Object
 window_discard_buffer_from_alist (Lisp_Object buffer, Lisp_Object alist)
 {
-  Lisp_Object tail, *prev = &alist;
+  Lisp_Object tail, prev = Qnil;
 
   for (tail = alist; CONSP (tail); tail = XCDR (tail))
     {
@@ -3290,10 +3290,12 @@ window_discard_buffer_from_alist (Lisp_Object buffer, Lisp_Object alist)
 
       tem = XCAR (tem);
 
-      if (EQ (tem, buffer))
-	*prev = XCDR (tail);
+      if (!EQ (tem, buffer))
+	prev = tail;
+      else if (NILP (prev))
+	alist = XCDR (tail);
       else
-	prev = xcdr_addr (tail);
+	XSETCDR (prev, XCDR (tail));
     }
 
   return alist;
@@ -3304,13 +3306,15 @@ window_discard_buffer_from_alist (Lisp_Object buffer, Lisp_Object alist)
 static Lisp_Object
 window_discard_buffer_from_list (Lisp_Object buffer, Lisp_Object list)
 {
-  Lisp_Object tail, *prev = &list;
+  Lisp_Object tail, prev = Qnil;
 
   for (tail = list; CONSP (tail); tail = XCDR (tail))
-    if (EQ (XCAR (tail), buffer))
-      *prev = XCDR (tail);
+    if (!EQ (XCAR (tail), buffer))
+      prev = tail;
+    else if (NILP (prev))
+      list = XCDR (tail);
     else
-      prev = xcdr_addr (tail);
+      XSETCDR (prev, XCDR (tail));
 
   return list;
 }
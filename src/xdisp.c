@@ -493,6 +493,7 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 #include "intervals.h"
 #include "coding.h"
 #include "region-cache.h"
+#include "line-index.h"
 #include "font.h"
 #include "fontset.h"
 #include "blockinput.h"
@@ -29116,6 +29117,43 @@ display_count_lines (ptrdiff_t start_byte,
     = (!NILP (BVAR (current_buffer, selective_display))
        && !FIXNUMP (BVAR (current_buffer, selective_display)));
 
+  /* Use the line index for long scans.  */
+  if (!selective_display
+      && (LINE_INDEX_MIN_LINES <= count || count <= - LINE_INDEX_MIN_LINES)
+      && LINE_INDEX_MIN_SPAN <= eabs (limit_byte - start_byte))
+    {
+      struct line_index *line_index = buffer_line_index (current_buffer);
+
+      if (line_index)
+	{
+	  ptrdiff_t lines
+	    = line_index_newlines_before (current_buffer, line_index,
+					  start_byte);
+	  ptrdiff_t found
+	    = eabs (line_index_newlines_before (current_buffer, line_index,
+						limit_byte)
+		    - lines);
+	  ptrdiff_t charpos;
+
+	  if (count > 0 && count <= found)
+	    {
+	      line_index_after_newline (current_buffer, line_index,
+					lines + count, &charpos,
+					byte_pos_ptr);
+	      return orig_count;
+	    }
+	  if (count < 0 && - count <= found)
+	    {
+	      line_index_after_newline (current_buffer, line_index,
+					lines + count + 1, &charpos,
+					byte_pos_ptr);
+	      return - orig_count - 1;
+	    }
+	  *byte_pos_ptr = limit_byte;
+	  return found;
+	}
+    }
+
   if (count > 0)
     {
       while (start_byte < limit_byte)
@@ -29125,6 +29163,17 @@ display_count_lines (ptrdiff_t start_byte,
 	  ceiling_addr = BYTE_POS_ADDR (ceiling) + 1;
 	  base = (cursor = BYTE_POS_ADDR (start_byte));
 
+	  /* Skip whole blocks that end before the COUNTth newline.  */
+	  if (!selective_display)
+	    while (NEWLINE_SCAN_BLOCK <= ceiling_addr - cursor)
+	      {
+		ptrdiff_t n = count_newlines (cursor, NEWLINE_SCAN_BLOCK);
+		if (count <= n)
+		  break;
+		count -= n;
+		cursor += NEWLINE_SCAN_BLOCK;
+	      }
+
 	  do
 	    {
 	      if (selective_display)
@@ -29164,6 +29213,18 @@ display_count_lines (ptrdiff_t start_byte,
 	  ceiling = max (limit_byte, ceiling);
 	  ceiling_addr = BYTE_POS_ADDR (ceiling);
 	  base = (cursor = BYTE_POS_ADDR (start_byte - 1) + 1);
+
+	  if (!selective_display)
+	    while (NEWLINE_SCAN_BLOCK <= cursor - ceiling_addr)
+	      {
+		ptrdiff_t n = count_newlines (cursor - NEWLINE_SCAN_BLOCK,
+					      NEWLINE_SCAN_BLOCK);
+		if (- count <= n)
+		  break;
+		count += n;
+		cursor -= NEWLINE_SCAN_BLOCK;
+	      }
+
 	  while (true)
 	    {
 	      if (selective_display)
@@ -5281,6 +5281,7 @@ DEFUN ("face-attributes-as-vector", Fface_attributes_as_vector,
   merge_face_ref (NULL, XFRAME (selected_frame),
                   plist, XVECTOR (lface)->contents,
                   true, NULL, 0);
+  note_object_stores (lface);
   return lface;
 }
 
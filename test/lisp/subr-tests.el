@@ -1378,5 +1378,64 @@ subr--subst-char-in-string
                  (props-out (object-intervals out)))
             (should (equal props-out props-in))))))))
 
+(ert-deftest subr-tests--with-coalesced-change-hooks ()
+  "Test that `with-coalesced-change-hooks' runs the change hooks once."
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (insert "one two three four five\n")
+    (undo-boundary)
+    (let ((before nil) (after nil) (overlay-calls 0)
+          (ov (make-overlay 5 8)))
+      (overlay-put ov 'modification-hooks
+                   (list (lambda (&rest _) (setq overlay-calls
+                                                 (1+ overlay-calls)))))
+      (add-hook 'before-change-functions
+                (lambda (beg end) (push (list beg end) before)) nil t)
+      (add-hook 'after-change-functions
+                (lambda (beg end len) (push (list beg end len) after)) nil t)
+      (should (eq (with-coalesced-change-hooks
+                    (goto-char (point-min))
+                    (while (re-search-forward "o" nil t)
+                      (replace-match "00"))
+                    (goto-char 2)
+                    (delete-char 1)
+                    'done)
+                  'done))
+      (should (equal (buffer-string) "0ne tw00 three f00ur five\n"))
+      (should (equal before '((1 25))))
+      ;; The changed text runs from the first "o" to the last.
+      (should (equal after '((1 19 16))))
+      ;; The overlay hooks ran before and after the change of "two".
+      (should (= overlay-calls 2))
+      ;; The changes are undone together.
+      (primitive-undo 1 buffer-undo-list)
+      (should (equal (buffer-string) "one two three four five\n"))
+      (setq after nil)
+      ;; Otherwise, the hooks run for each change.
+      (goto-char (point-min))
+      (while (re-search-forward "o" nil t)
+        (replace-match "0"))
+      (should (= (length after) 3)))))
+
+(ert-deftest subr-tests--with-coalesced-change-hooks-threads ()
+  "Test that coalescing change hooks leaves out other threads' changes."
+  (skip-unless (featurep 'threads))
+  (with-temp-buffer
+    (let ((buffer (current-buffer)) (after nil))
+      (add-hook 'after-change-functions
+                (lambda (beg end len) (push (list beg end len) after)) nil t)
+      (with-coalesced-change-hooks
+        (insert "a")
+        (thread-join (make-thread (lambda ()
+                                    (with-current-buffer buffer
+                                      (insert "b")))))
+        ;; The other thread's change ran the hooks by itself.
+        (should (equal after '((2 3 0))))
+        (insert "c"))
+      (should (equal (buffer-string) "abc"))
+      ;; The hooks report the whole text as changed, including the
+      ;; other thread's insertion.
+      (should (equal after '((1 4 0) (2 3 0)))))))
+
 (provide 'subr-tests)
 ;;; subr-tests.el ends here
@@ -0,0 +1,116 @@
+;;; edit-perf.el --- measure the cost of scattered buffer edits  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2026 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; The text of a buffer is kept in a single block of memory with a gap
+;; in it, and every insertion or deletion must first move the gap to
+;; where it happens, so edits scattered over a large buffer can move
+;; megabytes of text each.  This file compares such scattered edits
+;; with the same number of edits made close together, for insertions,
+;; deletions, and replacements of text by text of the same or of a
+;; different length.  It is also meant as a baseline for any other
+;; representation of buffer text, such as a piece table, that would not
+;; need to move a gap at all.  Run it with
+;;
+;;   emacs -Q --batch -l edit-perf.el -f edit-perf-run-batch [SIZE [EDITS]]
+;;
+;; where SIZE is the size of the buffer in megabytes, and EDITS is the
+;; number of edits of each kind.
+
+;;; Code:
+
+(defvar edit-perf-size 16
+  "Size in megabytes of the buffer the edits are made in.")
+
+(defvar edit-perf-edits 2000
+  "Number of edits of each kind to make.")
+
+(defun edit-perf--fill ()
+  "Fill the current buffer with `edit-perf-size' megabytes of text."
+  (let ((line "The quick brown fox jumps over the lazy dog; αβγδ.\n"))
+    (dotimes (_ (/ (* edit-perf-size 1024 1024) (string-bytes line)))
+      (insert line)))
+  (goto-char (point-min)))
+
+(defun edit-perf--positions (scattered)
+  "Return a list of `edit-perf-edits' positions in the current buffer.
+If SCATTERED, they alternate between the two halves of the buffer,
+otherwise they are all near its middle."
+  (let ((half (/ (buffer-size) 2))
+        (positions nil))
+    (random "edit-perf")
+    (dotimes (i edit-perf-edits)
+      (push (if scattered
+                (+ (point-min) (random half) (if (zerop (% i 2)) 0 half))
+              (+ half (random 4096)))
+            positions))
+    positions))
+
+(defun edit-perf--replace (old new)
+  "Replace the text OLD, just after point, with NEW, as `replace-match' does."
+  (when (looking-at (regexp-quote old))
+    (replace-match new t t)))
+
+(defconst edit-perf--workloads
+  `((insert . ,(lambda () (insert "xyz")))
+    (delete . ,(lambda () (delete-char (min 3 (- (point-max) (point))))))
+    (replace-same . ,(lambda ()
+                       (skip-chars-forward "^ ")
+                       (edit-perf--replace " " "_")))
+    (replace-longer . ,(lambda ()
+                         (skip-chars-forward "^ ")
+                         (edit-perf--replace " " "__"))))
+  "Alist of the edits to measure, and functions performing them at point.")
+
+(defun edit-perf-run-1 (workload scattered)
+  "Return the time in seconds that WORKLOAD takes.
+WORKLOAD is a key of `edit-perf--workloads'; if SCATTERED, its edits
+are spread over the whole buffer, otherwise they are close together."
+  (with-temp-buffer
+    (edit-perf--fill)
+    (buffer-enable-undo)
+    (let ((edit (alist-get workload edit-perf--workloads))
+          (positions (edit-perf--positions scattered)))
+      (garbage-collect)
+      (car (benchmark-run nil
+             (dolist (pos positions)
+               (goto-char (min pos (point-max)))
+               (funcall edit)))))))
+
+(defun edit-perf-run ()
+  "Measure the edits of `edit-perf--workloads' and print the results."
+  (princ (format "%d edits of each kind in a %d MB buffer\n"
+                 edit-perf-edits edit-perf-size))
+  (princ (format "%-16s %10s %10s\n" "workload" "local" "scattered"))
+  (dolist (workload (mapcar #'car edit-perf--workloads))
+    (princ (format "%-16s %9.3fs %9.3fs\n" workload
+                   (edit-perf-run-1 workload nil)
+                   (edit-perf-run-1 workload t)))))
+
+(defun edit-perf-run-batch ()
+  "Run `edit-perf-run' with the arguments in `command-line-args-left'."
+  (let ((standard-output #'external-debugging-output))
+    (when command-line-args-left
+      (setq edit-perf-size (string-to-number (pop command-line-args-left))))
+    (when command-line-args-left
+      (setq edit-perf-edits (string-to-number (pop command-line-args-left))))
+    (edit-perf-run)))
+
+;;; edit-perf.el ends here
@@ -0,0 +1,94 @@
+;;; gc-perf.el --- measure garbage collection pauses  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2026 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; A full garbage collection marks every live object, so its pause
+;; grows with the data a session keeps alive, even when nearly all
+;; that was allocated since the previous collection is already
+;; garbage.  This file keeps many cons cells alive, then allocates
+;; short-lived lists, as completion and font-lock do, while now and
+;; then storing new lists into the old ones.  It measures the time the
+;; collections this causes take, and the longest time Lisp was stopped,
+;; with `gc-generational' and `gc-incremental' in turn.  The live data
+;; are all cons cells, which is the case minor collections help with:
+;; they still look at every vector, string and symbol.  Run it with
+;;
+;;   emacs -Q --batch -l gc-perf.el -f gc-perf-run-batch [N]
+;;
+;; where N is the number of millions of cons cells kept alive.
+
+;;; Code:
+
+(defvar gc-perf-live 4
+  "Number of millions of cons cells kept alive.")
+
+(defvar gc-perf-garbage 40
+  "Number of millions of short-lived cons cells allocated.")
+
+(defun gc-perf-run-1 (generational incremental)
+  "Return statistics of collections with the given GC settings.
+GENERATIONAL and INCREMENTAL are the values to bind `gc-generational'
+and `gc-incremental' to.  The value is a list of the number of
+collections, the number of minor ones, the time they took in seconds,
+and the longest time in seconds that an allocation was stopped."
+  (let ((gc-generational generational)
+        (gc-incremental incremental)
+        (live nil)
+        (longest 0.0))
+    (dotimes (i (* gc-perf-live 250000))
+      (push (list i (* i 1.0) i) live))
+    (let ((old (vconcat live))
+          (gcs gcs-done)
+          (minor minor-gcs-done)
+          elapsed)
+      (garbage-collect)
+      (setq elapsed gc-elapsed)
+      (random "gc-perf")
+      (dotimes (i (* gc-perf-garbage 10000))
+        (let ((start (float-time)))
+          (make-list 100 i)
+          (when (zerop (% i 100))
+            (setcar (aref old (random (length old))) (list i)))
+          (setq longest (max longest (- (float-time) start)))))
+      (list (- gcs-done gcs 1) (- minor-gcs-done minor)
+            (- gc-elapsed elapsed) longest))))
+
+(defun gc-perf-run ()
+  "Measure the pauses of garbage collection and print the results."
+  (princ (format "%d million live cons cells, %d million allocated\n"
+                 gc-perf-live gc-perf-garbage))
+  (princ (format "%-13s %-12s %6s %6s %9s %9s\n" "generational"
+                 "incremental" "gcs" "minor" "total" "longest"))
+  (pcase-dolist (`(,generational ,incremental)
+                 '((nil nil) (t nil) (nil t) (t t)))
+    (garbage-collect)
+    (pcase-let ((`(,gcs ,minor ,total ,longest)
+                 (gc-perf-run-1 generational incremental)))
+      (princ (format "%-13s %-12s %6d %6d %8.3fs %8.3fs\n"
+                     generational incremental gcs minor total longest)))))
+
+(defun gc-perf-run-batch ()
+  "Run `gc-perf-run' with the arguments in `command-line-args-left'."
+  (let ((standard-output #'external-debugging-output))
+    (when command-line-args-left
+      (setq gc-perf-live (string-to-number (pop command-line-args-left))))
+    (gc-perf-run)))
+
+;;; gc-perf.el ends here
@@ -464,6 +464,7 @@ test_remove1_setup (void)
   B.left = &A; B.right = &D;
   D.left = &C; D.right = &E;
   A.offset = B.offset = C.offset = D.offset = E.offset = 0;
+  A.clamp = B.clamp = C.clamp = D.clamp = E.clamp = PTRDIFF_MIN;
   A.otick = B.otick = C.otick = D.otick = E.otick = tree.otick;
 }
 
@@ -752,7 +753,7 @@ START_TEST (test_generator_1)
   itree_init (&tree);
 
   itree_insert (&tree, &node, 10, 20);
-  g = itree_iterator_start (&it, &tree, 0, 30, ITREE_ASCENDING);
+  g = itree_iterator_start (&it, &tree, 0, 30, true, ITREE_ASCENDING);
   n = itree_iterator_next (g);
   ck_assert_ptr_eq (n, &node);
   ck_assert_int_eq (n->begin, 10);
@@ -761,7 +762,7 @@ START_TEST (test_generator_1)
   ck_assert_ptr_null (itree_iterator_next (g));
   ck_assert_ptr_null (itree_iterator_next (g));
 
-  g = itree_iterator_start (&it, &tree, 30, 50, ITREE_ASCENDING);
+  g = itree_iterator_start (&it, &tree, 30, 50, true, ITREE_ASCENDING);
   ck_assert_ptr_null (itree_iterator_next (g));
   ck_assert_ptr_null (itree_iterator_next (g));
   ck_assert_ptr_null (itree_iterator_next (g));
@@ -775,7 +776,7 @@ test_check_generator (struct itree_tree *tree,
 {
   va_list ap;
   struct itree_iterator it, *g =
-    itree_iterator_start (&it, tree, begin, end, ITREE_ASCENDING);
+    itree_iterator_start (&it, tree, begin, end, true, ITREE_ASCENDING);
 
   va_start (ap, n);
   for (int i = 0; i < n; ++i)
@@ -859,7 +860,7 @@ START_TEST (test_generator_5)
                                 {.begin = 40, .end = 60}};
   test_create_tree (nodes, N, false);
   struct itree_iterator it, *g =
-    itree_iterator_start (&it, &tree, 0, 100, ITREE_PRE_ORDER);
+    itree_iterator_start (&it, &tree, 0, 100, true, ITREE_PRE_ORDER);
   for (int i = 0; i < N; ++i)
     {
       struct itree_node *n = itree_iterator_next (g);
@@ -884,7 +885,7 @@ START_TEST (test_generator_6)
                                 {.begin = 40, .end = 60}};
   test_create_tree (nodes, N, true);
   struct itree_iterator it, *g =
-    itree_iterator_start (&it, &tree, 0, 100, ITREE_ASCENDING);
+    itree_iterator_start (&it, &tree, 0, 100, true, ITREE_ASCENDING);
   for (int i = 0; i < N; ++i)
     {
       struct itree_node *n = itree_iterator_next (g);
@@ -909,7 +910,7 @@ START_TEST (test_generator_7)
                                 {.begin = 40, .end = 60}};
   test_create_tree (nodes, N, true);
   struct itree_iterator it, *g =
-    itree_iterator_start (&it, &tree, 0, 100, ITREE_DESCENDING);
+    itree_iterator_start (&it, &tree, 0, 100, true, ITREE_DESCENDING);
   for (int i = 0; i < N; ++i)
     {
       struct itree_node *n = itree_iterator_next (g);
@@ -932,7 +933,7 @@ START_TEST (test_generator_8)
                                 {.begin = 40, .end = 50}};
   test_create_tree (nodes, N, false);
   struct itree_iterator it, *g =
-    itree_iterator_start (&it, &tree, 1, 60, ITREE_DESCENDING);
+    itree_iterator_start (&it, &tree, 1, 60, true, ITREE_DESCENDING);
   struct itree_node *n = itree_iterator_next (g);
   ck_assert_int_eq (n->begin, 40);
   itree_iterator_narrow (g, 50, 60);
@@ -948,7 +949,7 @@ START_TEST (test_generator_9)
                                 {.begin = 20, .end = 30}};
   test_create_tree (nodes, N, false);
   struct itree_iterator it, *g =
-    itree_iterator_start (&it, &tree, 1, 30, ITREE_DESCENDING);
+    itree_iterator_start (&it, &tree, 1, 30, true, ITREE_DESCENDING);
   struct itree_node *n = itree_iterator_next (g);
   ck_assert_int_eq (n->begin, 25);
   itree_iterator_narrow (g, 25, 30);
@@ -1182,7 +1183,7 @@ basic_suite ()
   Suite *s = suite_create ("basic");
 
   TCase *tc = tcase_create ("insert1");
-  tcase_add_checked_fixture (tc, test_insert1_setup, NULL);
+  tcase_add_checked_fixture (tc, test_insert1_setup);
   tcase_add_test (tc, test_insert_1);
   tcase_add_test (tc, test_insert_2);
   tcase_add_test (tc, test_insert_3);
@@ -1192,7 +1193,7 @@ basic_suite ()
   suite_add_tcase (s, tc);
 
   tc = tcase_create ("insert2");
-  tcase_add_checked_fixture (tc, test_insert2_setup, NULL);
+  tcase_add_checked_fixture (tc, test_insert2_setup);
   tcase_add_test (tc, test_insert_7);
   tcase_add_test (tc, test_insert_8);
   tcase_add_test (tc, test_insert_9);
@@ -1207,7 +1208,7 @@ basic_suite ()
   suite_add_tcase (s, tc);
 
   tc = tcase_create ("remove1");
-  tcase_add_checked_fixture (tc, test_remove1_setup, NULL);
+  tcase_add_checked_fixture (tc, test_remove1_setup);
   tcase_add_test (tc, test_remove_1);
   tcase_add_test (tc, test_remove_2);
   tcase_add_test (tc, test_remove_3);
@@ -1215,7 +1216,7 @@ basic_suite ()
   suite_add_tcase (s, tc);
 
   tc = tcase_create ("remove2");
-  tcase_add_checked_fixture (tc, test_remove2_setup, NULL);
+  tcase_add_checked_fixture (tc, test_remove2_setup);
   tcase_add_test (tc, test_remove_5);
   tcase_add_test (tc, test_remove_6);
   tcase_add_test (tc, test_remove_7);
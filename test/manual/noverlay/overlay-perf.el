@@ -581,6 +581,26 @@ perf-delete-scatter
         (goto-char (max 1 (random (point-max))))
         (delete-char 1)))))
 
+(perf-define-variable-test perf-delete-region-collapsed (n)
+  (with-temp-buffer
+    (perf-insert-text n)
+    (perf-insert-overlays-scattered n)
+    (delete-region (point-min) (/ (point-max) 2))
+    (goto-char 1)
+    (benchmark-run 1
+      (dotimes (_ (/ n 4))
+        (delete-char 1)))))
+
+(perf-define-variable-test perf-delete-region-evaporate (n)
+  (with-temp-buffer
+    (perf-insert-text n)
+    (perf-insert-overlays-scattered n)
+    (dolist (ov (overlays-in (point-min) (point-max)))
+      (overlay-put ov 'evaporate t))
+    (benchmark-run 1
+      (dotimes (_ 100)
+        (delete-region (point-min) (+ (point-min) (/ n 200)))))))
+
 (perf-define-test-suite perf-insert-delete-suite
   'perf-insert-before
   'perf-insert-after
@@ -588,6 +608,8 @@ perf-insert-delete-suite
   'perf-delete-before
   'perf-delete-after
   'perf-delete-scatter
+  'perf-delete-region-collapsed
+  'perf-delete-region-evaporate
   )
 
 
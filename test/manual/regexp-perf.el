@@ -0,0 +1,104 @@
+;;; regexp-perf.el --- measure regexp searches  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2026 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; The regexp matcher backtracks, so some regexps take a time
+;; exponential in the length of the text they fail to match, while
+;; most take a time linear in it.  This file measures both kinds: the
+;; searches of regexps that font-lock and similar code perform in a
+;; large buffer of Lisp code, and the searches of regexps that can
+;; match the same text in many ways.  Run it with
+;;
+;;   emacs -Q --batch -l regexp-perf.el -f regexp-perf-run-batch [SIZE]
+;;
+;; where SIZE is the size of the buffer of Lisp code in megabytes.
+
+;;; Code:
+
+(defvar regexp-perf-size 8
+  "Size in megabytes of the buffer of Lisp code searched.")
+
+(defconst regexp-perf--regexps
+  '(("defun" . "^(def\\(?:un\\|macro\\|var\\|custom\\) +\\(\\(?:\\sw\\|\\s_\\)+\\)")
+    ("keyword" . "\\_<:\\(?:\\sw\\|\\s_\\)+\\_>")
+    ("string" . "\"\\(?:[^\"\\\\]\\|\\\\.\\)*\"")
+    ("comment" . ";+ *\\(.*\\)$")
+    ("alternation" . "\\(?:lambda\\|let\\*?\\|when\\|unless\\|progn\\)[ \n]")
+    ("absent" . "\\(?:foo\\|bar\\)+baz\\(?:quux\\)?")
+    ("identifier" . "\\_<string-\\(?:trim\\|pad\\)\\(?:-left\\|-right\\)?\\_>")
+    ("rare" . "(defun[ \t]+\\(string-rare-identifier\\)")
+    ("rare-prefix" . "^(defun string-rare-\\(?:identifier\\|name\\) "))
+  "Alist of the regexps searched for in the buffer of Lisp code.")
+
+(defconst regexp-perf--pathological
+  '(("(a|aa)*c" . "\\(?:a\\|aa\\)*c")
+    ("(a*)*b" . "\\(a*\\)*b")
+    ("^(a+)+$" . "^\\(?:a+\\)+$"))
+  "Alist of regexps that can match runs of a's in many ways.")
+
+(defun regexp-perf--fill ()
+  "Fill the current buffer with `regexp-perf-size' megabytes of Lisp code."
+  (let ((code (with-temp-buffer
+                (insert-file-contents
+                 (expand-file-name "emacs-lisp/subr-x.el" lisp-directory))
+                (buffer-string))))
+    (while (< (buffer-size) (* regexp-perf-size 1024 1024))
+      (insert code)))
+  (emacs-lisp-mode)
+  (goto-char (point-min)))
+
+(defun regexp-perf--count (regexp)
+  "Return the number of matches of REGEXP after point."
+  (let ((count 0))
+    (while (re-search-forward regexp nil t)
+      (setq count (1+ count))
+      (when (= (match-beginning 0) (match-end 0))
+        (forward-char 1)))
+    count))
+
+(defun regexp-perf-run ()
+  "Measure the searches of the regexps above and print the results."
+  (princ (format "%-16s %8s %10s\n" "regexp" "matches" "time"))
+  (with-temp-buffer
+    (regexp-perf--fill)
+    (pcase-dolist (`(,name . ,regexp) regexp-perf--regexps)
+      (goto-char (point-min))
+      (let* ((count nil)
+             (time (car (benchmark-run nil
+                          (setq count (regexp-perf--count regexp))))))
+        (princ (format "%-16s %8d %9.3fs\n" name count time)))))
+  (princ (format "\n%-16s %8s %10s\n" "regexp" "a's" "time"))
+  (pcase-dolist (`(,name . ,regexp) regexp-perf--pathological)
+    (dolist (length '(16 20 24))
+      (let* ((string (concat (make-string length ?a) "b"))
+             (time (car (benchmark-run nil
+                          (condition-case nil
+                              (string-match regexp string)
+                            (error nil))))))
+        (princ (format "%-16s %8d %9.3fs\n" name length time))))))
+
+(defun regexp-perf-run-batch ()
+  "Run `regexp-perf-run' with the arguments in `command-line-args-left'."
+  (let ((standard-output #'external-debugging-output))
+    (when command-line-args-left
+      (setq regexp-perf-size (string-to-number (pop command-line-args-left))))
+    (regexp-perf-run)))
+
+;;; regexp-perf.el ends here
@@ -0,0 +1,149 @@
+;;; syntax-perf.el --- measure scans of buffer text  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2026 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Indentation engines and tokenizers written in Lisp scan the text of
+;; the buffer with primitives such as `skip-chars-forward', calling
+;; them in tight loops, move over balanced expressions and comments,
+;; and ask `syntax-ppss' for the syntactic context of positions
+;; anywhere in the buffer.  This file measures such scans over a large
+;; buffer of Lisp code, both as it is and with its lines joined into
+;; lines of a few kilobytes, as in logs or minified files.  Run it with
+;;
+;;   emacs -Q --batch -l syntax-perf.el -f syntax-perf-run-batch [SIZE]
+;;
+;; where SIZE is the size of the buffer in megabytes.
+
+;;; Code:
+
+(defvar syntax-perf-size 8
+  "Size in megabytes of the buffer of Lisp code scanned.")
+
+(defun syntax-perf--fill (how)
+  "Fill the current buffer with `syntax-perf-size' megabytes of Lisp code.
+HOW is `code' to leave the code as it is, and `joined' to join its
+lines a hundred at a time."
+  (let ((code (with-temp-buffer
+                (insert-file-contents
+                 (expand-file-name "emacs-lisp/subr-x.el" lisp-directory))
+                (buffer-string))))
+    (while (< (buffer-size) (* syntax-perf-size 1024 1024))
+      (insert code)))
+  (when (eq how 'joined)
+    (goto-char (point-min))
+    (let ((line 0))
+      (while (search-forward "\n" nil t)
+        (unless (zerop (% (setq line (1+ line)) 100))
+          (replace-match " ")))))
+  (emacs-lisp-mode)
+  (goto-char (point-min)))
+
+(defconst syntax-perf--workloads
+  `((lines
+     . ,(lambda ()
+          (while (progn (skip-chars-forward "^\n")
+                        (not (eobp)))
+            (forward-char 1))))
+    (lines-backward
+     . ,(lambda ()
+          (goto-char (point-max))
+          (while (progn (skip-chars-backward "^\n")
+                        (not (bobp)))
+            (backward-char 1))))
+    (tokens
+     . ,(lambda ()
+          (while (not (eobp))
+            (skip-chars-forward " \t\n")
+            (when (zerop (skip-chars-forward "a-zA-Z0-9_-"))
+              (skip-chars-forward "^ \t\na-zA-Z0-9_-")))))
+    (classes
+     . ,(lambda ()
+          (while (not (eobp))
+            (when (zerop (skip-chars-forward "^[:space:]"))
+              (skip-chars-forward "[:space:]")))))
+    (indentation
+     . ,(lambda ()
+          (while (not (eobp))
+            (skip-chars-forward " \t")
+            (forward-line 1))))
+    ;; Don't measure the time `syntax-propertize' takes.  Once lines
+    ;; are joined, comments swallow the code after them, so
+    ;; parentheses need not balance there.
+    (sexps
+     . ,(lambda ()
+          (setq-local syntax-propertize-function nil)
+          (ignore-error scan-error
+            (while (scan-sexps (point) 1)
+              (forward-sexp)))))
+    (sexp-large
+     . ,(lambda ()
+          (setq-local syntax-propertize-function nil)
+          ;; Make the whole buffer one form, and move over it.
+          (insert "(progn\n")
+          (goto-char (point-max))
+          (insert ")\n")
+          (dotimes (_ 10)
+            (goto-char (point-min))
+            (ignore-error scan-error
+              (forward-sexp)))))
+    (ppss-random
+     . ,(lambda ()
+          (setq-local syntax-propertize-function nil)
+          (random "syntax-perf")
+          (dotimes (_ 10000)
+            (syntax-ppss (1+ (random (buffer-size)))))))
+    (ppss-edit
+     . ,(lambda ()
+          (setq-local syntax-propertize-function nil)
+          (random "syntax-perf")
+          ;; Type in the middle of the buffer, looking at the context of
+          ;; the text after point as indentation and font-lock would.
+          (goto-char (/ (buffer-size) 2))
+          (dotimes (_ 1000)
+            (insert " ")
+            (syntax-ppss (+ (point) (random 2000)))))))
+  "Alist of the scans to measure, and functions performing them.")
+
+(defun syntax-perf-run-1 (how workload)
+  "Return the time in seconds that WORKLOAD takes in a buffer filled as HOW.
+HOW is as for `syntax-perf--fill', and WORKLOAD is a key of
+`syntax-perf--workloads'."
+  (with-temp-buffer
+    (syntax-perf--fill how)
+    (car (benchmark-run nil
+           (funcall (alist-get workload syntax-perf--workloads))))))
+
+(defun syntax-perf-run ()
+  "Measure the scans of `syntax-perf--workloads' and print the results."
+  (princ (format "%d MB of Lisp code\n" syntax-perf-size))
+  (princ (format "%-16s %10s %10s\n" "workload" "code" "joined"))
+  (dolist (workload (mapcar #'car syntax-perf--workloads))
+    (princ (format "%-16s %9.3fs %9.3fs\n" workload
+                   (syntax-perf-run-1 'code workload)
+                   (syntax-perf-run-1 'joined workload)))))
+
+(defun syntax-perf-run-batch ()
+  "Run `syntax-perf-run' with the arguments in `command-line-args-left'."
+  (let ((standard-output #'external-debugging-output))
+    (when command-line-args-left
+      (setq syntax-perf-size (string-to-number (pop command-line-args-left))))
+    (syntax-perf-run)))
+
+;;; syntax-perf.el ends here
@@ -0,0 +1,120 @@
+;;; textprop-perf.el --- measure text property operations at scale  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2026 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; The text properties of a buffer are kept in a tree of intervals,
+;; so their cost depends on how many intervals there are, and on how
+;; well balanced that tree is.  This file measures the basic text
+;; property operations in buffers with many intervals, some of them
+;; built so as to unbalance the tree.  Run it with
+;;
+;;   emacs -Q --batch -l textprop-perf.el -f textprop-perf-run-batch [N]
+;;
+;; where N is the number of intervals with properties to create.
+
+;;; Code:
+
+(defvar textprop-perf-intervals 1000000
+  "Number of intervals with properties in the buffers measured.")
+
+(defvar textprop-perf-operations 1000000
+  "Number of operations of each kind to measure.")
+
+(defun textprop-perf--fontify ()
+  "Put properties on every other pair of chars of the current buffer.
+Do it from left to right, as font-lock does."
+  (let ((pos (point-min)))
+    (dotimes (i textprop-perf-intervals)
+      (put-text-property pos (+ pos 2) 'face (if (zerop (% i 2)) 'bold 'italic))
+      (setq pos (+ pos 4)))))
+
+(defun textprop-perf--fill (how)
+  "Fill the current buffer with text and intervals.
+HOW is `fontify' to fontify the buffer from left to right, and
+`deleted' to then delete some long intervals in it, which used to
+leave the tree of intervals very unbalanced."
+  (pcase-exhaustive how
+    ('fontify
+     (insert (make-string (* 4 textprop-perf-intervals) ?a))
+     (textprop-perf--fontify))
+    ('deleted
+     (dotimes (i textprop-perf-intervals)
+       (insert (propertize (make-string (if (zerop (% i 1000)) 100000 2) ?a)
+                           'face (if (zerop (% i 2)) 'bold 'italic))
+               "z"))
+     (goto-char (point-min))
+     (let ((chunk (make-string 1000 ?a)))
+       (while (search-forward chunk nil t)
+         (delete-region (match-beginning 0) (match-end 0))))))
+  (goto-char (point-min)))
+
+(defconst textprop-perf--workloads
+  `((get-random
+     . ,(lambda ()
+          (dotimes (_ textprop-perf-operations)
+            (get-text-property (1+ (random (buffer-size))) 'face))))
+    (put-random
+     . ,(lambda ()
+          (dotimes (_ (/ textprop-perf-operations 10))
+            (let ((pos (1+ (random (- (buffer-size) 3)))))
+              (put-text-property pos (+ pos 3) 'face 'underline)))))
+    (next-change
+     . ,(lambda ()
+          (let ((pos (point-min)))
+            (while (setq pos (next-single-property-change pos 'face)))))))
+  "Alist of the operations to measure, and functions performing them.")
+
+(defun textprop-perf-run-1 (how workload)
+  "Return the time in seconds that WORKLOAD takes in a buffer filled as HOW.
+HOW is as for `textprop-perf--fill', and WORKLOAD is a key of
+`textprop-perf--workloads'."
+  (garbage-collect)
+  ;; Garbage collection rebalances the trees of intervals, so it would
+  ;; hide the time taken in unbalanced trees until then.
+  (let ((gc-cons-threshold most-positive-fixnum))
+    (with-temp-buffer
+      (textprop-perf--fill how)
+      (random "textprop-perf")
+      (car (benchmark-run nil
+             (funcall (alist-get workload textprop-perf--workloads)))))))
+
+(defun textprop-perf-run ()
+  "Measure the operations of `textprop-perf--workloads' and print the results."
+  (princ (format "%d intervals, %d operations of each kind\n"
+                 textprop-perf-intervals textprop-perf-operations))
+  (princ (format "%-16s %10s %10s\n" "workload" "fontified" "deleted"))
+  (with-temp-buffer
+    (insert (make-string (* 4 textprop-perf-intervals) ?a))
+    (princ (format "%-16s %9.3fs\n" "put-fontify"
+                   (car (benchmark-run nil (textprop-perf--fontify))))))
+  (dolist (workload (mapcar #'car textprop-perf--workloads))
+    (princ (format "%-16s %9.3fs %9.3fs\n" workload
+                   (textprop-perf-run-1 'fontify workload)
+                   (textprop-perf-run-1 'deleted workload)))))
+
+(defun textprop-perf-run-batch ()
+  "Run `textprop-perf-run' with the arguments in `command-line-args-left'."
+  (let ((standard-output #'external-debugging-output))
+    (when command-line-args-left
+      (setq textprop-perf-intervals
+            (string-to-number (pop command-line-args-left))))
+    (textprop-perf-run)))
+
+;;; textprop-perf.el ends here
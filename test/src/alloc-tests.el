@@ -59,4 +59,197 @@ aset-nbytes-change
       (aset s 0 c)
       (should (equal s (make-string 1 c))))))
 
+(ert-deftest gc-generational-old-conses ()
+  "Check that minor collections keep what old conses were made to point to."
+  (let ((gc-generational t)
+        (minor minor-gcs-done)
+        (old (make-list 1000 nil)))
+    ;; Make the cells of OLD survive a collection.
+    (garbage-collect)
+    (dotimes (round 3)
+      (cl-loop for tail on old
+               for i below 1000
+               do (setcar tail (list round i (float i))))
+      (nconc old (list round (float round)))
+      (make-list 10000 nil)
+      (garbage-collect-maybe most-positive-fixnum)
+      (make-list 10000 nil)
+      (cl-loop for elt in old
+               for i below 1000
+               do (should (equal elt (list round i (float i))))))
+    (should (equal (last old 6) '(0 0.0 1 1.0 2 2.0)))
+    (should (> minor-gcs-done minor))))
+
+(ert-deftest gc-generational-old-objects ()
+  "Check that minor collections keep what old objects were made to point to."
+  (let* ((gc-generational t)
+         (minor minor-gcs-done)
+         (vec (make-vector 100 nil))
+         (rec (record 'foo nil))
+         (table (make-char-table 'gc-generational-test))
+         (hash (make-hash-table))
+         (str (copy-sequence "old string"))
+         (sym (make-symbol "old"))
+         (prop (make-symbol "prop")))
+    ;; Make these survive a collection.
+    (garbage-collect)
+    (dotimes (round 3)
+      (dotimes (i 100)
+        (aset vec i (list round i (float i))))
+      (aset rec 1 (list round))
+      (set-char-table-range table '(?a . ?z) (list round))
+      (puthash round (list round) hash)
+      (put-text-property 0 3 'face (list round) str)
+      (set sym (list round))
+      (fset sym (list round))
+      (put sym 'prop (list round))
+      ;; `car' is in the dump.
+      (put 'car prop (list round))
+      (make-list 10000 nil)
+      (garbage-collect-maybe most-positive-fixnum)
+      (make-list 10000 nil)
+      (dotimes (i 100)
+        (should (equal (aref vec i) (list round i (float i)))))
+      (should (equal (aref rec 1) (list round)))
+      (should (equal (aref table ?m) (list round)))
+      (should (equal (gethash round hash) (list round)))
+      (should (equal (get-text-property 1 'face str) (list round)))
+      (should (equal (symbol-value sym) (list round)))
+      (should (equal (symbol-function sym) (list round)))
+      (should (equal (get sym 'prop) (list round)))
+      (should (equal (get 'car prop) (list round))))
+    (put 'car prop nil)
+    (should (> minor-gcs-done minor))))
+
+;; Lisp runs between the slices of an incremental collection, while
+;; only some of the conses it uses are marked.
+(ert-deftest gc-incremental-changed-conses ()
+  "Check that incremental collections keep what marked conses point to."
+  (let ((gc-incremental t)
+        (gc-cons-threshold 100000)
+        (gc-cons-percentage 0.0)
+        (gcs gcs-done)
+        (old (make-list 1000 nil)))
+    (let ((tail old))
+      (dotimes (i 20000)
+        (setcar tail (list i (float i) (make-string 1 ?a)))
+        (setq tail (or (cdr tail) old))
+        (make-list 10 nil)
+        (when (zerop (% i 2000))
+          (sit-for 0))))
+    (cl-loop for elt in old
+             for i from 19000
+             do (should (equal elt (list i (float i) "a"))))
+    (should (> gcs-done gcs))))
+
+(defvar alloc-tests--parallel nil)
+
+(ert-deftest gc-mark-threads ()
+  "Check that parallel marking keeps what global variables reach."
+  (let ((gc-mark-threads 4)
+        (local (make-list 1000 nil)))
+    (setq alloc-tests--parallel nil)
+    (dotimes (i 20000)
+      (let ((symbol (make-symbol "alloc-tests"))
+            (table (make-hash-table)))
+        (set symbol (list (format "%d" i)))
+        (puthash i (record 'alloc-tests (list i)) table)
+        (push (list i (float i) (vector i (list i) (format "%d" i))
+                    (propertize "p" 'i (list i)) symbol table)
+              alloc-tests--parallel))
+      (setcar (nthcdr (% i 1000) local) (cons i (float i))))
+    (dotimes (_ 3)
+      (garbage-collect)
+      (make-list 100000 nil))
+    (cl-loop for (i f v p symbol table) in alloc-tests--parallel
+             for j downfrom 19999
+             do (should (equal (list i f v) (list j (float j)
+                                                  (vector j (list j)
+                                                          (format "%d" j)))))
+             (should (equal (get-text-property 0 'i p) (list j)))
+             (should (equal (symbol-value symbol) (list (format "%d" j))))
+             (should (equal (gethash j table)
+                            (record 'alloc-tests (list j)))))
+    (cl-loop for elt in local
+             for i from 19000
+             do (should (equal elt (cons i (float i))))))
+  (setq alloc-tests--parallel nil))
+
+(ert-deftest gc-lazy-sweep ()
+  "Check that lazily swept blocks keep the conses and floats in use."
+  (dolist (generational '(nil t))
+    (let ((gc-lazy-sweep t)
+          (gc-generational generational)
+          (live (make-list 1000 nil)))
+      (dotimes (i 20000)
+        (make-list 10 i)
+        (setcar (nthcdr (% i 1000) live) (list i (float i))))
+      (let ((stats (garbage-collect)))
+        (should (>= (nth 2 (assq 'conses stats)) 3000))
+        (should (>= (nth 2 (assq 'floats stats)) 1000)))
+      (dotimes (i 20000)
+        (make-list 10 (float i)))
+      (garbage-collect)
+      (cl-loop for elt in live
+               for i from 19000
+               do (should (equal elt (list i (float i))))))))
+
+(ert-deftest garbage-collect-release-memory ()
+  "Check that freeing empty blocks keeps the objects in use."
+  (let ((live (make-list 1000 nil))
+        (garbage (make-list 200000 nil)))
+    (dotimes (i 1000)
+      (setcar (nthcdr i live) (list i (float i))))
+    (dotimes (i 200000)
+      (setcar (nthcdr (% i 10) garbage) (float i)))
+    (setq garbage nil)
+    (let ((free (nth 3 (assq 'conses (garbage-collect))))
+          (stats (garbage-collect-release-memory)))
+      (should (>= (nth 2 (assq 'conses stats)) 3000))
+      (should (<= (nth 3 (assq 'conses stats)) free)))
+    (dotimes (i 10000)
+      (make-list 10 (float i)))
+    (cl-loop for elt in live
+             for i from 0
+             do (should (equal elt (list i (float i)))))))
+
+(ert-deftest gc-log-entry ()
+  "Check the records of the GC log, and copying them into a vector."
+  (garbage-collect)
+  (let ((entry (gc-log-entry 0))
+        (vector (make-vector 14 nil)))
+    (should (= (aref entry 0) gcs-done))
+    (should (eq (aref entry 2) 'explicit))
+    (should (natnump (aref entry 4)))
+    (should (> (aref entry 7) 0))
+    (should (eq (gc-log-entry 0 vector) vector))
+    (should (equal vector entry))
+    (make-list 100000 nil)
+    (garbage-collect)
+    (should (= (aref (gc-log-entry 1) 0) (aref entry 0)))
+    (should (> (aref (gc-log-entry 0) 8) 0))
+    (should-not (gc-log-entry 256))
+    (should-error (gc-log-entry 0 (make-vector 3 nil)))))
+
+(ert-deftest alloc-thread-buffers ()
+  "Check that threads allocating from their own buffers keep their conses."
+  (skip-unless (featurep 'threads))
+  (let* ((make (lambda (n)
+                 (let (l)
+                   (dotimes (i 20000)
+                     (push (cons (+ n i) (float i)) l)
+                     (when (zerop (% i 1000))
+                       (thread-yield)))
+                   l)))
+         (threads (mapcar (lambda (n)
+                            (make-thread (lambda () (funcall make n))))
+                          '(0 100000 200000))))
+    (garbage-collect)
+    (cl-loop for thread in threads
+             for n in '(0 100000 200000)
+             do (cl-loop for elt in (thread-join thread)
+                         for i downfrom 19999
+                         do (should (equal elt (cons (+ n i)
+                                                     (float i))))))))
+
 ;;; alloc-tests.el ends here
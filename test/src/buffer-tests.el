@@ -340,6 +340,41 @@ overlay-evaporation-after-killed-buffer
       (insert "toto")
       (move-overlay ol (point-min) (point-min)))))
 
+(ert-deftest buffer-tests--overlays-delete-region-collapse ()
+  "Deleting text collapses the overlays in it, evaporating some."
+  (with-temp-buffer
+    (insert (make-string 1000 ?x))
+    (let ((ovs (cl-loop for i from 1 below 1000 by 5
+                        collect (make-overlay i (+ i 3))))
+          (empty (make-overlay 400 400)))
+      (overlay-put (nth 100 ovs) 'evaporate t)
+      (overlay-put (nth 10 ovs) 'evaporate t)
+      (delete-region 300 700)
+      (should-not (overlay-buffer (nth 100 ovs)))
+      (should (eq (overlay-buffer (nth 10 ovs)) (current-buffer)))
+      (should (= (overlay-start empty) 300))
+      (cl-loop for ov in ovs
+               for i from 1 by 5
+               when (overlay-buffer ov)
+               do (cl-flet ((moved (pos)
+                              (cond ((<= pos 300) pos)
+                                    ((>= pos 700) (- pos 400))
+                                    (t 300))))
+                    (should (= (overlay-start ov) (moved i)))
+                    (should (= (overlay-end ov) (moved (+ i 3))))))
+      ;; The 79 overlays left in the deleted text, and EMPTY.
+      (should (= (length (overlays-in 300 300)) 80))
+      ;; Editing where the overlays collapsed moves them all alike.
+      (goto-char 300)
+      (insert "abc")
+      (should (= (length (overlays-in 300 300)) 80))
+      (delete-region 290 310)
+      (should (equal (mapcar (lambda (ov)
+                               (list (overlay-start ov) (overlay-end ov)))
+                             (overlays-at 290))
+                     '((290 292))))
+      (should (= (length (overlays-in 290 290)) 83)))))
+
 
 ;; +==========================================================================+
 ;; | Overlay test setup
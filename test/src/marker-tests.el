@@ -57,4 +57,77 @@ marker-goto-char-from-other-buffer
     (set-marker marker-2 marker-1)
     (should (goto-char marker-2))))
 
+;; Converting positions in a large buffer with non-ASCII text, which
+;; uses the line index, both within and around modifications.
+(ert-deftest marker-tests--position-bytes-large ()
+  (with-temp-buffer
+    (let ((cache-long-scans t)
+          (check
+           (lambda (pos)
+             (let ((byte (1+ (string-bytes
+                              (buffer-substring-no-properties 1 pos)))))
+               (should (= (position-bytes pos) byte))
+               (should (= (byte-to-position byte) pos))))))
+      (dotimes (i 20000)
+        (insert (if (zerop (% i 3)) "αβγ δ\n" "abc def\n")))
+      (funcall check 1)
+      (funcall check (point-max))
+      (dotimes (i 50)
+        (let ((pos (1+ (% (* i 7919) (buffer-size)))))
+          (goto-char pos)
+          (pcase (% i 3)
+            (0 (insert (make-string (% i 7) ?ж)))
+            (1 (delete-region pos (min (point-max) (+ pos (% i 11)))))
+            (2 (subst-char-in-region pos (min (point-max) (+ pos 100))
+                                     ?α ?ω)))
+          (funcall check (1+ (% (* i 104729) (buffer-size))))
+          (funcall check (point)))))))
+
+;; Many markers, relocated by insertions and deletions all over the
+;; buffer, must end up where the usual rules put them.
+(ert-deftest marker-tests--relocation-many ()
+  (with-temp-buffer
+    (dotimes (i 2000)
+      (insert (if (zerop (% i 5)) "αβ\n" "abcd\n")))
+    (let* ((markers
+            (mapcar (lambda (i)
+                      (let ((m (copy-marker (1+ (% (* i 7907) (point-max)))
+                                            (= (% i 2) 1))))
+                        (cons m (marker-position m))))
+                    (number-sequence 0 999))))
+      (dotimes (i 300)
+        (let* ((pos (1+ (% (* i 4799) (point-max))))
+               (len (% i 13))
+               (before (zerop (% i 7))))
+          (if (zerop (% i 2))
+              (progn
+                (goto-char pos)
+                (if before
+                    (insert-before-markers (make-string len ?λ))
+                  (insert (make-string len ?x)))
+                (dolist (cell markers)
+                  (let ((p (cdr cell)))
+                    (when (or (> p pos)
+                              (and (= p pos)
+                                   (or before
+                                       (marker-insertion-type (car cell)))))
+                      (setcdr cell (+ p len))))))
+            (let ((end (min (point-max) (+ pos len))))
+              (delete-region pos end)
+              (dolist (cell markers)
+                (let ((p (cdr cell)))
+                  (setcdr cell (cond ((> p end) (- p (- end pos)))
+                                     ((> p pos) pos)
+                                     (t p)))))))
+          (when (zerop (% i 50))
+            (dolist (cell markers)
+              (should (= (marker-position (car cell)) (cdr cell)))
+              (goto-char (car cell))
+              (should (= (position-bytes (point))
+                         (1+ (string-bytes
+                              (buffer-substring-no-properties
+                               1 (point))))))))))
+      (dolist (cell markers)
+        (should (= (marker-position (car cell)) (cdr cell)))))))
+
 ;;; marker-tests.el ends here
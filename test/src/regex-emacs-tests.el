@@ -998,4 +998,249 @@ regex-tests-mutual-exclusive-inf-rec
   ;; relint suppression: Repetition of expression matching an empty string
   (should (equal (string-match "a*\\(?:c\\|b*\\)*" "a") 0)))
 
+;; The DFA that decides whether a regexp matches does not run patterns
+;; with backreferences, so a pattern followed by an empty one runs on
+;; the backtracking matcher alone, and should match the same text as
+;; the pattern alone does with the DFA.
+
+(defun regex-tests--random-regexp (depth)
+  "Return a random regexp, nested at most DEPTH deep."
+  (pcase (random (if (> depth 0) 14 8))
+    ((or 0 1) (string (aref "ab\n" (random 3))))
+    (2 ".")
+    (3 (aref ["[ab]" "[^a]" "[^\nb]" "[[:alpha:]]" "[[:upper:]]" "[^[:word:]]"]
+             (random 6)))
+    (4 (aref ["^" "$" "\\`" "\\'"] (random 4)))
+    ((or 5 6 7) (string (aref "aab" (random 3))))
+    ((or 8 9)
+     (concat (regex-tests--random-regexp (1- depth))
+             (regex-tests--random-regexp (1- depth))))
+    (10 (concat (regex-tests--random-regexp (1- depth))
+                "\\|" (regex-tests--random-regexp (1- depth))))
+    (_ (concat (if (zerop (random 2)) "\\(" "\\(?:")
+               (regex-tests--random-regexp (1- depth)) "\\)"
+               (aref ["*" "+" "?" "*?" "+?" ""] (random 6))))))
+
+(defun regex-tests--random-string (length)
+  "Return a random string of LENGTH chars among a, A, b, é and newline."
+  (let ((s (make-string length ?a)))
+    (dotimes (i length)
+      (aset s i (aref "aaAbé\n" (random 6))))
+    s))
+
+(defun regex-tests--match-data (search)
+  "Call SEARCH, and return its value and the match data."
+  (let ((value (condition-case err (funcall search) (error err))))
+    (list value (and value (seq-remove #'bufferp (match-data t))))))
+
+(ert-deftest regexp-dfa-same-matches ()
+  (random "regexp-dfa")
+  (dotimes (_ 3000)
+    (let* ((internal--regexp-dfa-fail-limit 0)
+           (re (let ((re (regex-tests--random-regexp 4)))
+                 (while (>= (regexp-opt-depth re) 9)
+                   (setq re (regex-tests--random-regexp 4)))
+                 re))
+           (slow (concat "\\(?:" re "\\)\\(?9:\\)\\9"))
+           (string (regex-tests--random-string (random 12)))
+           (start (random (1+ (length string)))))
+      (ert-info ((format "%S on %S from %d" re string start))
+        (dolist (search
+                 (list (lambda (re) (string-match re string start))
+                       (lambda (re)
+                         (string-match re (encode-coding-string string 'utf-8)
+                                       start))
+                       (lambda (re)
+                         (goto-char start)
+                         (re-search-forward re nil t))
+                       (lambda (re)
+                         (goto-char (1+ start))
+                         (re-search-backward re nil t))
+                       (lambda (re)
+                         (goto-char (1+ start))
+                         (looking-at re))))
+          (with-temp-buffer
+            (insert string)
+            (let* ((fast (regex-tests--match-data
+                          (lambda () (funcall search re))))
+                   (ref (regex-tests--match-data
+                         (lambda () (funcall search slow)))))
+              (should (equal (car fast) (car ref)))
+              (should (equal (cadr fast)
+                             (take (length (cadr fast)) (cadr ref)))))))))))
+
+(ert-deftest regexp-dfa-no-exponential-backtracking ()
+  ;; These used to take time exponential in the length of the text, or
+  ;; to overflow the stack of the regexp matcher.
+  (let ((s (make-string 5000 ?a)))
+    (should-not (string-match "\\(?:a\\|aa\\)*c" s))
+    (should-not (string-match "\\(a*\\)*b" s))
+    (should-not (string-match "^\\(?:a+\\)+$" (concat s "b")))
+    (with-temp-buffer
+      (insert s "\n" s)
+      (goto-char (point-min))
+      (should-not (re-search-forward "\\(?:a\\|aa\\)+\\(?:b\\|\n\n\\)" nil t))
+      (should (re-search-forward "\\(?:a\\|aa\\)+\n\\(a\\)" nil t))
+      (should (equal (match-beginning 1) 5002))
+      (goto-char (point-max))
+      (should-not (re-search-backward "\\(?:a\\|aa\\)*c" nil t))
+      (goto-char (point-min))
+      (should-not (looking-at "\\(?:a*\\)*b")))))
+
+;; Buffer searches first look for the longest string that every match
+;; of the regexp contains, and run the regexp only where it may match.
+
+(ert-deftest regexp-must-string-same-matches ()
+  (random "regexp-must")
+  (dotimes (_ 3000)
+    (let* ((re (let ((re (regex-tests--random-regexp 4)))
+                 ;; Non-greedy loops within loops can trip an
+                 ;; assertion of `forall_firstchar_1'.
+                 (while (string-match-p "[*+]\\?.*\\\\)[*+]" re)
+                   (setq re (regex-tests--random-regexp 4)))
+                 (if (zerop (random 2)) (string-replace "b" "é" re) re)))
+           ;; Searches for regexps that are just a string, which
+           ;; do not run the regexp matcher, are tested elsewhere.
+           (fast (concat "\\(?:" re "\\)"))
+           ;; The compiler looks no further than a counted repetition
+           ;; for a string that every match contains.
+           (slow (concat "\\(?:\\)\\{1,2\\}" fast))
+           (string (regex-tests--random-string (random 40)))
+           (multibyte (zerop (random 3)))
+           (case-fold-search (zerop (random 2))))
+      (with-temp-buffer
+        (unless multibyte
+          (set-buffer-multibyte nil)
+          (setq string (encode-coding-string string 'utf-8)))
+        (insert string)
+        ;; Move the gap to a random place.
+        (goto-char (1+ (random (1+ (buffer-size)))))
+        (insert "x")
+        (delete-char -1)
+        (let ((start (1+ (random (1+ (buffer-size))))))
+          (ert-info ((format "%S on %S from %d" re string start))
+            (dolist (search (list #'re-search-forward #'re-search-backward))
+              (should (equal (regex-tests--match-data
+                              (lambda ()
+                                (goto-char start)
+                                (funcall search fast nil t)))
+                             (regex-tests--match-data
+                              (lambda ()
+                                (goto-char start)
+                                (funcall search slow nil t))))))))))))
+
+(ert-deftest regexp-must-string ()
+  (with-temp-buffer
+    (insert "(defvar foo)\n(DEFUN bar ()\n(defun baz ()\n")
+    (dolist (gap (number-sequence (point-min) (point-max)))
+      (goto-char gap)
+      (insert "x")
+      (delete-char -1)
+      (let ((case-fold-search nil))
+        (goto-char (point-min))
+        (should (re-search-forward "defun[ \t]+\\(\\sw+\\)" nil t))
+        (should (equal (match-string 1) "baz"))
+        (should-not (re-search-forward "defun[ \t]+\\(\\sw+\\)" nil t))
+        (should (re-search-backward "(\\(?:defvar\\|defun\\) \\(\\sw+\\)" nil t))
+        (should (equal (match-string 1) "baz"))
+        (should (re-search-backward "\\_<\\(\\sw+\\) ()" nil t))
+        (should (equal (match-string 1) "bar"))
+        (should-not (re-search-backward "DEFUN baz" nil t)))
+      (let ((case-fold-search t))
+        (goto-char (point-min))
+        (should (re-search-forward "(defun \\(\\sw+\\)" nil t))
+        (should (equal (match-string 1) "bar"))
+        (goto-char (point-min))
+        (should (re-search-forward "\\(\\sw+\\) ()\n(DEFUN" nil t))
+        (should (equal (match-string 1) "bar"))
+        (should-not (re-search-forward "()\n(defun" nil t)))))
+  (with-temp-buffer
+    (let ((long (make-string 100 ?a)))
+      (insert "b" long "b" long "c")
+      (goto-char 50)
+      (insert "x")
+      (delete-char -1)
+      (goto-char (point-min))
+      (should (re-search-forward (concat "[bc]" long "c") nil t))
+      (should (equal (match-beginning 0) 102))
+      (should (re-search-backward (concat "b" long "[bc]") nil t))
+      (should (equal (match-beginning 0) 102))
+      (goto-char (point-max))
+      (should (re-search-backward (concat "b" long "b") nil t))
+      (should (equal (match-beginning 0) 1)))))
+
+;; When every match starts with one of a few strings, buffer searches
+;; run the regexp only where one of them starts.
+
+(ert-deftest regexp-prefix-literals-same-matches ()
+  "Check that looking for the strings that start matches changes no match."
+  (random "regexp-literals")
+  (dotimes (_ 2000)
+    (let* ((words (mapcar (lambda (_)
+                            (concat (regex-tests--random-string
+                                     (+ 2 (random 3)))
+                                    (aref ["" "[ab]" "[bé]" "b?" "a*"]
+                                          (random 5))))
+                          (make-list (1+ (random 4)) nil)))
+           (re (concat (if (zerop (random 3)) "\_<" "")
+                       "\(?:" (string-join words "\|") "\)"
+                       (aref ["" "+" "b" "\(a\|é\)"] (random 4))))
+           ;; The strings are not looked for after a counted repetition.
+           (slow (concat "\(?:\)\{1,2\}" re))
+           (string (regex-tests--random-string (random 60)))
+           (multibyte (zerop (random 3)))
+           (case-fold-search (zerop (random 2))))
+      (with-temp-buffer
+        (unless multibyte
+          (set-buffer-multibyte nil)
+          (setq string (encode-coding-string string 'utf-8)))
+        (insert string)
+        (goto-char (1+ (random (1+ (buffer-size)))))
+        (insert "x")
+        (delete-char -1)
+        (let ((start (1+ (random (1+ (buffer-size))))))
+          (ert-info ((format "%S on %S from %d" re string start))
+            (dolist (search (list #'re-search-forward #'re-search-backward))
+              (should (equal (regex-tests--match-data
+                              (lambda ()
+                                (goto-char start)
+                                (funcall search re nil t)))
+                             (regex-tests--match-data
+                              (lambda ()
+                                (goto-char start)
+                                (funcall search slow nil t))))))))))))
+
+(ert-deftest regexp-prefix-literals ()
+  "Check searches for regexps that start with one of several strings."
+  (with-temp-buffer
+    (insert "(defvar foo)\n(DEFCUSTOM bar)\n(defface baz)\nabcdef cd\n")
+    (dolist (gap (number-sequence (point-min) (point-max)))
+      (goto-char gap)
+      (insert "x")
+      (delete-char -1)
+      (let ((case-fold-search nil))
+        (goto-char (point-min))
+        (should (re-search-forward
+                 "(\\(?:defcustom\\|defface\\|defvar\\) \\(\\sw+\\)" nil t))
+        (should (equal (match-string 1) "foo"))
+        (should (re-search-forward
+                 "(\\(?:defcustom\\|defface\\|defvar\\) \\(\\sw+\\)" nil t))
+        (should (equal (match-string 1) "baz"))
+        ;; The match that starts first is found, not the one that ends
+        ;; first.
+        (should (re-search-forward "cd\\|abcdef" nil t))
+        (should (equal (match-string 0) "abcdef"))
+        (goto-char (point-max))
+        (should (re-search-backward "bcd\\|ab\\|ef cd" nil t))
+        (should (equal (match-string 0) "ef cd"))
+        (should (re-search-backward "bcd\\|ab\\|ef cd" nil t))
+        (should (equal (match-string 0) "bcd"))
+        (goto-char (point-max))
+        (should-not (re-search-backward "(ba[rz]\\|(defcu" nil t)))
+      (let ((case-fold-search t))
+        (goto-char (point-max))
+        (should (re-search-backward "(\\(?:defcu\\|ba[rz]\\)" nil t))
+        (should (equal (match-string 0) "(DEFCU"))
+        (should-not (re-search-backward "\\(?:foo\\|bar\\)[^)]" nil t))))))
+
 ;;; regex-emacs-tests.el ends here
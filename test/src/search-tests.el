@@ -79,4 +79,160 @@ search-test--replace-match-update-data
         ;;(should (equal (match-end 2) beg4))
         ))))
 
+;; Scanning for newlines counts whole blocks of text at a time when
+;; the target line is far away; check that the result is the same as
+;; stepping from one newline to the next.
+(ert-deftest search-test--find-newline-blocks ()
+  (with-temp-buffer
+    (dotimes (i 3000)
+      (insert (make-string (% (* i 7) 53) (if (zerop (% i 3)) ?é ?x)))
+      (insert "\n"))
+    (insert (make-string 10000 ?y))
+    (dolist (cache '(nil t))
+      (setq cache-long-scans cache)
+      (dolist (from (list (point-min) 12345 (point-max)))
+        (dolist (n '(1 100 1000 2999 3000 5000))
+          (goto-char from)
+          (should (= (progn (forward-line n) (point))
+                     (save-excursion
+                       (goto-char from)
+                       (if (search-forward "\n" nil t n)
+                           (point)
+                         (point-max)))))
+          (goto-char from)
+          (should (= (progn (forward-line (- n)) (point))
+                     (save-excursion
+                       (goto-char from)
+                       (if (search-backward "\n" nil t (1+ n))
+                           (1+ (point))
+                         (point-min))))))
+        (should (= (line-number-at-pos from)
+                   (1+ (how-many "\n" (point-min) from))))))))
+
+;; Long scans for newlines consult the line index, which must stay
+;; accurate as the buffer is modified.
+(ert-deftest search-test--line-index ()
+  (with-temp-buffer
+    (setq cache-long-scans t)
+    (dotimes (i 20000)
+      (insert (if (zerop (% i 5)) "é" "x") (number-to-string i) "\n"))
+    (let ((check
+           (lambda ()
+             (dolist (pos (list (point-min) 7777 60001 (point-max)))
+               (should (= (line-number-at-pos pos)
+                          (1+ (how-many "\n" (point-min) pos))))
+               (goto-char pos)
+               (forward-line 1000)
+               (should (= (point)
+                          (save-excursion
+                            (goto-char pos)
+                            (if (search-forward "\n" nil t 1000)
+                                (point)
+                              (point-max)))))))))
+      (funcall check)
+      (goto-char 5000)
+      (insert (make-string 30000 ?\n))
+      (funcall check)
+      (delete-region 100 40000)
+      (funcall check)
+      (subst-char-in-region 1000 50000 ?\n ?y)
+      (funcall check)
+      (goto-char (point-max))
+      (insert "tail\n")
+      (set-buffer-multibyte nil)
+      (funcall check))))
+
+;; Literal searches look for the ends of the pattern many bytes at a
+;; time, so check them against a naive search, for matches near the
+;; ends of the buffer and of the gap, and with and without case folding.
+(defun search-tests--literal-matches (pattern string fold backward)
+  "Return the positions of the matches for PATTERN in STRING.
+Ignore the case of ASCII letters if FOLD, and return the matches found
+from the end of STRING if BACKWARD, in the order they are found."
+  (let* ((len (length pattern))
+         (all (seq-filter
+               (lambda (i)
+                 (eq t (compare-strings pattern nil nil
+                                        string i (+ i len) fold)))
+               (number-sequence 0 (- (length string) len))))
+         (bound (if backward (1+ (length string)) 0))
+         (found nil))
+    (dolist (i (if backward (reverse all) all))
+      (when (if backward (<= (+ i len) bound) (>= i bound))
+        (push (1+ i) found)
+        (setq bound (if backward i (+ i len)))))
+    (nreverse found)))
+
+(ert-deftest search-tests--literal-search ()
+  (let ((text (with-temp-buffer
+                (random "search-tests")
+                (dotimes (_ 3000)
+                  (insert (aref ["ab" "Ab" "aB" "b" "a" " " "\n" "é" "ÀB"]
+                                (random 9))))
+                (buffer-string))))
+    (dolist (multibyte '(t nil))
+      (with-temp-buffer
+        (set-buffer-multibyte multibyte)
+        (insert (if multibyte text (encode-coding-string text 'utf-8)))
+        (goto-char (/ (point-max) 2))
+        (insert "x")
+        (delete-char -1)
+        (dolist (case-fold-search '(nil t))
+          (dolist (pat '("a" "ab" "aba" "b ab" "ba\nab" "é" "bé"
+                         "abababab" "abab abab"))
+            (when case-fold-search
+              (setq pat (replace-regexp-in-string "[a-z]" #'upcase pat t)))
+            (unless multibyte
+              (setq pat (encode-coding-string pat 'utf-8)))
+            (dolist (backward '(nil t))
+              (let ((found nil))
+                (goto-char (if backward (point-max) (point-min)))
+                (while (if backward
+                           (search-backward pat nil t)
+                         (search-forward pat nil t))
+                  (push (match-beginning 0) found))
+                (should (equal (nreverse found)
+                               (search-tests--literal-matches
+                                pat (buffer-string) case-fold-search
+                                backward)))))))))))
+
+;; The cache of compiled regexps must keep as many of them as
+;; `regexp-cache-size' says, and count how it is used.
+(ert-deftest search-tests--regexp-cache ()
+  (let ((regexps (mapcar (lambda (i) (format "x%d\\(y\\|z\\)*" i))
+                         (number-sequence 1 50)))
+        (regexp-cache-size 60))
+    (with-temp-buffer
+      (insert "x7yzy x49z")
+      (regexp-cache-statistics t)
+      (dotimes (_ 3)
+        (dolist (regexp regexps)
+          (goto-char (point-min))
+          (should (eq (re-search-forward regexp nil t)
+                      (pcase regexp
+                        ("x4\\(y\\|z\\)*" 9)
+                        ("x7\\(y\\|z\\)*" 6)
+                        ("x49\\(y\\|z\\)*" 11))))))
+      (let ((stats (regexp-cache-statistics t)))
+        (should (= (plist-get stats :misses) 50))
+        (should (= (plist-get stats :hits) 100))
+        (should (>= (plist-get stats :size) 50))
+        (should (floatp (plist-get stats :compile-time))))
+      ;; With a smaller cache, cycling through the regexps compiles
+      ;; them every time.
+      (setq regexp-cache-size 25)
+      (dotimes (_ 2)
+        (dolist (regexp regexps)
+          (string-match regexp "x7y")))
+      (let ((stats (regexp-cache-statistics)))
+        (should (= (plist-get stats :misses) 100))
+        (should (= (plist-get stats :hits) 0))
+        (should (= (plist-get stats :evictions) 100))
+        (should (= (plist-get stats :size) 25)))
+      ;; Changing a syntax table invalidates the regexps that use it.
+      (with-syntax-table (make-syntax-table)
+        (should (string-match "\\sw" "-a"))
+        (modify-syntax-entry ?- "w")
+        (should (= (string-match "\\sw" "-a") 0))))))
+
 ;;; search-tests.el ends here
@@ -520,4 +520,154 @@ syntax-char-syntax
         (should (equal (eval '(char-syntax 128) t) ?_))
         (should (equal (funcall cs 128) ?_))))))
 
+;; `skip-chars-forward' and `skip-chars-backward' skip long runs of
+;; ASCII characters many at a time.
+
+(defun syntax-tests--skip-chars-slowly (forward string lim)
+  "Skip the chars in STRING up to LIM, one char at a time.
+Skip forward if FORWARD, and backward otherwise."
+  (let ((start (point)))
+    (while (not (zerop (if forward
+                           (skip-chars-forward string (min lim (1+ (point))))
+                         (skip-chars-backward string
+                                              (max lim (1- (point))))))))
+    (- (point) start)))
+
+(ert-deftest syntax-skip-chars-long-runs ()
+  (random "skip-chars")
+  (dolist (multibyte '(t nil))
+    (dolist (string '(" \t\n" "a-zA-Z0-9_" "^\n" "^ \t" "[:alpha:]"
+                      "[:space:]" "^[:word:]" "[:alnum:]_-" "a-zé" "^a-fé"
+                      "\t-~" "!#%&()*+,./:;<=>?@[]^`{|}" "^a"))
+      (with-temp-buffer
+        (set-buffer-multibyte multibyte)
+        (dotimes (_ 200)
+          (insert (make-string (random 60)
+                               (aref "  \t\naZ09_-.(é\200" (random 14)))))
+        (dotimes (_ 200)
+          (let ((from (1+ (random (buffer-size))))
+                (lim (1+ (random (buffer-size))))
+                (forward (zerop (random 2))))
+            ;; Move the gap to a random place.
+            (goto-char (1+ (random (buffer-size))))
+            (insert "x")
+            (delete-char -1)
+            (unless (eq forward (<= from lim))
+              (setq lim (if forward (point-max) (point-min))))
+            (ert-info ((format "%S from %d to %d" string from lim))
+              (goto-char from)
+              (let ((distance (syntax-tests--skip-chars-slowly
+                               forward string lim)))
+                (goto-char from)
+                (should (equal (if forward
+                                   (skip-chars-forward string lim)
+                                 (skip-chars-backward string lim))
+                               distance))))))))))
+
+;; `internal--syntax-ppss' remembers the parse states at positions a
+;; few thousand characters apart.
+
+(defun syntax-tests--ppss-equal (pos)
+  "Check the value of `internal--syntax-ppss' at POS.
+Elements 2 and 6 of its value are not compared."
+  (let ((ppss (internal--syntax-ppss pos))
+        (expected (save-excursion (parse-partial-sexp (point-min) pos))))
+    (should (= (point) pos))
+    (setf (nth 2 ppss) nil (nth 6 ppss) nil)
+    (setf (nth 2 expected) nil (nth 6 expected) nil)
+    (should (equal ppss expected))))
+
+(ert-deftest syntax-ppss-cache ()
+  (random "syntax-ppss")
+  (with-temp-buffer
+    (emacs-lisp-mode)
+    (dotimes (_ 5000)
+      (insert (aref ["(" ")" "\"" "\\" ";" "\n" "?" " " "foo" "#|" "|#"]
+                    (random 11))))
+    (let ((other (make-syntax-table (syntax-table))))
+      (modify-syntax-entry ?\; "." other)
+      (setq parse-sexp-lookup-properties t)
+      (dotimes (i 1000)
+        (let ((pos (1+ (random (buffer-size)))))
+          (ert-info ((format "Step %d at %d" i pos))
+            (pcase (random 8)
+              ;; Change the text, even without running the hooks.
+              (0 (goto-char pos)
+                 (let ((inhibit-modification-hooks (zerop (random 2))))
+                   (insert (aref ["(" ")" "\"" ";" "\n"] (random 5)))))
+              (1 (let ((inhibit-modification-hooks (zerop (random 2))))
+                   (delete-region pos (min (point-max) (+ pos (random 10))))))
+              ;; Change the syntax of some text.
+              (2 (with-silent-modifications
+                   (put-text-property pos (min (point-max) (1+ pos))
+                                      'syntax-table
+                                      (string-to-syntax
+                                       (aref ["." "\"" "<" "(" "w"]
+                                             (random 5))))))
+              (3 (with-silent-modifications
+                   (remove-list-of-text-properties
+                    pos (point-max) '(syntax-table)))))
+            (when (zerop (random 50))
+              (setq parse-sexp-lookup-properties
+                    (not parse-sexp-lookup-properties)))
+            (with-syntax-table (if (zerop (random 50)) other (syntax-table))
+              (syntax-tests--ppss-equal (1+ (random (buffer-size))))
+              (syntax-tests--ppss-equal (point-max))
+              (save-restriction
+                (narrow-to-region (min pos (point-max)) (point-max))
+                (syntax-tests--ppss-equal (point-max))))))))))
+
+;; Runs of ASCII characters are scanned with a table of their syntax,
+;; except for characters with a `syntax-table' property, so giving each
+;; character its own syntax as a property tells whether the results are
+;; the same.
+(defun syntax-tests--scans (pos)
+  "Return the results of scanning forward from POS in the current buffer."
+  (mapcar (lambda (scan)
+            (save-excursion
+              (goto-char pos)
+              (condition-case err
+                  (list (funcall scan) (point))
+                (scan-error err))))
+          (list (lambda () (scan-lists pos 1 0))
+                (lambda () (scan-lists pos 1 1))
+                (lambda () (scan-sexps pos 1))
+                (lambda () (forward-comment 1))
+                (lambda () (parse-partial-sexp pos (point-max))))))
+
+(ert-deftest syntax-ascii-runs ()
+  (random "syntax-ascii")
+  (let ((c-like (make-syntax-table)))
+    (modify-syntax-entry ?/ ". 124b" c-like)
+    (modify-syntax-entry ?* ". 23" c-like)
+    (modify-syntax-entry ?\n "> b" c-like)
+    (modify-syntax-entry ?' "\"" c-like)
+    (modify-syntax-entry ?@ "_ p" c-like)
+    (dolist (table (list emacs-lisp-mode-syntax-table c-like))
+      (with-temp-buffer
+        (dotimes (_ 3000)
+          (insert (aref ["(" ")" "[" "]" "\"" "'" "\\" ";" "\n" "/" "*"
+                         "@" "#|" "|#" " " "foo" "é"]
+                        (random 17))))
+        (let ((text (buffer-string))
+              (fast (current-buffer)))
+          ;; Leave the gap in the middle.
+          (goto-char (/ (point-max) 2))
+          (insert "x")
+          (delete-char -1)
+          (set-syntax-table table)
+          (with-temp-buffer
+            (insert text)
+            (set-syntax-table table)
+            (setq parse-sexp-lookup-properties t)
+            (dotimes (i (buffer-size))
+              (put-text-property (1+ i) (+ i 2) 'syntax-table
+                                 (aref table (char-after (1+ i)))))
+            (dotimes (_ 300)
+              (let ((pos (1+ (random (buffer-size)))))
+                (ert-info ((format "At %d" pos))
+                  (should (equal (syntax-tests--scans pos)
+                                 (with-current-buffer fast
+                                   (syntax-tests--scans pos)))))))))))))
+
 ;;; syntax-tests.el ends here
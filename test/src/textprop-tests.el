@@ -119,5 +119,29 @@ textprop-interval-immutability
       ;; `inhibit-read-only''s influence towards the end of the buffer.
       (should-error (delete-and-extract-region 26 37)))))
 
+(ert-deftest textprop-tests-delete-intervals ()
+  "Check text properties after deleting many intervals.
+This makes the interval tree of the buffer very unbalanced, until
+looking up properties rebuilds some of it."
+  (with-temp-buffer
+    (dotimes (i 4000)
+      (insert (propertize (make-string (if (zerop (% i 100)) 10000 2) ?a)
+                          'n i)
+              "z"))
+    (goto-char (point-min))
+    (while (search-forward (make-string 100 ?a) nil t)
+      (delete-region (match-beginning 0) (match-end 0)))
+    (random "textprop-tests")
+    (dotimes (_ 20000)
+      (get-text-property (1+ (random (buffer-size))) 'n))
+    (goto-char (point-min))
+    (dotimes (i 4000)
+      (unless (zerop (% i 100))
+        (should (equal (get-text-property (point) 'n) i))
+        (goto-char (next-single-property-change (point) 'n)))
+      (should (equal (char-after) ?z))
+      (forward-char 1))
+    (should (eobp))))
+
 (provide 'textprop-tests)
 ;;; textprop-tests.el ends here
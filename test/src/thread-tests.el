@@ -106,6 +106,19 @@ threads-join
             (= threads-test-global 23)
             (not (thread-live-p thread)))))))
 
+(ert-deftest threads-join-timeout ()
+  "Test of `thread-join' with a timeout."
+  (skip-unless (featurep 'threads))
+  (let* ((mutex (make-mutex))
+         (thread (progn
+                   (mutex-lock mutex)
+                   (make-thread (lambda ()
+                                  (with-mutex mutex 'done))))))
+    (should-not (thread-join thread 0.05))
+    (should (thread-live-p thread))
+    (mutex-unlock mutex)
+    (should (eq (thread-join thread 10) 'done))))
+
 (ert-deftest threads-join-self ()
   "Cannot `thread-join' the current thread."
   (skip-unless (featurep 'threads))
@@ -388,6 +401,76 @@ threads-condvar-wait
     (should (= (length (all-threads)) 1))
     (should (equal (thread-last-error) '(error "Die, die, die!")))))
 
+(ert-deftest threads-condvar-wait-timeout ()
+  "Test waiting on a condition variable with a timeout."
+  (skip-unless (featurep 'threads))
+  (let* ((mutex (make-mutex))
+         (cv (make-condition-variable mutex)))
+    (with-mutex mutex
+      (should-not (condition-wait cv 0.05))
+      ;; The mutex is held again, so this does not signal.
+      (condition-notify cv)
+      (should-error (condition-wait cv 'soon)
+                    :type 'wrong-type-argument))))
+
+(ert-deftest threads-channel ()
+  "Test passing values through a channel."
+  (skip-unless (featurep 'threads))
+  (let* ((channel (make-channel 2 "test"))
+         (producers
+          (mapcar (lambda (start)
+                    (make-thread
+                     (lambda ()
+                       (dotimes (i 50)
+                         (channel-send channel (+ start i))))))
+                  '(0 100)))
+         (received nil))
+    (should (channelp channel))
+    (should (equal (channel-name channel) "test"))
+    (should (string-match-p "\\`#<channel test>\\'"
+                            (prin1-to-string channel)))
+    (dotimes (_ 100)
+      (push (channel-receive channel 10 'timeout) received))
+    (mapc #'thread-join producers)
+    (should (equal (sort received #'<)
+                   (append (number-sequence 0 49)
+                           (number-sequence 100 149))))
+    ;; Timeouts.
+    (should (eq (channel-receive channel 0.05 'empty) 'empty))
+    (should (channel-send channel 1))
+    (should (channel-send channel 2))
+    (should-not (channel-send channel 3 0.05))
+    ;; Closing.
+    (channel-close channel)
+    (should-error (channel-send channel 4))
+    (should (= (channel-receive channel) 1))
+    (should (= (channel-receive channel) 2))
+    (should (eq (channel-receive channel nil 'closed) 'closed))
+    (should-error (make-channel 0) :type 'args-out-of-range)))
+
+(ert-deftest threads-channel-close-wakes ()
+  "Test that closing a channel wakes the threads waiting on it."
+  (skip-unless (featurep 'threads))
+  (let* ((channel (make-channel 1))
+         (thread (make-thread (lambda ()
+                                (channel-receive channel nil 'closed)))))
+    (while (not (eq (thread--blocker thread) channel))
+      (thread-yield))
+    (channel-close channel)
+    (should (eq (thread-join thread) 'closed))))
+
+(ert-deftest threads-async-future ()
+  "Test that async futures are opaque and hold the result of their job."
+  (should-error (async-wait (record 'async-future))
+                :type 'wrong-type-argument)
+  (should-error (async-done-p [async-future 0 nil nil nil])
+                :type 'wrong-type-argument)
+  (let ((future (async-secure-hash 'sha256 "abc")))
+    (should (async-future-p future))
+    (should (eq (cl-type-of future) 'async-future))
+    (should (equal (async-wait future) (secure-hash 'sha256 "abc")))
+    (should (async-done-p future))))
+
 (ert-deftest threads-test-bug33073 ()
   (skip-unless (fboundp 'make-thread))
   (let ((th (make-thread 'ignore)))